@@ -0,0 +1,133 @@
+// Banc d'essai : coût par image de la répartition vers le moteur de jeu.
+//
+// Compare, avec un moteur de jeu vide, la boucle principale historique 
+// (fonctions du moteur enveloppées par std::bind dans des std::function) 
+// et la boucle instanciée pour le type du moteur (appels directs).
+//
+// Les deux boucles ont exactement la même forme que Application::run. Les 
+// types Keyboard et Timer n'étant constructibles que par Application, de 
+// simples substituts sont utilisés pour isoler le coût de la répartition.
+// Le coût complet de la boucle headless (Application::run<EmptyEngine>) 
+// est ensuite affiché par le rapport de l'application.
+//
+// Compilation (Linux) :
+//   g++ -std=c++20 -O2 -IEzGame/include EzGame/benchmarks/ApplicationRunBenchmark.cpp EzGame/src/*.cpp <EzGame>
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <string>
+
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    size_t const smFrameCount{ 20'000'000 };
+    size_t const smRepetitionCount{ 5 };
+
+    struct KeyboardStandIn {};
+    struct TimerStandIn {};
+    struct ScreenStandIn {};
+
+    // Moteur vide : le compteur volatile empêche seulement le compilateur 
+    // d'éliminer les appels.
+    class EmptyEngine
+    {
+    public:
+        float width() const { return 800.0f; }
+        float height() const { return 600.0f; }
+        std::string title() const { return "Banc d'essai"; }
+        std::string iconFileName() const { return ""; }
+
+        template <typename KeyboardType, typename TimerType>
+        bool provessEvents(KeyboardType const&, TimerType const&) { mEvents = mEvents + 1; return true; }
+        template <typename ScreenType>
+        void processDisplay(ScreenType &) { mDisplays = mDisplays + 1; }
+
+    private:
+        size_t volatile mEvents{};
+        size_t volatile mDisplays{};
+    };
+
+    class EmptyEzGameEngine : public EmptyEngine
+    {
+    public:
+        bool provessEvents(ezgame::Keyboard const& keyboard, ezgame::Timer const& timer) { return EmptyEngine::provessEvents(keyboard, timer); }
+        void processDisplay(ezgame::Screen & screen) { EmptyEngine::processDisplay(screen); }
+    };
+
+    // Boucle historique : répartition par std::function.
+    void runTypeErased(std::function<bool(KeyboardStandIn const&, TimerStandIn const&)> updateModel, std::function<void(ScreenStandIn&)> updateView)
+    {
+        KeyboardStandIn keyboard;
+        TimerStandIn timer;
+        ScreenStandIn screen;
+        for (size_t frame{}; frame < smFrameCount; ++frame) {
+            if (!updateModel(keyboard, timer)) {
+                break;
+            }
+            updateView(screen);
+        }
+    }
+
+    // Nouvelle boucle : appels directs au moteur.
+    template <typename GE>
+    void runDirect(GE & gameEngine)
+    {
+        KeyboardStandIn keyboard;
+        TimerStandIn timer;
+        ScreenStandIn screen;
+        for (size_t frame{}; frame < smFrameCount; ++frame) {
+            if (!gameEngine.provessEvents(keyboard, timer)) {
+                break;
+            }
+            gameEngine.processDisplay(screen);
+        }
+    }
+
+    template <typename Function>
+    double bestNanosecondsPerFrame(Function function)
+    {
+        double best{ std::numeric_limits<double>::max() };
+        for (size_t repetition{}; repetition < smRepetitionCount; ++repetition) {
+            Clock::time_point const start{ Clock::now() };
+            function();
+            double const elapsed{ std::chrono::duration<double, std::nano>(Clock::now() - start).count() };
+            best = std::min(best, elapsed / static_cast<double>(smFrameCount));
+        }
+        return best;
+    }
+
+} // namespace
+
+
+int main()
+{
+    EmptyEngine engine;
+
+    double const typeErased{ bestNanosecondsPerFrame([&engine]() {
+        runTypeErased(std::bind(&EmptyEngine::provessEvents<KeyboardStandIn, TimerStandIn>, &engine, std::placeholders::_1, std::placeholders::_2),
+                      std::bind(&EmptyEngine::processDisplay<ScreenStandIn>, &engine, std::placeholders::_1));
+    }) };
+    double const direct{ bestNanosecondsPerFrame([&engine]() {
+        runDirect(engine);
+    }) };
+
+    std::printf("std::function + std::bind : %8.3f ns/image\n", typeErased);
+    std::printf("appels directs (template) : %8.3f ns/image\n", direct);
+    std::printf("gain                      : %8.3f ns/image (x%.2f)\n", typeErased - direct, direct > 0.0 ? typeErased / direct : 0.0);
+    std::fflush(stdout);
+
+    ezgame::Application application;
+    application.setFrameLimit(smFrameCount / 10);
+    application.run<EmptyEzGameEngine>();
+
+    return 0;
+}
@@ -0,0 +1,117 @@
+// Banc d'essai : mémoire et débit des couleurs compactes et des
+// traitements par lot.
+//
+// Compare, pour 10 000 couleurs :
+//  - l'espace occupé par Color (4 réels) et par ColorRGBA8 (4 octets);
+//  - le traitement couleur par couleur avec les méthodes de Color
+//    (getHsl, fromHsl, getHsv, fromHsv, blended);
+//  - les traitements par lot de ColorBatch sur des tableaux de Color et
+//    de ColorRGBA8.
+//
+// Vérifie aussi qu'un aller-retour RGB -> HSL -> RGB par lot restitue
+// exactement les couleurs compactes.
+//
+// Compilation (Linux) :
+//   g++ -std=c++20 -O2 -IEzGame/include EzGame/benchmarks/ColorBatchBenchmark.cpp EzGame/src/*.cpp <EzGame>
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    size_t const smColorCount{ 10'000 };
+    size_t const smRepetitionCount{ 200 };
+
+    template <typename Function>
+    double bestNanosecondsPerColor(Function function)
+    {
+        double best{ std::numeric_limits<double>::max() };
+        for (size_t repetition{}; repetition < smRepetitionCount; ++repetition) {
+            Clock::time_point const start{ Clock::now() };
+            function();
+            double const elapsed{ std::chrono::duration<double, std::nano>(Clock::now() - start).count() };
+            best = std::min(best, elapsed / static_cast<double>(smColorCount));
+        }
+        return best;
+    }
+
+    void report(char const * name, double perColor, double batchColor, double batchPacked)
+    {
+        std::printf("%-16s %8.2f ns %8.2f ns %8.2f ns   x%.1f\n", name, perColor, batchColor, batchPacked, batchPacked > 0.0 ? perColor / batchPacked : 0.0);
+    }
+
+} // namespace
+
+
+int main()
+{
+    using namespace ezgame;
+
+    Random::seed(434);
+    std::vector<Color> colors(smColorCount);
+    std::vector<Color> others(smColorCount);
+    std::vector<Color> results(smColorCount);
+    for (size_t i{}; i < smColorCount; ++i) {
+        colors[i] = ColorRGBA8(Color(Random::real(0.0f, 1.0f), Random::real(0.0f, 1.0f), Random::real(0.0f, 1.0f))).toColor();
+        others[i] = ColorRGBA8(Color(Random::real(0.0f, 1.0f), Random::real(0.0f, 1.0f), Random::real(0.0f, 1.0f))).toColor();
+    }
+    std::vector<ColorRGBA8> packedColors(smColorCount);
+    std::vector<ColorRGBA8> packedOthers(smColorCount);
+    std::vector<ColorRGBA8> packedResults(smColorCount);
+    ColorBatch::convert(colors, packedColors);
+    ColorBatch::convert(others, packedOthers);
+
+    std::vector<float> hues(smColorCount);
+    std::vector<float> saturations(smColorCount);
+    std::vector<float> lightnesses(smColorCount);
+    std::vector<float> factors(smColorCount);
+    Random::fill(factors, 0.0f, 1.0f);
+
+    std::printf("memoire pour %zu couleurs : Color %zu octets, ColorRGBA8 %zu octets\n\n",
+        smColorCount, smColorCount * sizeof(Color), smColorCount * sizeof(ColorRGBA8));
+
+    std::printf("%-16s %11s %11s %11s\n", "par couleur", "Color", "lot Color", "lot RGBA8");
+
+    report("rgb -> hsl",
+        bestNanosecondsPerColor([&]() { for (size_t i{}; i < smColorCount; ++i) colors[i].getHsl(hues[i], saturations[i], lightnesses[i]); }),
+        bestNanosecondsPerColor([&]() { ColorBatch::rgbToHsl(colors, hues, saturations, lightnesses); }),
+        bestNanosecondsPerColor([&]() { ColorBatch::rgbToHsl(packedColors, hues, saturations, lightnesses); }));
+    report("hsl -> rgb",
+        bestNanosecondsPerColor([&]() { for (size_t i{}; i < smColorCount; ++i) results[i] = Color::fromHsl(hues[i], saturations[i], lightnesses[i]); }),
+        bestNanosecondsPerColor([&]() { ColorBatch::hslToRgb(hues, saturations, lightnesses, std::span<Color>(results)); }),
+        bestNanosecondsPerColor([&]() { ColorBatch::hslToRgb(hues, saturations, lightnesses, std::span<ColorRGBA8>(packedResults)); }));
+    report("rgb -> hsv",
+        bestNanosecondsPerColor([&]() { for (size_t i{}; i < smColorCount; ++i) colors[i].getHsv(hues[i], saturations[i], lightnesses[i]); }),
+        bestNanosecondsPerColor([&]() { ColorBatch::rgbToHsv(colors, hues, saturations, lightnesses); }),
+        bestNanosecondsPerColor([&]() { ColorBatch::rgbToHsv(packedColors, hues, saturations, lightnesses); }));
+    report("hsv -> rgb",
+        bestNanosecondsPerColor([&]() { for (size_t i{}; i < smColorCount; ++i) results[i] = Color::fromHsv(hues[i], saturations[i], lightnesses[i]); }),
+        bestNanosecondsPerColor([&]() { ColorBatch::hsvToRgb(hues, saturations, lightnesses, std::span<Color>(results)); }),
+        bestNanosecondsPerColor([&]() { ColorBatch::hsvToRgb(hues, saturations, lightnesses, std::span<ColorRGBA8>(packedResults)); }));
+    report("blend (commun)",
+        bestNanosecondsPerColor([&]() { for (size_t i{}; i < smColorCount; ++i) results[i] = colors[i].blended(others[i], 0.25f); }),
+        bestNanosecondsPerColor([&]() { ColorBatch::blend(colors, others, 0.25f, results); }),
+        bestNanosecondsPerColor([&]() { ColorBatch::blend(packedColors, packedOthers, 0.25f, packedResults); }));
+    report("blend (propre)",
+        bestNanosecondsPerColor([&]() { for (size_t i{}; i < smColorCount; ++i) results[i] = colors[i].blended(others[i], factors[i]); }),
+        bestNanosecondsPerColor([&]() { ColorBatch::blend(colors, others, factors, results); }),
+        bestNanosecondsPerColor([&]() { ColorBatch::blend(packedColors, packedOthers, factors, packedResults); }));
+
+    // Aller-retour exact des couleurs compactes.
+    ColorBatch::rgbToHsl(packedColors, hues, saturations, lightnesses);
+    packedResults = packedColors;
+    ColorBatch::hslToRgb(hues, saturations, lightnesses, std::span<ColorRGBA8>(packedResults));
+    std::printf("\naller-retour RGBA8 -> HSL -> RGBA8 exact : %s\n", packedResults == packedColors ? "oui" : "non");
+
+    return 0;
+}
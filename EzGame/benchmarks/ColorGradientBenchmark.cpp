@@ -0,0 +1,97 @@
+// Banc d'essai : coût par particule d'une couleur calculée et d'une
+// couleur lue dans une table ColorGradient.
+//
+// Compare, pour 10 000 particules :
+//  - Color::fromHsl et ColorGradient::at (teinte selon l'âge);
+//  - Color::blended entre deux couleurs et ColorGradient::at;
+//  - Color::randomized et ColorGradient::random;
+//  - la boucle par particule et ColorGradient::sample sur les couleurs de
+//    remplissage d'un CircleBatch.
+//
+// Compilation (Linux) :
+//   g++ -std=c++20 -O2 -IEzGame/include EzGame/benchmarks/ColorGradientBenchmark.cpp EzGame/src/*.cpp <EzGame>
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <span>
+#include <vector>
+
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    size_t const smParticleCount{ 10'000 };
+    size_t const smRepetitionCount{ 200 };
+
+    template <typename Function>
+    double bestNanosecondsPerParticle(Function function)
+    {
+        double best{ std::numeric_limits<double>::max() };
+        for (size_t repetition{}; repetition < smRepetitionCount; ++repetition) {
+            Clock::time_point const start{ Clock::now() };
+            function();
+            double const elapsed{ std::chrono::duration<double, std::nano>(Clock::now() - start).count() };
+            best = std::min(best, elapsed / static_cast<double>(smParticleCount));
+        }
+        return best;
+    }
+
+    void report(char const * name, double computed, double table)
+    {
+        std::printf("%-26s %8.2f ns %8.2f ns   x%.1f\n", name, computed, table, table > 0.0 ? computed / table : 0.0);
+    }
+
+} // namespace
+
+
+int main()
+{
+    using namespace ezgame;
+
+    Random::seed(434);
+    std::vector<float> ages(smParticleCount);
+    Random::fill(ages, 0.0f, 1.0f);
+
+    CircleBatch particles(smParticleCount);
+    for (size_t i{}; i < smParticleCount; ++i) {
+        particles.add(2.0f, Vect2d(Random::real(0.0f, 800.0f), Random::real(0.0f, 600.0f)), Color::White);
+    }
+    Color * colors{ particles.fillColors() };
+
+    ColorGradient const rainbow{ ColorGradient::fromHslRange(0.0f, 0.8f, 1.0f, 1.0f, 0.5f, 0.5f) };
+    ColorGradient const fade{ ColorGradient::fromStops({ { 0.0f, Color::Yellow }, { 1.0f, Color::Red } }) };
+
+    std::printf("%-26s %11s %11s\n", "par particule", "calcul", "table");
+
+    report("fromHsl / at",
+        bestNanosecondsPerParticle([&]() { for (size_t i{}; i < smParticleCount; ++i) colors[i] = Color::fromHsl(ages[i] * 0.8f, 1.0f, 0.5f); }),
+        bestNanosecondsPerParticle([&]() { for (size_t i{}; i < smParticleCount; ++i) colors[i] = rainbow.at(ages[i]); }));
+    report("blended / at",
+        bestNanosecondsPerParticle([&]() { for (size_t i{}; i < smParticleCount; ++i) colors[i] = Color::Yellow.blended(Color::Red, 1.0f - ages[i]); }),
+        bestNanosecondsPerParticle([&]() { for (size_t i{}; i < smParticleCount; ++i) colors[i] = fade.at(ages[i]); }));
+    report("randomized / random",
+        bestNanosecondsPerParticle([&]() { for (size_t i{}; i < smParticleCount; ++i) colors[i] = Color::randomized(0.0f, 0.8f, 1.0f, 1.0f, 0.5f, 0.5f); }),
+        bestNanosecondsPerParticle([&]() { for (size_t i{}; i < smParticleCount; ++i) colors[i] = rainbow.random(); }));
+    report("fromHsl / sample",
+        bestNanosecondsPerParticle([&]() { for (size_t i{}; i < smParticleCount; ++i) colors[i] = Color::fromHsl(ages[i] * 0.8f, 1.0f, 0.5f); }),
+        bestNanosecondsPerParticle([&]() { rainbow.sample(ages, std::span<Color>(colors, particles.size())); }));
+
+    // Écart entre la table et le calcul exact.
+    float largestError{};
+    for (size_t i{}; i < smParticleCount; ++i) {
+        Color const exact{ Color::fromHsl(ages[i] * 0.8f, 1.0f, 0.5f) };
+        Color const table{ rainbow.at(ages[i]) };
+        largestError = std::max({ largestError, std::abs(exact.red() - table.red()), std::abs(exact.green() - table.green()), std::abs(exact.blue() - table.blue()) });
+    }
+    std::printf("\necart maximal (table de %zu couleurs) : %.4f\n", rainbow.size(), largestError);
+
+    return 0;
+}
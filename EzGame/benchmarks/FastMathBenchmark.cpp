@@ -0,0 +1,129 @@
+// Banc d'essai : précision et débit des approximations de FastMath.
+//
+// Pour chaque opération de Vect2d ayant une variante rapide (normalize, 
+// orientation, fromPolar) ainsi que pour le calcul par lot de 
+// sincos, affiche :
+//  - l'erreur maximale par rapport à la fonction standard (calculée en 
+//    double précision);
+//  - le temps par élément de la fonction standard et de la variante 
+//    rapide sur 1M d'éléments.
+//
+// Compilation (Linux) :
+//   g++ -std=c++20 -O2 -IEzGame/include EzGame/benchmarks/FastMathBenchmark.cpp EzGame/src/*.cpp <EzGame>
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    size_t const smElementCount{ 1'000'000 };
+    size_t const smRepetitionCount{ 10 };
+    float const smAngleRange{ 1000.0f };
+
+    template <typename Function>
+    double bestNanosecondsPerElement(Function function)
+    {
+        double best{ std::numeric_limits<double>::max() };
+        for (size_t repetition{}; repetition < smRepetitionCount; ++repetition) {
+            Clock::time_point const start{ Clock::now() };
+            function();
+            double const elapsed{ std::chrono::duration<double, std::nano>(Clock::now() - start).count() };
+            best = std::min(best, elapsed / static_cast<double>(smElementCount));
+        }
+        return best;
+    }
+
+    void report(char const * name, char const * errorKind, double error, double standard, double fast)
+    {
+        std::printf("%-22s %-9s %10.3g   %8.3f ns %8.3f ns   x%.2f\n", name, errorKind, error, standard, fast, fast > 0.0 ? standard / fast : 0.0);
+    }
+
+    double angleError(double a, double b)
+    {
+        double const difference{ std::abs(a - b) };
+        return std::min(difference, 2.0 * std::numbers::pi - difference);
+    }
+
+} // namespace
+
+
+int main()
+{
+    std::vector<ezgame::Vect2d> vectors(smElementCount);
+    std::vector<float> angles(smElementCount);
+    std::vector<float> lengths(smElementCount);
+    for (size_t i{}; i < smElementCount; ++i) {
+        vectors[i].randomize(-1000.0f, 1000.0f, -1000.0f, 1000.0f);
+        angles[i] = ezgame::Random::real(-smAngleRange, smAngleRange);
+        lengths[i] = ezgame::Random::real(0.0f, 100.0f);
+    }
+    std::vector<float> results(smElementCount);
+    std::vector<float> sines(smElementCount);
+    std::vector<float> cosines(smElementCount);
+    std::vector<ezgame::Vect2d> vectorResults(smElementCount);
+
+    std::printf("%-22s %-9s %10s   %11s %11s\n", "operation", "erreur", "maximum", "standard", "rapide");
+
+    // Normalisation : écart à la longueur unitaire.
+    double normalizeError{};
+    for (ezgame::Vect2d const& vector : vectors) {
+        ezgame::Vect2d const normalized{ vector.normalizedFast() };
+        double const length{ std::hypot(static_cast<double>(normalized.x()), static_cast<double>(normalized.y())) };
+        normalizeError = std::max(normalizeError, std::abs(length - 1.0));
+    }
+    report("normalize", "longueur", normalizeError,
+        bestNanosecondsPerElement([&]() { for (size_t i{}; i < smElementCount; ++i) vectorResults[i] = vectors[i].normalized(); }),
+        bestNanosecondsPerElement([&]() { for (size_t i{}; i < smElementCount; ++i) vectorResults[i] = vectors[i].normalizedFast(); }));
+
+    // Orientation : erreur absolue en radians.
+    double orientationError{};
+    for (ezgame::Vect2d const& vector : vectors) {
+        double const exact{ std::atan2(static_cast<double>(vector.y()), static_cast<double>(vector.x())) };
+        orientationError = std::max(orientationError, angleError(vector.orientationFast(), exact));
+    }
+    report("orientation", "radian", orientationError,
+        bestNanosecondsPerElement([&]() { for (size_t i{}; i < smElementCount; ++i) results[i] = vectors[i].orientation(); }),
+        bestNanosecondsPerElement([&]() { for (size_t i{}; i < smElementCount; ++i) results[i] = vectors[i].orientationFast(); }));
+
+    // Coordonnées polaires : erreur absolue relative à la longueur.
+    double polarError{};
+    for (size_t i{}; i < smElementCount; ++i) {
+        ezgame::Vect2d const vector{ ezgame::Vect2d::fromNormalizedFast(angles[i]) };
+        double const angle{ static_cast<double>(angles[i]) };
+        polarError = std::max({ polarError, std::abs(vector.x() - std::cos(angle)), std::abs(vector.y() - std::sin(angle)) });
+    }
+    report("fromPolar", "absolue", polarError,
+        bestNanosecondsPerElement([&]() { for (size_t i{}; i < smElementCount; ++i) vectorResults[i] = ezgame::Vect2d::fromPolar(lengths[i], angles[i]); }),
+        bestNanosecondsPerElement([&]() { for (size_t i{}; i < smElementCount; ++i) vectorResults[i] = ezgame::Vect2d::fromPolarFast(lengths[i], angles[i]); }));
+
+    // Sinus et cosinus par lot.
+    ezgame::FastMath::sincos(angles, sines, cosines);
+    double sincosError{};
+    for (size_t i{}; i < smElementCount; ++i) {
+        double const angle{ static_cast<double>(angles[i]) };
+        sincosError = std::max({ sincosError, std::abs(sines[i] - std::sin(angle)), std::abs(cosines[i] - std::cos(angle)) });
+    }
+    report("sincos (lot)", "absolue", sincosError,
+        bestNanosecondsPerElement([&]() { for (size_t i{}; i < smElementCount; ++i) { sines[i] = std::sin(angles[i]); cosines[i] = std::cos(angles[i]); } }),
+        bestNanosecondsPerElement([&]() { ezgame::FastMath::sincos(angles, sines, cosines); }));
+
+    // Empêche l'élimination des calculs.
+    float checksum{};
+    for (size_t i{}; i < smElementCount; i += 997) {
+        checksum += results[i] + sines[i] + cosines[i] + vectorResults[i].x();
+    }
+    std::printf("(somme de contrôle : %g)\n", checksum);
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+// Banc d'essai : coût par image de la surcouche de performance
+// (Application::setOverlayVisible).
+//
+// Un moteur de jeu dessine 500 cercles et un texte par image. La boucle
+// complète est exécutée surcouche cachée, puis affichée; la différence du
+// temps moyen par image est le coût de la surcouche (mise à jour,
+// enregistrement des commandes et, avec le rendu logiciel, dessin). Le
+// rapport de l'application donne aussi le coût de la seule mise à jour et
+// de l'enregistrement.
+//
+// Avec EZGAME_COUNT_ALLOCATIONS, le nombre d'allocations par image avec la
+// surcouche affichée est aussi mesuré (il doit être nul) : la différence
+// entre une exécution de 2N images et une de N images écarte les
+// allocations du démarrage.
+//
+// Compilation (Linux) :
+//   g++ -std=c++20 -O2 -pthread -DEZGAME_COUNT_ALLOCATIONS -IEzGame/include EzGame/benchmarks/PerformanceOverlayBenchmark.cpp EzGame/src/*.cpp <EzGame>
+//
+// Exécution depuis la racine du dépôt (police EzGame/resources/arial.ttf).
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <string>
+
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    size_t const smFrameCount{ 3'000 };
+    size_t const smRepetitionCount{ 5 };
+    size_t const smCircleCount{ 500 };
+    double const smMaximumCost{ 100.0 };
+
+    class CirclesEngine
+    {
+    public:
+        CirclesEngine()
+            : mCircles(smCircleCount)
+            , mText("Proies : 500", 20.0f, ezgame::Vect2d(400.0f, 20.0f), ezgame::Color::White, ezgame::Alignment::TopCenter)
+        {
+            for (size_t i{}; i < smCircleCount; ++i) {
+                mCircles.add(5.0f, ezgame::Vect2d(static_cast<float>(i * 37 % 800), static_cast<float>(i * 91 % 600)), ezgame::Color::Blue);
+            }
+        }
+
+        float width() const { return 800.0f; }
+        float height() const { return 600.0f; }
+        std::string title() const { return "Banc d'essai"; }
+        std::string iconFileName() const { return ""; }
+
+        bool provessEvents(ezgame::Keyboard const&, ezgame::Timer const&)
+        {
+            mCircles.moveAll(ezgame::Vect2d(0.01f, 0.0f));
+            return true;
+        }
+
+        void processDisplay(ezgame::Screen & screen)
+        {
+            screen.clear();
+            screen.draw(mCircles);
+            screen.draw(mText);
+        }
+
+    private:
+        ezgame::CircleBatch mCircles;
+        ezgame::Text mText;
+    };
+
+    // Retourne le nombre d'allocations d'une exécution complète.
+    size_t run(size_t frameCount, bool rasterized, bool overlayVisible)
+    {
+        ezgame::Application application;
+        application.setFrameLimit(frameCount);
+        application.setRasterized(rasterized);
+        application.setOverlayVisible(overlayVisible);
+
+        size_t const allocations{ ezgame::AllocationCounter::count() };
+        application.run<CirclesEngine>();
+        return ezgame::AllocationCounter::count() - allocations;
+    }
+
+    // Meilleur temps moyen par image, en microseconde.
+    double measure(bool rasterized, bool overlayVisible)
+    {
+        double best{ std::numeric_limits<double>::max() };
+        for (size_t repetition{}; repetition < smRepetitionCount; ++repetition) {
+            Clock::time_point const start{ Clock::now() };
+            run(smFrameCount, rasterized, overlayVisible);
+            best = std::min(best, std::chrono::duration<double, std::micro>(Clock::now() - start).count() / static_cast<double>(smFrameCount));
+        }
+        return best;
+    }
+
+    double allocationsPerFrame(bool overlayVisible)
+    {
+        size_t const shortRun{ run(smFrameCount, false, overlayVisible) };
+        size_t const longRun{ run(2 * smFrameCount, false, overlayVisible) };
+        return (static_cast<double>(longRun) - static_cast<double>(shortRun)) / static_cast<double>(smFrameCount);
+    }
+
+} // namespace
+
+
+int main()
+{
+    // Réchauffement (pages, caches, police).
+    run(smFrameCount, true, true);
+
+    double const hidden{ measure(false, false) };
+    double const visible{ measure(false, true) };
+    double const rasterizedHidden{ measure(true, false) };
+    double const rasterizedVisible{ measure(true, true) };
+
+    double const cost{ visible - hidden };
+    std::printf("%zu images, %zu cercles par image\n", smFrameCount, smCircleCount);
+    std::printf("sans rendu     : cachee %8.2f us/image, affichee %8.2f us/image (surcouche : %.2f us)\n", hidden, visible, cost);
+    std::printf("rendu logiciel : cachee %8.2f us/image, affichee %8.2f us/image (surcouche : %.2f us)\n",
+        rasterizedHidden, rasterizedVisible, rasterizedVisible - rasterizedHidden);
+    if (ezgame::AllocationCounter::isEnabled()) {
+        std::printf("allocations par image : cachee %.3f, affichee %.3f\n", allocationsPerFrame(false), allocationsPerFrame(true));
+    }
+    std::printf("cout inferieur a %.0f us : %s\n", smMaximumCost, cost < smMaximumCost ? "oui" : "non");
+    return cost < smMaximumCost ? 0 : 1;
+}
@@ -0,0 +1,135 @@
+// Banc d'essai : coût d'une zone du profileur (EZ_PROFILE_SCOPE) et
+// exportation d'une trace.
+//
+// Mesure une boucle dont le corps fait un petit calcul, sans zone puis
+// avec une zone par itération : la différence est le coût d'une zone.
+// Quatre fils écrivent ensuite leurs zones en parallèle pendant que
+// 300 images sont marquées, puis la trace est écrite dans
+// ProfilerBenchmark.json (à ouvrir dans chrome://tracing ou Perfetto).
+//
+// Compilation (Linux) :
+//   g++ -std=c++20 -O2 -pthread -IEzGame/include EzGame/benchmarks/ProfilerBenchmark.cpp EzGame/src/*.cpp <EzGame>
+//
+// Ajouter -DEZGAME_NO_PROFILER pour vérifier que les zones ne coûtent
+// alors plus rien.
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    size_t const smIterationCount{ 1'000'000 };
+    size_t const smRepetitionCount{ 5 };
+    size_t const smThreadCount{ 4 };
+    size_t const smFrameCount{ 300 };
+
+    // Empêche le compilateur de retirer le calcul mesuré.
+    std::atomic<uint64_t> sink{};
+
+    uint64_t work(uint64_t value)
+    {
+        return value * 6364136223846793005ull + 1442695040888963407ull;
+    }
+
+    // Meilleur temps par itération, en nanosecondes.
+    template <typename Function>
+    double bestNanoseconds(Function function)
+    {
+        double best{ std::numeric_limits<double>::max() };
+        for (size_t repetition{}; repetition < smRepetitionCount; ++repetition) {
+            Clock::time_point const start{ Clock::now() };
+            function();
+            best = std::min(best, std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(smIterationCount));
+        }
+        return best;
+    }
+
+} // namespace
+
+
+int main()
+{
+    using namespace ezgame;
+
+    double const bare{ bestNanoseconds([]() {
+        uint64_t value{};
+        for (size_t i{}; i < smIterationCount; ++i) {
+            value = work(value);
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        }
+        sink.store(value, std::memory_order_relaxed);
+    }) };
+
+    double const profiled{ bestNanoseconds([]() {
+        uint64_t value{};
+        for (size_t i{}; i < smIterationCount; ++i) {
+            EZ_PROFILE_SCOPE("work");
+            value = work(value);
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        }
+        sink.store(value, std::memory_order_relaxed);
+    }) };
+
+    // Trace de plusieurs fils.
+    Profiler::setThreadName("fil principal");
+    std::atomic<bool> stopping{};
+    std::vector<std::thread> threads;
+    for (size_t thread{}; thread < smThreadCount; ++thread) {
+        threads.emplace_back([thread, &stopping]() {
+            Profiler::setThreadName("travailleur " + std::to_string(thread + 1));
+            uint64_t value{ thread };
+            while (!stopping.load(std::memory_order_relaxed)) {
+                EZ_PROFILE_SCOPE("travailleur");
+                for (size_t i{}; i < 10'000; ++i) {
+                    value = work(value);
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+            sink.fetch_add(value, std::memory_order_relaxed);
+        });
+    }
+    for (size_t frame{}; frame < smFrameCount; ++frame) {
+        Profiler::markFrame();
+        EZ_PROFILE_SCOPE("image");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    stopping.store(true, std::memory_order_relaxed);
+    for (std::thread & thread : threads) {
+        thread.join();
+    }
+
+    Clock::time_point const saveStart{ Clock::now() };
+    bool const saved{ Profiler::save("ProfilerBenchmark.json", smFrameCount) };
+    double const saveMilliseconds{ std::chrono::duration<double, std::milli>(Clock::now() - saveStart).count() };
+
+#if defined(EZGAME_PROFILER)
+    std::printf("profileur actif (%s)\n",
+#if defined(EZGAME_PROFILER_RDTSC)
+        "rdtsc"
+#else
+        "steady_clock"
+#endif
+    );
+#else
+    std::printf("profileur retire (EZGAME_NO_PROFILER)\n");
+#endif
+    std::printf("sans zone : %6.2f ns/iteration\n", bare);
+    std::printf("avec zone : %6.2f ns/iteration (%.2f ns par zone)\n", profiled, profiled - bare);
+    std::printf("trace de %zu images et %zu fils %s ProfilerBenchmark.json en %.1f ms\n",
+        smFrameCount, smThreadCount + 1, saved ? "ecrite dans" : "non ecrite dans", saveMilliseconds);
+    return saved ? 0 : 1;
+}
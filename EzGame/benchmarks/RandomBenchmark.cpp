@@ -0,0 +1,92 @@
+// Banc d'essai : coût par valeur générée par Random.
+//
+// Compare le générateur historique (std::default_random_engine global 
+// avec les distributions standards) et le générateur actuel de Random 
+// (xoshiro256** ou PCG32 propre au fil d'exécution) :
+//  - un réel et un entier par appel;
+//  - le remplissage d'un tableau complet (Random::fill).
+//
+// Vérifie aussi qu'une même graine reproduit la même séquence.
+//
+// Compilation (Linux) :
+//   g++ -std=c++20 -O2 -IEzGame/include EzGame/benchmarks/RandomBenchmark.cpp EzGame/src/*.cpp <EzGame>
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    size_t const smValueCount{ 1'000'000 };
+    size_t const smRepetitionCount{ 10 };
+
+    // Générateur historique de Random.
+    std::default_random_engine smLegacyEngine;
+
+    template <typename Function>
+    double bestNanosecondsPerValue(Function function)
+    {
+        double best{ std::numeric_limits<double>::max() };
+        for (size_t repetition{}; repetition < smRepetitionCount; ++repetition) {
+            Clock::time_point const start{ Clock::now() };
+            function();
+            double const elapsed{ std::chrono::duration<double, std::nano>(Clock::now() - start).count() };
+            best = std::min(best, elapsed / static_cast<double>(smValueCount));
+        }
+        return best;
+    }
+
+    void report(char const * name, double legacy, double current)
+    {
+        std::printf("%-28s %8.3f ns %8.3f ns   x%.2f\n", name, legacy, current, current > 0.0 ? legacy / current : 0.0);
+    }
+
+} // namespace
+
+
+int main()
+{
+    std::vector<float> reals(smValueCount);
+    std::vector<int> integers(smValueCount);
+
+    std::printf("%-28s %11s %11s\n", "valeur", "historique", "actuel");
+
+    report("real(-1.0f, 1.0f)",
+        bestNanosecondsPerValue([&]() { for (float & value : reals) value = std::uniform_real_distribution<float>(-1.0f, 1.0f)(smLegacyEngine); }),
+        bestNanosecondsPerValue([&]() { for (float & value : reals) value = ezgame::Random::real(-1.0f, 1.0f); }));
+    report("integer(0, 99)",
+        bestNanosecondsPerValue([&]() { for (int & value : integers) value = std::uniform_int_distribution<int>(0, 99)(smLegacyEngine); }),
+        bestNanosecondsPerValue([&]() { for (int & value : integers) value = ezgame::Random::integer(0, 99); }));
+    report("fill(span<float>, -1, 1)",
+        bestNanosecondsPerValue([&]() { std::uniform_real_distribution<float> distribution(-1.0f, 1.0f); for (float & value : reals) value = distribution(smLegacyEngine); }),
+        bestNanosecondsPerValue([&]() { ezgame::Random::fill(reals, -1.0f, 1.0f); }));
+    report("fill(span<int>, 0, 99)",
+        bestNanosecondsPerValue([&]() { std::uniform_int_distribution<int> distribution(0, 99); for (int & value : integers) value = distribution(smLegacyEngine); }),
+        bestNanosecondsPerValue([&]() { ezgame::Random::fill(integers, 0, 99); }));
+
+    // Reproductibilité.
+    ezgame::Random::seed(2024);
+    ezgame::Vect2d const first{ ezgame::Vect2d::fromRandomized() };
+    ezgame::Random::seed(2024);
+    ezgame::Vect2d const second{ ezgame::Vect2d::fromRandomized() };
+    std::printf("graine 2024 : %s %s\n", first.toString().c_str(), first.x() == second.x() && first.y() == second.y() ? "reproduite" : "NON reproduite");
+
+    // Empêche l'élimination des calculs.
+    float checksum{};
+    for (size_t i{}; i < smValueCount; i += 997) {
+        checksum += reals[i] + static_cast<float>(integers[i]);
+    }
+    std::printf("(somme de contrôle : %g)\n", checksum);
+
+    return 0;
+}
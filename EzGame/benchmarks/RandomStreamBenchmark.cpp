@@ -0,0 +1,126 @@
+// Banc d'essai : reproductibilité et coût de RandomStream.
+//
+// Génère une vague de 10k entités (position, vitesse, type) à partir de 
+// suites RandomStream (graine, entité, tic) avec 1, 2, 4 et 8 fils 
+// d'exécution. Les entités sont réparties en alternance entre les fils 
+// afin que l'ordre de traitement diffère d'une exécution à l'autre. 
+// L'empreinte binaire de la vague doit être identique dans tous les cas.
+//
+// Affiche aussi le coût par valeur de RandomStream::real comparé à 
+// Random::real.
+//
+// Compilation (Linux) :
+//   g++ -std=c++20 -O2 -pthread -IEzGame/include EzGame/benchmarks/RandomStreamBenchmark.cpp EzGame/src/*.cpp <EzGame>
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <thread>
+#include <vector>
+
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    size_t const smEntityCount{ 10'000 };
+    uint64_t const smWaveSeed{ 0x5eed0f3a7e00ull };
+    uint32_t const smWaveTick{ 600 };
+    size_t const smValueCount{ 1'000'000 };
+    size_t const smRepetitionCount{ 10 };
+
+    enum class Kind { Scout, Fighter, Bomber, __count__ };
+
+    struct Entity
+    {
+        float x;
+        float y;
+        float speed;
+        Kind kind;
+    };
+
+    void spawn(std::vector<Entity> & wave, size_t first, size_t stride)
+    {
+        for (size_t index{ first }; index < wave.size(); index += stride) {
+            ezgame::RandomStream random(smWaveSeed, index, smWaveTick);
+            wave[index] = Entity{ random.real(0.0f, 800.0f), random.real(0.0f, 600.0f), random.real(1.0f, 5.0f), random.enumerator<Kind>() };
+        }
+    }
+
+    // Empreinte FNV-1a des bits de toutes les entités.
+    uint64_t fingerprint(std::vector<Entity> const& wave)
+    {
+        uint64_t hash{ 0xcbf29ce484222325ull };
+        auto mix = [&hash](uint32_t value) {
+            hash = (hash ^ value) * 0x100000001b3ull;
+        };
+        for (Entity const& entity : wave) {
+            mix(std::bit_cast<uint32_t>(entity.x));
+            mix(std::bit_cast<uint32_t>(entity.y));
+            mix(std::bit_cast<uint32_t>(entity.speed));
+            mix(static_cast<uint32_t>(entity.kind));
+        }
+        return hash;
+    }
+
+    template <typename Function>
+    double bestNanosecondsPerValue(Function function)
+    {
+        double best{ std::numeric_limits<double>::max() };
+        for (size_t repetition{}; repetition < smRepetitionCount; ++repetition) {
+            Clock::time_point const start{ Clock::now() };
+            function();
+            double const elapsed{ std::chrono::duration<double, std::nano>(Clock::now() - start).count() };
+            best = std::min(best, elapsed / static_cast<double>(smValueCount));
+        }
+        return best;
+    }
+
+} // namespace
+
+
+int main()
+{
+    uint64_t reference{};
+    bool identical{ true };
+    for (size_t threadCount : { 1, 2, 4, 8 }) {
+        std::vector<Entity> wave(smEntityCount);
+        std::vector<std::thread> threads;
+        for (size_t thread{}; thread < threadCount; ++thread) {
+            threads.emplace_back(spawn, std::ref(wave), thread, threadCount);
+        }
+        for (std::thread & thread : threads) {
+            thread.join();
+        }
+
+        uint64_t const hash{ fingerprint(wave) };
+        reference = threadCount == 1 ? hash : reference;
+        identical = identical && hash == reference;
+        std::printf("%zu fil(s) : empreinte %016llx\n", threadCount, static_cast<unsigned long long>(hash));
+    }
+    std::printf("vague de %zu entités %s\n", smEntityCount, identical ? "identique pour tous les nombres de fils" : "DIFFÉRENTE selon le nombre de fils");
+
+    std::vector<float> values(smValueCount);
+    double const shared{ bestNanosecondsPerValue([&]() {
+        for (float & value : values) value = ezgame::Random::real(0.0f, 1.0f);
+    }) };
+    double const stream{ bestNanosecondsPerValue([&]() {
+        ezgame::RandomStream random(smWaveSeed, 0, smWaveTick);
+        for (float & value : values) value = random.real(0.0f, 1.0f);
+    }) };
+    double const perEntity{ bestNanosecondsPerValue([&]() {
+        for (size_t i{}; i < smValueCount; ++i) values[i] = ezgame::RandomStream(smWaveSeed, i, smWaveTick).real(0.0f, 1.0f);
+    }) };
+    std::printf("Random::real                         : %8.3f ns/valeur\n", shared);
+    std::printf("RandomStream::real (une suite)       : %8.3f ns/valeur\n", stream);
+    std::printf("RandomStream::real (suite par valeur): %8.3f ns/valeur\n", perEntity);
+
+    return identical ? 0 : 1;
+}
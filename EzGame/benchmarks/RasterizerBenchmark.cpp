@@ -0,0 +1,140 @@
+// Banc d'essai : temps de rendu logiciel d'une image de 800 x 600 pixels
+// (la taille du GameEngine) contenant 10 000 cercles.
+//
+// Les cercles ont un rayon de 2 à 20 pixels; un sur deux a un contour et
+// un sur trois est transparent. Compare :
+//  - un rendu naïf : chaque pixel de la boîte englobante de chaque cercle
+//    est testé puis mélangé individuellement;
+//  - Rasterizer avec un seul fil d'exécution (segments SIMD);
+//  - Rasterizer avec un fil par cœur (tuiles en parallèle).
+//
+// Compilation (Linux) :
+//   g++ -std=c++20 -O2 -pthread -IEzGame/include EzGame/benchmarks/RasterizerBenchmark.cpp EzGame/src/*.cpp <EzGame>
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    size_t const smWidth{ 800 };
+    size_t const smHeight{ 600 };
+    size_t const smCircleCount{ 10'000 };
+    size_t const smRepetitionCount{ 20 };
+
+    template <typename Function>
+    double bestMillisecondsPerFrame(Function function)
+    {
+        double best{ std::numeric_limits<double>::max() };
+        for (size_t repetition{}; repetition < smRepetitionCount; ++repetition) {
+            Clock::time_point const start{ Clock::now() };
+            function();
+            best = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+        }
+        return best;
+    }
+
+    ezgame::ColorRGBA8 blendNaive(ezgame::ColorRGBA8 destination, ezgame::ColorRGBA8 source)
+    {
+        float const alpha{ source.alpha() / 255.0f };
+        auto mix = [alpha](uint8_t d, uint8_t s) { return static_cast<uint8_t>(d * (1.0f - alpha) + s * alpha + 0.5f); };
+        return ezgame::ColorRGBA8(mix(destination.red(), source.red()), mix(destination.green(), source.green()), mix(destination.blue(), source.blue()), mix(destination.alpha(), 255));
+    }
+
+    // Rendu de référence, pixel par pixel.
+    void renderNaive(ezgame::Framebuffer & target, ezgame::ColorRGBA8 clearColor, ezgame::Rasterizer::Circles const& circles)
+    {
+        target.fill(clearColor);
+        int const width{ static_cast<int>(target.width()) };
+        int const height{ static_cast<int>(target.height()) };
+        for (size_t i{}; i < circles.xs.size(); ++i) {
+            float const radius{ circles.radii[i] };
+            float const outer{ radius + circles.edgeSizes[i] };
+            int const left{ std::max(static_cast<int>(circles.xs[i] - outer), 0) };
+            int const top{ std::max(static_cast<int>(circles.ys[i] - outer), 0) };
+            int const right{ std::min(static_cast<int>(circles.xs[i] + outer) + 1, width) };
+            int const bottom{ std::min(static_cast<int>(circles.ys[i] + outer) + 1, height) };
+            for (int y{ top }; y < bottom; ++y) {
+                for (int x{ left }; x < right; ++x) {
+                    float const dx{ x + 0.5f - circles.xs[i] };
+                    float const dy{ y + 0.5f - circles.ys[i] };
+                    float const distance2{ dx * dx + dy * dy };
+                    if (distance2 <= outer * outer) {
+                        ezgame::ColorRGBA8 & pixel{ target.row(static_cast<size_t>(y))[x] };
+                        pixel = blendNaive(pixel, distance2 <= radius * radius ? circles.fillColors[i] : circles.edgeColors[i]);
+                    }
+                }
+            }
+        }
+    }
+
+} // namespace
+
+
+int main()
+{
+    using namespace ezgame;
+
+    RandomStream stream(434, 0);
+    std::vector<float> xs(smCircleCount);
+    std::vector<float> ys(smCircleCount);
+    std::vector<float> radii(smCircleCount);
+    std::vector<float> edgeSizes(smCircleCount);
+    std::vector<ColorRGBA8> fillColors(smCircleCount);
+    std::vector<ColorRGBA8> edgeColors(smCircleCount);
+    double coveredPixels{};
+    for (size_t i{}; i < smCircleCount; ++i) {
+        xs[i] = stream.real(0.0f, static_cast<float>(smWidth));
+        ys[i] = stream.real(0.0f, static_cast<float>(smHeight));
+        radii[i] = stream.real(2.0f, 20.0f);
+        edgeSizes[i] = i % 2 == 0 ? stream.real(1.0f, 3.0f) : 0.0f;
+        uint8_t const alpha{ static_cast<uint8_t>(i % 3 == 0 ? 128 : 255) };
+        fillColors[i] = ColorRGBA8(static_cast<uint8_t>(stream.integer(0, 255)), static_cast<uint8_t>(stream.integer(0, 255)), static_cast<uint8_t>(stream.integer(0, 255)), alpha);
+        edgeColors[i] = ColorRGBA8(255, 255, 255, alpha);
+        float const outer{ radii[i] + edgeSizes[i] };
+        coveredPixels += 3.14159265 * outer * outer;
+    }
+    Rasterizer::Circles const circles{ xs, ys, radii, edgeSizes, fillColors, edgeColors };
+    ColorRGBA8 const background(0, 0, 0, 255);
+
+    Framebuffer naive(smWidth, smHeight);
+    Framebuffer single(smWidth, smHeight);
+    Framebuffer parallel(smWidth, smHeight);
+    Rasterizer singleThreaded(1);
+    Rasterizer multiThreaded;
+
+    double const naiveTime{ bestMillisecondsPerFrame([&]() { renderNaive(naive, background, circles); }) };
+    double const singleTime{ bestMillisecondsPerFrame([&]() { singleThreaded.render(single, background, circles); }) };
+    double const parallelTime{ bestMillisecondsPerFrame([&]() { multiThreaded.render(parallel, background, circles); }) };
+
+    // Pixels différents du rendu naïf : le mélange en réels peut différer
+    // d'une unité, et un pixel du bord peut être attribué différemment
+    // selon l'arrondi.
+    size_t differentPixels{};
+    for (size_t i{}; i < naive.pixels().size(); ++i) {
+        ColorRGBA8 const a{ naive.pixels()[i] };
+        ColorRGBA8 const b{ single.pixels()[i] };
+        int const difference{ std::max({ std::abs(a.red() - b.red()), std::abs(a.green() - b.green()), std::abs(a.blue() - b.blue()) }) };
+        differentPixels += difference > 1 ? 1 : 0;
+    }
+    bool const identical{ std::equal(single.pixels().begin(), single.pixels().end(), parallel.pixels().begin()) };
+
+    std::printf("%zu cercles, %zu x %zu, %.1f Mpixels couverts par image\n", smCircleCount, smWidth, smHeight, coveredPixels / 1.0e6);
+    std::printf("naif                 : %8.3f ms/image\n", naiveTime);
+    std::printf("Rasterizer ( 1 fil)  : %8.3f ms/image   x%.1f\n", singleTime, naiveTime / singleTime);
+    std::printf("Rasterizer (%2zu fils) : %8.3f ms/image   x%.1f\n", multiThreaded.threadCount(), parallelTime, naiveTime / parallelTime);
+    std::printf("pixels differents du rendu naif : %.3f %%, rendus multifils identiques : %s\n",
+        100.0 * static_cast<double>(differentPixels) / static_cast<double>(naive.pixels().size()), identical ? "oui" : "non");
+
+    return 0;
+}
@@ -0,0 +1,167 @@
+// Banc d'essai : coût du dessin logiciel d'un affichage tête haute de 12
+// textes (pointage, images par seconde, etc.) dans une image de 800 x 600
+// pixels, dont un seul change d'une image à l'autre.
+//
+// Compare :
+//  - sans atlas ni cache : chaque glyphe est dessiné par Font::rasterize
+//    à chaque image, puis copié;
+//  - atlas seulement : les glyphes sont conservés (GlyphAtlas), mais
+//    chaque texte est mis en page à chaque image (cache de capacité nulle);
+//  - atlas et cache : TextCache complet, les textes inchangés sont
+//    simplement copiés depuis l'atlas.
+//
+// Compilation (Linux) :
+//   g++ -std=c++20 -O2 -pthread -IEzGame/include EzGame/benchmarks/TextCacheBenchmark.cpp EzGame/src/*.cpp <EzGame>
+//
+// Exécution depuis la racine du dépôt (police EzGame/resources/arial.ttf).
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    char const * const smFontFile{ "EzGame/resources/arial.ttf" };
+    size_t const smWidth{ 800 };
+    size_t const smHeight{ 600 };
+    size_t const smFrameCount{ 200 };
+    size_t const smRepetitionCount{ 5 };
+
+    template <typename Function>
+    double bestMicrosecondsPerFrame(Function function)
+    {
+        double best{ std::numeric_limits<double>::max() };
+        for (size_t repetition{}; repetition < smRepetitionCount; ++repetition) {
+            Clock::time_point const start{ Clock::now() };
+            for (size_t frame{}; frame < smFrameCount; ++frame) {
+                function(frame);
+            }
+            best = std::min(best, std::chrono::duration<double, std::micro>(Clock::now() - start).count() / static_cast<double>(smFrameCount));
+        }
+        return best;
+    }
+
+    struct HudText
+    {
+        std::string text;
+        float size;
+        float x;
+        float y;
+    };
+
+    // Affichage tête haute de l'image donnée : seul le compteur d'images
+    // change.
+    std::vector<HudText> hud(size_t frame)
+    {
+        std::vector<HudText> texts{
+            { "Score : 123456", 24.0f, 10.0f, 30.0f },
+            { "Meilleur : 987654", 24.0f, 10.0f, 60.0f },
+            { "Vies : 3", 24.0f, 600.0f, 30.0f },
+            { "Niveau 12", 32.0f, 330.0f, 40.0f },
+            { "Proies : 1500", 16.0f, 10.0f, 560.0f },
+            { "Predateurs : 25", 16.0f, 10.0f, 580.0f },
+            { "Obstacles : 40", 16.0f, 200.0f, 560.0f },
+            { "Vitesse x1.0", 16.0f, 200.0f, 580.0f },
+            { "[Espace] pause", 16.0f, 620.0f, 560.0f },
+            { "[Echap] quitter", 16.0f, 620.0f, 580.0f },
+            { "EzGame - GPA434", 16.0f, 340.0f, 580.0f },
+            { "Image " + std::to_string(frame / 30), 16.0f, 700.0f, 30.0f } };
+        return texts;
+    }
+
+    void blit(ezgame::Framebuffer & target, ezgame::TextCache::Run const & run, int x, int y)
+    {
+        for (ezgame::TextCache::Quad const & quad : run.quads) {
+            for (int row{}; row < quad.height; ++row) {
+                ezgame::Rasterizer::blendMask(target.row(static_cast<size_t>(y + quad.y + row)) + x + quad.x,
+                    run.atlas->row(static_cast<size_t>(quad.atlasY + row)) + quad.atlasX, quad.width, ezgame::ColorRGBA8(255, 255, 255));
+            }
+        }
+    }
+
+} // namespace
+
+
+int main()
+{
+    using namespace ezgame;
+
+    Font font;
+    if (!font.load(smFontFile)) {
+        std::printf("police introuvable : %s\n", smFontFile);
+        return 1;
+    }
+
+    std::vector<std::vector<HudText>> frames;
+    for (size_t frame{}; frame < smFrameCount; ++frame) {
+        frames.push_back(hud(frame));
+    }
+
+    Framebuffer target(smWidth, smHeight);
+    Font::Bitmap bitmap;
+    double const uncachedTime{ bestMicrosecondsPerFrame([&](size_t frame) {
+        for (HudText const & text : frames[frame]) {
+            float penX{ text.x };
+            for (char character : text.text) {
+                uint32_t const glyph{ font.glyphIndex(static_cast<unsigned char>(character)) };
+                font.rasterize(glyph, text.size, bitmap);
+                int const x{ static_cast<int>(penX) + bitmap.left };
+                int const y{ static_cast<int>(text.y) + bitmap.top };
+                for (size_t row{}; row < bitmap.height; ++row) {
+                    Rasterizer::blendMask(target.row(static_cast<size_t>(y) + row) + x, bitmap.coverage.data() + row * bitmap.width, bitmap.width, ColorRGBA8(255, 255, 255));
+                }
+                penX += font.advance(glyph, text.size);
+            }
+        }
+    }) };
+
+    TextCache layoutOnly(0);
+    layoutOnly.load(smFontFile);
+    double const atlasTime{ bestMicrosecondsPerFrame([&](size_t frame) {
+        layoutOnly.trim();
+        for (HudText const & text : frames[frame]) {
+            blit(target, layoutOnly.run(text.text, text.size, Alignment::BaseLeft), static_cast<int>(text.x), static_cast<int>(text.y));
+        }
+    }) };
+
+    TextCache cache;
+    cache.load(smFontFile);
+    double const cachedTime{ bestMicrosecondsPerFrame([&](size_t frame) {
+        cache.trim();
+        for (HudText const & text : frames[frame]) {
+            blit(target, cache.run(text.text, text.size, Alignment::BaseLeft), static_cast<int>(text.x), static_cast<int>(text.y));
+        }
+    }) };
+
+    // Part de la copie seule, sans recherche dans le cache.
+    std::vector<TextCache::Run const *> runs;
+    for (HudText const & text : frames[0]) {
+        runs.push_back(&cache.run(text.text, text.size, Alignment::BaseLeft));
+    }
+    double const blitTime{ bestMicrosecondsPerFrame([&](size_t) {
+        for (size_t i{}; i < runs.size(); ++i) {
+            blit(target, *runs[i], static_cast<int>(frames[0][i].x), static_cast<int>(frames[0][i].y));
+        }
+    }) };
+
+    double const lookups{ static_cast<double>(cache.hitCount() + cache.missCount()) };
+    std::printf("%zu textes par image, %zu images\n", frames[0].size(), smFrameCount);
+    std::printf("sans atlas ni cache : %9.2f us/image\n", uncachedTime);
+    std::printf("atlas seulement     : %9.2f us/image   x%.1f\n", atlasTime, uncachedTime / atlasTime);
+    std::printf("atlas et cache      : %9.2f us/image   x%.1f\n", cachedTime, uncachedTime / cachedTime);
+    std::printf("copie seule         : %9.2f us/image\n", blitTime);
+    std::printf("cache : %zu succes, %zu echecs (%.1f %% de succes), %zu glyphes dans %zu atlas\n",
+        cache.hitCount(), cache.missCount(), lookups > 0.0 ? 100.0 * static_cast<double>(cache.hitCount()) / lookups : 0.0, cache.glyphCount(), cache.atlasCount());
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+// Banc d'essai : allocations et coût des mises à jour numériques d'un
+// affichage tête haute (Text::setText), image après image.
+//
+// Chaque image, quatre textes sont mis à jour (pointage entier, vies,
+// temps réel avec 3 décimales et une étiquette de 23 caractères), puis
+// enregistrés comme le fait Screen::draw (copie dans une DrawList).
+// Les allocations sont comptées (AllocationCounter) après une période de
+// réchauffement.
+//
+// Compare Text à un texte rangé dans une std::string (l'implémentation
+// précédente : std::to_string, puis copie de la chaîne pour le rendu).
+// Le chemin complet du rendu logiciel (recherche dans un TextCache) est
+// aussi mesuré : le temps changeant à chaque image, sa mise en page n'est
+// jamais dans le cache et alloue.
+//
+// Compilation (Linux) :
+//   g++ -std=c++20 -O2 -pthread -DEZGAME_COUNT_ALLOCATIONS -IEzGame/include EzGame/benchmarks/TextUpdateBenchmark.cpp EzGame/src/*.cpp <EzGame>
+//
+// Exécution depuis la racine du dépôt (police EzGame/resources/arial.ttf).
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    size_t const smWarmUpFrameCount{ 1'000 };
+    size_t const smFrameCount{ 100'000 };
+    size_t const smRepetitionCount{ 5 };
+
+    // Texte de l'implémentation précédente.
+    struct StringText
+    {
+        std::string text;
+
+        void setText(size_t number) { text = std::to_string(number); }
+        void setText(int number) { text = std::to_string(number); }
+        void setText(float number) { text = std::to_string(number); }
+        void setText(std::string const & value) { text = value; }
+    };
+
+    struct Measure
+    {
+        double nanosecondsPerFrame;
+        double allocationsPerFrame;
+    };
+
+    // Meilleure de plusieurs mesures, après réchauffement (les tampons
+    // ont alors atteint leur taille finale).
+    template <typename Function>
+    Measure measure(Function function)
+    {
+        for (size_t frame{}; frame < smWarmUpFrameCount; ++frame) {
+            function(frame);
+        }
+
+        Measure best{ std::numeric_limits<double>::max(), 0.0 };
+        for (size_t repetition{}; repetition < smRepetitionCount; ++repetition) {
+            size_t const allocations{ ezgame::AllocationCounter::count() };
+            Clock::time_point const start{ Clock::now() };
+            for (size_t frame{}; frame < smFrameCount; ++frame) {
+                function(smWarmUpFrameCount + frame);
+            }
+            double const nanoseconds{ std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(smFrameCount) };
+            double const allocationsPerFrame{ static_cast<double>(ezgame::AllocationCounter::count() - allocations) / static_cast<double>(smFrameCount) };
+            if (nanoseconds < best.nanosecondsPerFrame) {
+                best = Measure{ nanoseconds, allocationsPerFrame };
+            }
+        }
+        return best;
+    }
+
+} // namespace
+
+
+int main()
+{
+    using namespace ezgame;
+
+    // Le pointage change une image sur dix, le temps à chaque image, les
+    // vies et l'étiquette jamais.
+    std::string const label{ "Proies restantes : 1500" };
+
+    DrawList list;
+    std::vector<std::string> strings(4);
+    StringText stringTexts[4];
+    Measure const stringMeasure{ measure([&](size_t frame) {
+        stringTexts[0].setText(frame / 10);
+        stringTexts[1].setText(3);
+        stringTexts[2].setText(static_cast<float>(frame) * 0.016f);
+        stringTexts[3].setText(label);
+        for (size_t i{}; i < 4; ++i) {
+            // Le rendu recevait une copie de la chaîne (Text::text).
+            strings[i] = std::string(stringTexts[i].text);
+        }
+    }) };
+
+    Text texts[4];
+    auto updateTexts = [&](size_t frame) {
+        texts[0].setText(frame / 10);
+        texts[1].setText(3);
+        texts[2].setText(static_cast<float>(frame) * 0.016f);
+        texts[3].setText(label);
+        list.clear();
+        for (Text const & text : texts) {
+            list.add(text);
+        }
+    };
+    Measure const textMeasure{ measure(updateTexts) };
+
+    TextCache cache;
+    if (!cache.load("EzGame/resources/arial.ttf")) {
+        std::printf("police introuvable : EzGame/resources/arial.ttf\n");
+        return 1;
+    }
+    Measure const renderMeasure{ measure([&](size_t frame) {
+        updateTexts(frame);
+        cache.trim();
+        for (Text const & text : list.texts()) {
+            cache.run(text.textView(), text.textSize(), text.alignment());
+        }
+    }) };
+
+    // Nombre qui ne change pas : seule la conversion et la comparaison
+    // sont faites.
+    Measure const unchangedMeasure{ measure([&](size_t) {
+        texts[0].setText(size_t{ 123'456 });
+    }) };
+    Measure const changedMeasure{ measure([&](size_t frame) {
+        texts[0].setText(frame);
+    }) };
+
+    std::printf("%zu images (apres %zu images de rechauffement)\n", smFrameCount, smWarmUpFrameCount);
+    std::printf("std::string           : %8.1f ns/image, %.3f allocation(s)/image\n", stringMeasure.nanosecondsPerFrame, stringMeasure.allocationsPerFrame);
+    std::printf("Text (tampon interne) : %8.1f ns/image, %.3f allocation(s)/image\n", textMeasure.nanosecondsPerFrame, textMeasure.allocationsPerFrame);
+    std::printf("setText(size_t) inchange : %.1f ns, modifie : %.1f ns\n", unchangedMeasure.nanosecondsPerFrame, changedMeasure.nanosecondsPerFrame);
+    std::printf("Text + TextCache      : %8.1f ns/image, %.3f allocation(s)/image (%zu succes, %zu echecs du cache)\n",
+        renderMeasure.nanosecondsPerFrame, renderMeasure.allocationsPerFrame, cache.hitCount(), cache.missCount());
+
+    bool const allocationFree{ textMeasure.allocationsPerFrame == 0.0 && unchangedMeasure.allocationsPerFrame == 0.0 && changedMeasure.allocationsPerFrame == 0.0 };
+    std::printf("aucune allocation par image : %s\n", allocationFree ? "oui" : "non");
+    return allocationFree ? 0 : 1;
+}
@@ -0,0 +1,151 @@
+// Banc d'essai : exactitude et coût des statistiques de Timer (centiles,
+// maximum, gigue et tics hors budget).
+//
+// Le moteur de jeu attend activement une durée pseudo-aléatoire à chaque
+// tic (surtout 50 à 400 us, parfois un à-coup de 2 à 20 ms) et garde les
+// temps écoulés reçus. À chaque tic, les statistiques de Timer sont
+// comparées aux valeurs exactes calculées sur la même fenêtre (tri
+// complet), et le coût de leur consultation est mesuré.
+//
+// Compilation (Linux) :
+//   g++ -std=c++20 -O2 -pthread -IEzGame/include EzGame/benchmarks/TimerStatisticsBenchmark.cpp EzGame/src/*.cpp <EzGame>
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    size_t const smFrameCount{ 6'000 };
+    size_t const smWindowSize{ 500 };
+    int64_t const smFrameBudget{ 1'000 };
+    double const smPercentiles[]{ 0.50, 0.90, 0.99, 0.999 };
+
+    // Vérifications, gardées hors du moteur (construit par Application::run).
+    class Checker
+    {
+    public:
+        bool tic(ezgame::Timer const& timer)
+        {
+            mTimes.push_back(timer.sinceLastTic());
+            check(timer);
+
+            // Durée du tic suivant.
+            mState = mState * 6364136223846793005ull + 1442695040888963407ull;
+            uint32_t const random{ static_cast<uint32_t>(mState >> 33) };
+            int64_t const wait{ random % 100 == 0 ? 2'000 + random % 18'000 : 50 + random % 350 };
+            Clock::time_point const end{ Clock::now() + std::chrono::microseconds(wait) };
+            while (Clock::now() < end) {
+            }
+            return true;
+        }
+
+        void report() const
+        {
+            std::printf("%zu tics verifies, fenetre de %zu tics, budget de %lld us\n", mCheckCount, smWindowSize, static_cast<long long>(smFrameBudget));
+            for (size_t i{}; i < std::size(smPercentiles); ++i) {
+                std::printf("centile %5.1f : erreur relative maximale %.2f %%\n", smPercentiles[i] * 100.0, mPercentileError[i] * 100.0);
+            }
+            std::printf("max inexact : %zu fois, hors budget inexact : %zu fois, ecart maximal de la gigue : %.4f us\n",
+                mMaxMismatchCount, mOverBudgetMismatchCount, mJitterError);
+            std::printf("consultation (4 centiles, max, gigue, hors budget) : %.0f ns par tic\n",
+                mCheckCount > 0 ? mQueryNanoseconds / static_cast<double>(mCheckCount) : 0.0);
+        }
+
+        bool isExact() const
+        {
+            bool exact{ mMaxMismatchCount == 0 && mOverBudgetMismatchCount == 0 && mJitterError < 0.01 };
+            for (double error : mPercentileError) {
+                // Borne supérieure de la classe : au plus 1/64 de trop.
+                exact = exact && error <= 1.0 / 64.0;
+            }
+            return exact;
+        }
+
+    private:
+        uint64_t mState{ 42 };
+        std::vector<int64_t> mTimes;
+        size_t mCheckCount{};
+        double mPercentileError[std::size(smPercentiles)]{};
+        size_t mMaxMismatchCount{};
+        size_t mOverBudgetMismatchCount{};
+        double mJitterError{};
+        double mQueryNanoseconds{};
+
+        void check(ezgame::Timer const& timer)
+        {
+            Clock::time_point const start{ Clock::now() };
+            int64_t percentiles[std::size(smPercentiles)];
+            for (size_t i{}; i < std::size(smPercentiles); ++i) {
+                percentiles[i] = timer.percentile(smPercentiles[i]);
+            }
+            int64_t const max{ timer.max() };
+            float const jitter{ timer.jitter() };
+            size_t const overBudget{ timer.overBudgetCount() };
+            mQueryNanoseconds += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            ++mCheckCount;
+
+            // Valeurs exactes de la même fenêtre.
+            size_t const count{ std::min(mTimes.size(), smWindowSize) };
+            std::vector<int64_t> window(mTimes.end() - static_cast<std::ptrdiff_t>(count), mTimes.end());
+            double mean{};
+            for (int64_t time : window) {
+                mean += static_cast<double>(time);
+            }
+            mean /= static_cast<double>(count);
+            double variance{};
+            for (int64_t time : window) {
+                variance += (static_cast<double>(time) - mean) * (static_cast<double>(time) - mean);
+            }
+            size_t const exactOverBudget{ static_cast<size_t>(std::count_if(window.begin(), window.end(), [](int64_t time) { return time > smFrameBudget; })) };
+            std::sort(window.begin(), window.end());
+
+            for (size_t i{}; i < std::size(smPercentiles); ++i) {
+                size_t const rank{ std::max(static_cast<size_t>(std::ceil(smPercentiles[i] * static_cast<double>(count))), size_t{ 1 }) };
+                int64_t const exact{ window[rank - 1] };
+                double const error{ exact > 0 ? std::abs(static_cast<double>(percentiles[i] - exact)) / static_cast<double>(exact) : static_cast<double>(percentiles[i]) };
+                mPercentileError[i] = std::max(mPercentileError[i], error);
+            }
+            mMaxMismatchCount += max != window.back() ? 1 : 0;
+            mOverBudgetMismatchCount += overBudget != exactOverBudget ? 1 : 0;
+            mJitterError = std::max(mJitterError, std::abs(static_cast<double>(jitter) - std::sqrt(variance / static_cast<double>(count))));
+        }
+    } checker;
+
+    class StutteringEngine
+    {
+    public:
+        float width() const { return 800.0f; }
+        float height() const { return 600.0f; }
+        std::string title() const { return "Banc d'essai"; }
+        std::string iconFileName() const { return ""; }
+
+        bool provessEvents(ezgame::Keyboard const&, ezgame::Timer const& timer) { return checker.tic(timer); }
+        void processDisplay(ezgame::Screen &) {}
+    };
+
+} // namespace
+
+
+int main()
+{
+    ezgame::Application application;
+    application.setFrameLimit(smFrameCount);
+    application.setTimerWindow(smWindowSize);
+    application.setFrameBudget(smFrameBudget);
+
+    application.run<StutteringEngine>();
+    checker.report();
+    return checker.isExact() ? 0 : 1;
+}
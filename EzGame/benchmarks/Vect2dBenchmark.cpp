@@ -0,0 +1,112 @@
+// Banc d'essai : coût par appel des opérations arithmétiques de Vect2d.
+//
+// Met à jour 1M de positions avec la même opération que le moteur de jeu 
+// (position += vitesse * facteur, comme mCircle.move(Vect2d(...) * 2.5f)) 
+// de deux façons :
+//  - appels hors ligne : chaque opération passe par une fonction que le 
+//    compilateur ne peut pas intégrer, ce qui reproduit l'appel vers 
+//    EzGame.lib lorsque Vect2d n'était défini que dans la librairie;
+//  - appels en ligne : les définitions de Vect2d.h, intégrées et 
+//    vectorisables.
+//
+// Compilation (Linux) :
+//   g++ -std=c++20 -O2 -IEzGame/include EzGame/benchmarks/Vect2dBenchmark.cpp EzGame/src/*.cpp <EzGame>
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+
+#if defined(_MSC_VER)
+#define EZGAME_BENCHMARK_NOINLINE __declspec(noinline)
+#elif defined(__clang__)
+#define EZGAME_BENCHMARK_NOINLINE __attribute__((noinline))
+#else
+#define EZGAME_BENCHMARK_NOINLINE __attribute__((noipa))
+#endif
+
+
+namespace {
+
+    using Clock = std::chrono::steady_clock;
+
+    size_t const smVectorCount{ 1'000'000 };
+    size_t const smRepetitionCount{ 20 };
+    float const smSpeedFactor{ 2.5f };
+
+    // Les opérations constexpr sont évaluables à la compilation.
+    static_assert((ezgame::Vect2d(1.0f, 2.0f) + ezgame::Vect2d(3.0f, 4.0f) * 2.0f).x() == 7.0f);
+    static_assert(ezgame::Vect2d(3.0f, 4.0f).squaredLength() == 25.0f);
+
+    // Substituts des appels vers la librairie.
+    EZGAME_BENCHMARK_NOINLINE ezgame::Vect2d multiplied(ezgame::Vect2d const& vector, float scalar)
+    {
+        return vector * scalar;
+    }
+
+    EZGAME_BENCHMARK_NOINLINE void added(ezgame::Vect2d & vector, ezgame::Vect2d const& other)
+    {
+        vector += other;
+    }
+
+    void updateOutOfLine(std::vector<ezgame::Vect2d> & positions, std::vector<ezgame::Vect2d> const& speeds)
+    {
+        for (size_t i{}; i < positions.size(); ++i) {
+            added(positions[i], multiplied(speeds[i], smSpeedFactor));
+        }
+    }
+
+    void updateInline(std::vector<ezgame::Vect2d> & positions, std::vector<ezgame::Vect2d> const& speeds)
+    {
+        for (size_t i{}; i < positions.size(); ++i) {
+            positions[i] += speeds[i] * smSpeedFactor;
+        }
+    }
+
+    template <typename Function>
+    double bestNanosecondsPerVector(Function function)
+    {
+        double best{ std::numeric_limits<double>::max() };
+        for (size_t repetition{}; repetition < smRepetitionCount; ++repetition) {
+            Clock::time_point const start{ Clock::now() };
+            function();
+            double const elapsed{ std::chrono::duration<double, std::nano>(Clock::now() - start).count() };
+            best = std::min(best, elapsed / static_cast<double>(smVectorCount));
+        }
+        return best;
+    }
+
+} // namespace
+
+
+int main()
+{
+    std::vector<ezgame::Vect2d> positions(smVectorCount);
+    std::vector<ezgame::Vect2d> speeds(smVectorCount);
+    for (ezgame::Vect2d & speed : speeds) {
+        speed.randomize();
+    }
+
+    double const outOfLine{ bestNanosecondsPerVector([&]() { updateOutOfLine(positions, speeds); }) };
+    double const inlined{ bestNanosecondsPerVector([&]() { updateInline(positions, speeds); }) };
+
+    // Empêche l'élimination des mises à jour.
+    float checksum{};
+    for (ezgame::Vect2d const& position : positions) {
+        checksum += position.x() + position.y();
+    }
+
+    std::printf("%zu vecteurs : position += vitesse * %.1f\n", smVectorCount, smSpeedFactor);
+    std::printf("appels hors ligne : %8.3f ns/vecteur\n", outOfLine);
+    std::printf("appels en ligne   : %8.3f ns/vecteur\n", inlined);
+    std::printf("gain              : %8.3f ns/vecteur (x%.2f)\n", outOfLine - inlined, inlined > 0.0 ? outOfLine / inlined : 0.0);
+    std::printf("(somme de contrôle : %g)\n", checksum);
+
+    return 0;
+}
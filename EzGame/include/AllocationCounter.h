@@ -0,0 +1,45 @@
+#pragma once
+#ifndef _EZGAME_ALLOCATION_COUNTER_H_
+#define _EZGAME_ALLOCATION_COUNTER_H_
+
+
+// Inclusion des bibliothèques
+#include <cstddef>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class AllocationCounter
+    //!
+    //! \brief Compte les allocations dynamiques (`operator new`) du
+    //! programme, par exemple pour vérifier qu'une image n'alloue rien (voir
+    //! Application::setOverlayVisible).
+    //!
+    //! \details Le compte n'est disponible que si la bibliothèque est
+    //! compilée avec `EZGAME_COUNT_ALLOCATIONS` : `operator new` et
+    //! `operator delete` (simples et tableaux, sans alignement imposé) sont
+    //! alors remplacés par des versions comptées qui appellent `malloc` et
+    //! `free`. Un programme qui remplace lui-même ces opérateurs ne doit pas
+    //! définir `EZGAME_COUNT_ALLOCATIONS`. Sans cette définition,
+    //! AllocationCounter::isEnabled est faux et le compte reste nul.
+    //!
+    //! Avec CMake, un programme lié à la cible `EzGameCountedAllocations`
+    //! compte ses allocations même si la bibliothèque ne les compte pas.
+    class AllocationCounter
+    {
+    public:
+        AllocationCounter() = delete;
+
+        //! \brief Indique si les allocations sont comptées.
+        static bool isEnabled() noexcept;
+        //!
+        //! \brief Retourne le nombre d'allocations depuis le démarrage du
+        //! programme, tous fils confondus.
+        static size_t count() noexcept;
+    };
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_ALLOCATION_COUNTER_H_
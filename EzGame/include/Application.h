@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <functional>
+#include "Profiler.h"
 
 
 //! \brief Le namespace ezgame réuni l'ensemble de la librairie EzGame.
@@ -31,6 +32,7 @@ namespace ezgame {
     //! - les opérations en lecture/écriture suivantes :
     //!   - `bool processEvents(Keyboard const& keyboard, Timer const& timer)` : fonction servant faire le traitement de chaque pas de simulation. Lorsque la fonction retourne faux, l'application termine immédiatement.
     //!   - `void processDisplay(Screen & screen)` : fonction servant à redessiner la fenêtre graphique à chaque pas de simulation.
+    //!     Le moteur peut plutôt offrir `void processDisplay(Screen & screen, float alpha)` pour recevoir le facteur d'interpolation entre les deux derniers pas de simulation (voir Application::setFixedTimestep).
     //! 
     //! Pour être considéré compatibles, il est essentiel que les critères suivants soient **strictement identiques** pour chaque fonction:
     //!  - le nom
@@ -40,13 +42,22 @@ namespace ezgame {
     
     //! \cond PRIVATE
     template<typename T>
-    concept GameEngineRequirements = requires(T ge, T const gec, ezgame::Keyboard const& k, ezgame::Timer const& t, ezgame::Screen & s) {
+    concept GameEngineRequirements = requires(T ge, T const gec, ezgame::Keyboard const& k, ezgame::Timer const& t) {
         { gec.width() } -> std::same_as<float>;
         { gec.height() } -> std::same_as<float>;
         { gec.title() } -> std::same_as<std::string>;
         { gec.iconFileName() } -> std::same_as<std::string>;
         { ge.provessEvents(k, t) } -> std::same_as<bool>;
+    } && (requires(T ge, ezgame::Screen & s) {
         { ge.processDisplay(s) } -> std::same_as<void>;
+    } || requires(T ge, ezgame::Screen & s, float alpha) {
+        { ge.processDisplay(s, alpha) } -> std::same_as<void>;
+    });
+
+    // Vrai si le moteur de jeu reçoit le facteur d'interpolation.
+    template<typename T>
+    concept InterpolatedDisplay = requires(T ge, ezgame::Screen & s, float alpha) {
+        { ge.processDisplay(s, alpha) } -> std::same_as<void>;
     };
     //! \endcond
         
@@ -99,6 +110,20 @@ namespace ezgame {
     //! On remarque que le programme utilise la fonction `WinMain` plutôt que 
     //! la fonction `main` comme point d'entrée du programme.
     //! 
+    //! Une implémentation sans fenêtre (_headless_) est aussi disponible dans 
+    //! le dossier `EzGame/src` pour Linux. Elle exécute le moteur de jeu 
+    //! pendant un nombre fixe d'images (voir Application::setFrameLimit) et 
+    //! affiche à la fin un rapport de performance : images par seconde, 
+    //! temps par image (p50 et p99) et temps passé dans chaque phase.
+    //! 
+    //! Cette implémentation est construite par CMake, qui définit 
+    //! `EZGAME_HEADLESS`. Sans `EZGAME_HEADLESS`, les en-têtes décrivent la 
+    //! bibliothèque fenêtrée précompilée (`EzGame.lib`, utilisée par le 
+    //! projet Visual Studio) : Application::run passe alors par les seules 
+    //! fonctions exportées par celle-ci, et les fonctionnalités propres à 
+    //! `EzGame/src` (relecture, pas fixe, rendu logiciel, ...) n'y sont pas 
+    //! disponibles.
+    //! 
     class Application
     {
     public:
@@ -170,6 +195,266 @@ namespace ezgame {
         //! 
         //! \return Le nom du fichier de l'icône utilisée pour l'application.
         std::string iconFileName() const;
+        //!
+        //! \brief Retourne le nombre d'images après lequel la boucle 
+        //! principale termine d'elle-même.
+        //! 
+        //! \details Cette limite n'est utilisée que par l'implémentation 
+        //! sans fenêtre (_headless_) de la bibliothèque, dans laquelle aucune 
+        //! touche ne peut être appuyée. La valeur 0 signifie que la boucle 
+        //! ne termine que lorsque `processEvents` retourne faux.
+        //! 
+        //! Par défaut, la valeur est lue dans la variable d'environnement 
+        //! `EZGAME_FRAME_LIMIT` et vaut 1000 si celle-ci n'est pas définie.
+        //! 
+        //! \return Le nombre maximum d'images exécutées par Application::run.
+        size_t frameLimit() const;
+        //!
+        //! \brief Retourne la durée fixe d'un pas de simulation en 
+        //! microseconde, ou 0 si la boucle principale alterne simplement 
+        //! un pas de simulation et un affichage (par défaut).
+        //! 
+        //! \details Avec un pas fixe, chaque image exécute autant d'appels 
+        //! à `processEvents` que nécessaire pour rattraper le temps réel 
+        //! écoulé, puis un seul appel à `processDisplay`. Pendant ces 
+        //! appels, Timer::sinceLastTic vaut exactement la durée du pas : la 
+        //! simulation (par exemple une physique à 120 Hz) ne dépend plus de 
+        //! la fréquence ni des variations de l'affichage (par exemple 
+        //! 60 Hz).
+        //! 
+        //! Le temps restant, inférieur à un pas, est transmis à 
+        //! `processDisplay(Screen &, float alpha)` sous la forme d'un 
+        //! facteur d'interpolation `alpha` [0, 1[ : l'affichage peut placer 
+        //! les objets entre leur état précédent et leur état courant.
+        //! 
+        //! Le nombre de pas par image est borné 
+        //! (Application::maxStepsPerFrame). Lorsque la simulation prend du 
+        //! retard, le temps en trop est abandonné plutôt que rattrapé : le 
+        //! jeu ralentit au lieu de s'enliser (_spiral of death_). Les pas 
+        //! abandonnés sont comptés dans le rapport de fin. Le découpage en 
+        //! pas est fait par FixedTimestep.
+        //! 
+        //! Sans fenêtre, aucune synchronisation verticale ne limite les 
+        //! images : la plupart des images n'exécutent alors aucun pas.
+        int64_t fixedTimestep() const;
+        //!
+        //! \brief Retourne le nombre maximum de pas de simulation exécutés 
+        //! par image avec un pas fixe.
+        size_t maxStepsPerFrame() const;
+        //!
+        //! \brief Retourne le nombre de tics sur lesquels Timer calcule ses 
+        //! statistiques (Timer::fpsEstimation, Timer::percentile, 
+        //! Timer::max, Timer::jitter et Timer::overBudgetCount). Par 
+        //! défaut, 1000.
+        size_t timerWindow() const;
+        //!
+        //! \brief Retourne le budget par tic en microseconde au-delà duquel 
+        //! un tic est compté par Timer::overBudgetCount.
+        int64_t frameBudget() const;
+        //!
+        //! \brief Indique si l'affichage est exécuté par un fil de rendu 
+        //! distinct (mode pipeline).
+        //! 
+        //! \details Par défaut, la boucle principale est strictement 
+        //! séquentielle : `processEvents`, `processDisplay`, puis exécution 
+        //! des commandes de dessin enregistrées par Screen. En mode 
+        //! pipeline, la liste de commandes d'une image est transmise à un 
+        //! fil de rendu qui l'exécute pendant que le fil principal passe à 
+        //! l'image suivante (`processEvents` puis enregistrement de la 
+        //! liste suivante). Deux listes sont utilisées en alternance; le 
+        //! fil principal n'attend le fil de rendu que si celui-ci n'a pas 
+        //! terminé l'image précédente au moment de soumettre la suivante.
+        //! 
+        //! Le mode pipeline ne peut être avantageux que si un second coeur 
+        //! est disponible; sur un seul coeur, il ajoute un surcoût (voir 
+        //! benchmarks/ApplicationPipelineBenchmark.cpp).
+        //! 
+        //! Le moteur de jeu n'a rien à changer : `processDisplay` est 
+        //! toujours appelée sur le fil principal, et les objets dessinés 
+        //! sont copiés dans la liste de commandes.
+        //! 
+        //! Par défaut, le mode pipeline est activé si la variable 
+        //! d'environnement `EZGAME_PIPELINED` vaut 1.
+        bool isPipelined() const;
+        //!
+        //! \brief Indique si les images sont dessinées par le rendu 
+        //! logiciel (voir Rasterizer).
+        //! 
+        //! \details L'implémentation sans fenêtre ne produit normalement 
+        //! aucun pixel. Avec le rendu logiciel, chaque image est dessinée 
+        //! dans une image RGBA (voir Screen::framebuffer) : effacement, 
+        //! cercles, contours, transparence et textes. Les textes utilisent 
+        //! la police `arial.ttf` du dossier `resources` (ou le fichier 
+        //! donné par la variable d'environnement `EZGAME_FONT`) et sont 
+        //! mis en cache d'une image à l'autre (voir TextCache).
+        //! 
+        //! Par défaut, le rendu logiciel est activé si la variable 
+        //! d'environnement `EZGAME_RASTERIZE` vaut 1 ou si un fichier de 
+        //! capture est défini.
+        bool isRasterized() const;
+        //!
+        //! \brief Indique si la surcouche de performance est dessinée 
+        //! par-dessus chaque image.
+        //! 
+        //! \details La surcouche (voir PerformanceOverlay) est dessinée par 
+        //! Application après `processDisplay`. Elle affiche le nombre 
+        //! d'images par seconde, les centiles et le maximum du temps par 
+        //! image, une courbe des derniers temps par image (comparés au 
+        //! budget, voir Application::setFrameBudget), le nombre d'appels de 
+        //! rendu, le nombre de primitives dessinées par le jeu et le nombre 
+        //! d'allocations par image (si la bibliothèque est compilée avec 
+        //! `EZGAME_COUNT_ALLOCATIONS`, voir AllocationCounter). La touche F3 
+        //! l'affiche ou la cache. Son coût moyen est donné dans le rapport 
+        //! de fin.
+        //! 
+        //! Par défaut, la surcouche est cachée, sauf si la variable 
+        //! d'environnement `EZGAME_OVERLAY` vaut 1.
+        bool isOverlayVisible() const;
+        //!
+        //! \brief Retourne le nom du fichier dans lequel la dernière image 
+        //! est écrite à la fin de Application::run (format PPM), ou une 
+        //! chaîne vide.
+        //! 
+        //! \details Par défaut, le nom est lu dans la variable 
+        //! d'environnement `EZGAME_CAPTURE`.
+        std::string captureFile() const;
+        //!
+        //! \brief Retourne le nom du fichier dans lequel les entrées de la 
+        //! session sont enregistrées, ou une chaîne vide si la session n'est 
+        //! pas enregistrée.
+        //! 
+        //! \details Lorsqu'un fichier est défini, l'instantané du clavier et 
+        //! le temps écoulé (Timer::sinceLastTic) de chaque pas de simulation 
+        //! sont conservés puis écrits dans le fichier à la fin de 
+        //! Application::run (voir InputRecording).
+        //! 
+        //! Par défaut, la valeur est lue dans la variable d'environnement 
+        //! `EZGAME_RECORD`.
+        std::string recordFile() const;
+        //!
+        //! \brief Retourne le nom du fichier dont les entrées sont relues, 
+        //! ou une chaîne vide si les entrées sont celles du clavier et de 
+        //! l'horloge.
+        //! 
+        //! \details Pendant une relecture, le clavier et le Timer donnés au 
+        //! moteur de jeu reproduisent ceux de la session enregistrée, pas de 
+        //! simulation par pas de simulation, et la boucle principale termine 
+        //! à la fin de l'enregistrement (la limite d'images est ignorée). 
+        //! Tout moteur de jeu respectant ezgame::GameEngineRequirements 
+        //! peut ainsi servir de test de charge reproductible, avec ou sans 
+        //! fenêtre.
+        //! 
+        //! Par défaut, la valeur est lue dans la variable d'environnement 
+        //! `EZGAME_REPLAY`.
+        std::string replayFile() const;
+        //!
+        //! \brief Retourne vrai si la relecture respecte la durée des pas 
+        //! de simulation enregistrés plutôt que d'être aussi rapide que 
+        //! possible (par défaut, faux).
+        bool isReplayRealTime() const;
+        //!
+        //! \brief Retourne le nom du fichier dans lequel le profil des 
+        //! dernières images est écrit, ou une chaîne vide.
+        //! 
+        //! \details Lorsqu'un fichier est défini, les zones mesurées (voir 
+        //! Profiler et EZ_PROFILE_SCOPE) des Application::profileFrameCount 
+        //! dernières images sont écrites au format Chrome Trace Event à 
+        //! chaque appui sur la touche F12 et à la fin de Application::run. 
+        //! Le fichier s'ouvre dans `chrome://tracing` ou Perfetto.
+        //! 
+        //! Application mesure chaque image, chaque appel à `provessEvents` 
+        //! et à `processDisplay`, la soumission de l'image (Screen::present) 
+        //! et l'exécution des listes de commandes, sur le fil principal et 
+        //! sur le fil de rendu.
+        //! 
+        //! Par défaut, le nom est lu dans la variable d'environnement 
+        //! `EZGAME_PROFILE`. Le profileur est retiré de la compilation si 
+        //! `EZGAME_NO_PROFILER` est défini.
+        std::string profileFile() const;
+        //!
+        //! \brief Retourne le nombre d'images écrites dans le profil (par 
+        //! défaut, 300).
+        size_t profileFrameCount() const;
+
+        // Mutateurs
+        // 
+        //! \brief Définit le nombre d'images après lequel la boucle 
+        //! principale termine d'elle-même.
+        //! 
+        //! \details Voir Application::frameLimit. Cette fonction doit être 
+        //! appelée avant Application::run.
+        //! 
+        //! \param frameCount Le nombre maximum d'images, 0 pour aucune limite.
+        void setFrameLimit(size_t frameCount);
+        //!
+        //! \brief Active le pas de simulation fixe (voir 
+        //! Application::fixedTimestep). Cette fonction doit être appelée 
+        //! avant Application::run.
+        //! 
+        //! \param stepMicroseconds La durée d'un pas en microseconde, 0 pour 
+        //! revenir à la boucle à pas variable.
+        //! \param maxStepsPerFrame Le nombre maximum de pas par image (au 
+        //! moins 1).
+        void setFixedTimestep(int64_t stepMicroseconds, size_t maxStepsPerFrame = 8);
+        //!
+        //! \brief Définit le nombre de tics sur lesquels Timer calcule ses 
+        //! statistiques (voir Application::timerWindow). Les statistiques 
+        //! accumulées sont effacées.
+        //! 
+        //! \param ticCount La taille de la fenêtre, de 1 à 
+        //! Timer::smMaximumWindowSize.
+        void setTimerWindow(size_t ticCount);
+        //!
+        //! \brief Définit le budget par tic (voir Application::frameBudget).
+        //! 
+        //! \param microseconds Le budget en microseconde, par exemple 
+        //! 16 667 pour 60 images par seconde.
+        void setFrameBudget(int64_t microseconds);
+        //!
+        //! \brief Active ou désactive le mode pipeline (voir 
+        //! Application::isPipelined). Cette fonction doit être appelée 
+        //! avant Application::run.
+        void setPipelined(bool pipelined);
+        //!
+        //! \brief Active ou désactive le rendu logiciel (voir 
+        //! Application::isRasterized). Cette fonction doit être appelée 
+        //! avant Application::run.
+        void setRasterized(bool rasterized);
+        //!
+        //! \brief Affiche ou cache la surcouche de performance (voir 
+        //! Application::isOverlayVisible).
+        void setOverlayVisible(bool visible);
+        //!
+        //! \brief Définit le fichier de capture de la dernière image (voir 
+        //! Application::captureFile) et active le rendu logiciel si le nom 
+        //! n'est pas vide. Cette fonction doit être appelée avant 
+        //! Application::run.
+        void setCaptureFile(std::string const & fileName);
+        //!
+        //! \brief Définit le fichier d'enregistrement des entrées (voir 
+        //! Application::recordFile). Une chaîne vide désactive 
+        //! l'enregistrement. Cette fonction doit être appelée avant 
+        //! Application::run.
+        void setRecordFile(std::string const & fileName);
+        //!
+        //! \brief Définit le fichier des entrées à relire (voir 
+        //! Application::replayFile). Une chaîne vide désactive la relecture. 
+        //! Cette fonction doit être appelée avant Application::run.
+        //! 
+        //! \param fileName Le fichier produit par un enregistrement.
+        //! \param realTime Si vrai, chaque pas de simulation dure au moins 
+        //! le temps enregistré; sinon, la relecture est aussi rapide que 
+        //! possible.
+        void setReplayFile(std::string const & fileName, bool realTime = false);
+        //!
+        //! \brief Définit le fichier du profil des dernières images (voir 
+        //! Application::profileFile). Une chaîne vide désactive 
+        //! l'exportation.
+        //! 
+        //! \param fileName Le fichier JSON à écrire.
+        //! \param frameCount Le nombre d'images écrites (au plus 
+        //! Profiler::smFrameCapacity).
+        void setProfileFile(std::string const & fileName, size_t frameCount = 300);
 
         // Fonction utilitaire
         // 
@@ -195,6 +480,7 @@ namespace ezgame {
         //!    - `std::string iconFileName() const` : fonction retournant le nom du fichier de l'icône de la fenêtre graphique. Voir la fonction Application::iconFileName pour les détails.
         //!    - `bool processEvents(ezgame::Keyboard const& keyboard, ezgame::Timer const& timer)` : fonction réalisant les calculs pour chaque pas de simulation.
         //!    - `void processDisplay(ezgame::Screen & screen)` : fonction réalisant la mise à jour de l'affichage pour chaque pas de simulation.
+        //!    - ou `void processDisplay(ezgame::Screen & screen, float alpha)` : la même fonction, recevant aussi le facteur d'interpolation (voir Application::fixedTimestep).
         //! 
         //! Il est important de comprendre que l'application tourne en boucle et 
         //! appel indéfiniment les deux fonctions. 
@@ -234,7 +520,13 @@ namespace ezgame {
         //
         // \endverbatim
         //! 
-        //! 
+        //! Avec `EZGAME_HEADLESS`, la boucle principale est instanciée pour 
+        //! le type `GE` : les fonctions du moteur de jeu sont appelées 
+        //! directement (sans `std::function` ni `std::bind`) et peuvent donc 
+        //! être intégrées (_inlined_) par le compilateur. Avec la 
+        //! bibliothèque précompilée, la boucle est celle de la bibliothèque 
+        //! et `processDisplay` reçoit toujours un facteur d'interpolation 
+        //! de 1.
         //! 
         //! \tparam GE La classe représentant le moteur de jeu. Cette classe 
         //! doit répondre à toutes les exigences du concept 
@@ -254,6 +546,20 @@ namespace ezgame {
         using UpdateViewFunction = void(Screen&);
         void run(std::function<UpdateModelFunction> updateModel, std::function<UpdateViewFunction> updateView);
         void setup(size_t width, size_t height, std::string const & title, std::string const & iconFileName);
+
+        // Étapes de la boucle principale, communes à toutes les instances 
+        // de Application::run.
+        Keyboard const & keyboard() const;
+        Timer const & timer() const;
+        Screen & screen();
+        void begin();
+        bool beginFrame();
+        bool beginStep();
+        bool beginReplayedStep();
+        float interpolation() const;
+        void endEvents();
+        void endFrame();
+        void end();
     };
 
 
@@ -272,9 +578,45 @@ namespace ezgame {
     template <GameEngineRequirements GE>
     inline void Application::run() {
         GE gameEngine;
+#if defined(EZGAME_HEADLESS)
+        setup(static_cast<size_t>(gameEngine.width()), static_cast<size_t>(gameEngine.height()), gameEngine.title(), gameEngine.iconFileName());
+        begin();
+        while (beginFrame()) {
+            EZ_PROFILE_SCOPE("Application::frame");
+            bool keepRunning{ true };
+            while (keepRunning && beginStep()) {
+                EZ_PROFILE_SCOPE("provessEvents");
+                keepRunning = gameEngine.provessEvents(keyboard(), timer());
+            }
+            endEvents();
+            if (!keepRunning) {
+                break;
+            }
+
+            {
+                EZ_PROFILE_SCOPE("processDisplay");
+                if constexpr (InterpolatedDisplay<GE>) {
+                    gameEngine.processDisplay(screen(), interpolation());
+                } else {
+                    gameEngine.processDisplay(screen());
+                }
+            }
+            endFrame();
+        }
+        end();
+#else
+        // Seules setup et run(std::function...) sont exportées par la 
+        // bibliothèque précompilée.
         setup(static_cast<size_t>(gameEngine.width()), static_cast<size_t>(gameEngine.height()), gameEngine.title(), gameEngine.iconFileName());
-        run(std::bind(&GE::provessEvents, &gameEngine, std::placeholders::_1, std::placeholders::_2), 
-            std::bind(&GE::processDisplay, &gameEngine, std::placeholders::_1));
+        run([&gameEngine](Keyboard const& keyboard, Timer const& timer) { return gameEngine.provessEvents(keyboard, timer); },
+            [&gameEngine](Screen & screen) {
+                if constexpr (InterpolatedDisplay<GE>) {
+                    gameEngine.processDisplay(screen, 1.0f);
+                } else {
+                    gameEngine.processDisplay(screen);
+                }
+            });
+#endif
     }
     //! \endcond
 
@@ -18,10 +18,23 @@ namespace ezgame {
     //! 
     //! \details Cette classe est l'un des deux objets pouvant être affiché à l'écran. 
     //! 
+    //! La position d'un cercle est celle du point désigné par son 
+    //! alignement (voir Alignment) : son centre pour Alignment::CenterCenter, 
+    //! le coin supérieur gauche de son carré englobant pour 
+    //! Alignment::TopLeft, etc. L'axe y est orienté vers le bas. Les 
+    //! collisions (Circle::isColliding) sont calculées entre les centres 
+    //! (voir Circle::center).
+    //! 
+    //! Le rayon n'est jamais inférieur au rayon minimal de 1 pixel et la 
+    //! taille du contour n'est jamais négative.
+    //! 
     //! Documentation à venir...
     class Circle
     {
     public:
+        //! \brief Constructeur par défaut : cercle du rayon minimal centré 
+        //! à l'origine, de la couleur par défaut (voir Color::Color) et sans 
+        //! contour.
         Circle();
         Circle(float radius, Vect2d const& position, Color const color, Alignment alignment = Alignment::CenterCenter);
         Circle(float radius, Vect2d const& position, Color const fillColor, Color const edgeColor, float edgeSize, Alignment alignment = Alignment::CenterCenter);
@@ -35,6 +48,14 @@ namespace ezgame {
         Color fillColor() const;
         Color edgeColor() const;
         float edgeSize() const;
+        //!
+        //! \brief Retourne la position du centre du cercle, selon son 
+        //! alignement.
+        Vect2d center() const;
+        //!
+        //! \brief Retourne le décalage du centre d'un cercle de rayon 1 par 
+        //! rapport à sa position, selon l'alignement donné.
+        static Vect2d centerOffset(Alignment alignment);
 
         bool isColliding(Circle const& circle) const;
 
@@ -51,8 +72,10 @@ namespace ezgame {
         void adjustSize(float relativeSize);
         void move(Vect2d const& displacement);
 
-    private:
+        //! \brief Rayon minimal d'un cercle : 1 pixel.
         static float const smMinimumRadius;
+
+    private:
         float mRadius;
         Vect2d mPosition;
         Alignment mAlignment;
@@ -0,0 +1,173 @@
+#pragma once
+#ifndef _EZGAME_CIRCLE_BATCH_H_
+#define _EZGAME_CIRCLE_BATCH_H_
+
+
+// Inclusion des bibliothèques
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "Vect2d.h"
+#include "Alignment.h"
+#include "Color.h"
+#include "Circle.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class CircleBatch
+    //!
+    //! \brief Classe représentant un ensemble de cercles stockés par
+    //! composantes (_structure of arrays_).
+    //!
+    //! \details Contrairement à un `std::vector<Circle>`, chaque attribut
+    //! des cercles est stocké dans son propre tableau contigu :
+    //!  - les positions en x et en y
+    //!  - les rayons
+    //!  - les couleurs de remplissage et de contour
+    //!  - les tailles de contour
+    //!
+    //! Les traitements qui ne lisent qu'une partie des attributs (par
+    //! exemple, la détection de collisions qui ne lit que les positions et
+    //! les rayons) parcourent ainsi une mémoire dense et vectorisable.
+    //!
+    //! L'alignement est commun à tous les cercles de l'ensemble : la
+    //! position de chaque cercle est interprétée selon cet alignement
+    //! (voir Circle::center). Les collisions sont testées entre les
+    //! centres.
+    //!
+    //! Un ensemble est dessiné d'un seul appel avec Screen::draw.
+    //!
+    //! Les indices des cercles sont stables tant qu'aucun cercle n'est
+    //! retiré. Le retrait (CircleBatch::remove) déplace le dernier cercle
+    //! à la place de celui retiré.
+    class CircleBatch
+    {
+    public:
+        //! \brief Type d'une paire d'indices de cercles en collision.
+        using IndexPair = std::pair<size_t, size_t>;
+
+        //! \brief Valeur retournée lorsqu'aucun cercle n'est trouvé.
+        static constexpr size_t npos{ static_cast<size_t>(-1) };
+
+        //! \brief Constructeur par défaut. L'ensemble est vide.
+        CircleBatch() = default;
+        //!
+        //! \brief Constructeur réservant la mémoire pour le nombre de
+        //! cercles donné.
+        explicit CircleBatch(size_t capacity, Alignment alignment = Alignment::CenterCenter);
+
+        // Accesseurs
+        //!
+        //! \brief Retourne le nombre de cercles.
+        size_t size() const;
+        //!
+        //! \brief Retourne vrai si l'ensemble ne contient aucun cercle.
+        bool empty() const;
+        //!
+        //! \brief Retourne l'alignement commun à tous les cercles.
+        Alignment alignment() const;
+        //!
+        //! \brief Retourne un objet Circle équivalent au cercle d'indice
+        //! donné.
+        Circle circle(size_t index) const;
+        float radius(size_t index) const;
+        Vect2d position(size_t index) const;
+        Color fillColor(size_t index) const;
+        Color edgeColor(size_t index) const;
+        float edgeSize(size_t index) const;
+
+        //! \brief Accès direct aux tableaux contigus des composantes.
+        //! Chaque tableau contient CircleBatch::size éléments.
+        float const * xs() const;
+        float const * ys() const;
+        float const * radii() const;
+        Color const * fillColors() const;
+        Color const * edgeColors() const;
+        float const * edgeSizes() const;
+        float * xs();
+        float * ys();
+        Color * fillColors();
+        Color * edgeColors();
+
+        // Mutateurs
+        //!
+        //! \brief Réserve la mémoire pour le nombre de cercles donné.
+        void reserve(size_t capacity);
+        //!
+        //! \brief Retire tous les cercles.
+        void clear();
+        //!
+        //! \brief Ajoute un cercle et retourne son indice.
+        //!
+        //! \details Un objet Circle dont l'alignement diffère de celui de
+        //! l'ensemble est converti : son centre est conservé et sa position
+        //! est recalculée selon l'alignement de l'ensemble. Comme pour
+        //! Circle, le rayon n'est jamais inférieur au rayon minimal.
+        size_t add(Circle const& circle);
+        size_t add(float radius, Vect2d const& position, Color const& color);
+        size_t add(float radius, Vect2d const& position, Color const& fillColor, Color const& edgeColor, float edgeSize);
+        //!
+        //! \brief Retire le cercle d'indice donné. Le dernier cercle prend
+        //! sa place (son indice devient `index`).
+        void remove(size_t index);
+        //!
+        //! \brief Change l'alignement commun à tous les cercles.
+        //!
+        //! \details Comme Circle::setAlignment, les positions ne sont pas
+        //! modifiées : elles sont désormais interprétées selon le nouvel
+        //! alignement, ce qui déplace le centre des cercles.
+        void setAlignment(Alignment alignment);
+        //!
+        //! \brief Change le rayon du cercle d'indice donné, limité au
+        //! rayon minimal (Circle::smMinimumRadius).
+        void setRadius(size_t index, float radius);
+        void setPosition(size_t index, Vect2d const& position);
+        void setFill(size_t index, Color const& color);
+        void setEdge(size_t index, Color const& color, float size);
+        void move(size_t index, Vect2d const& displacement);
+        //!
+        //! \brief Déplace tous les cercles du même déplacement.
+        void moveAll(Vect2d const& displacement);
+
+        // Collisions
+        //!
+        //! \brief Retourne l'indice du premier cercle en collision avec le
+        //! cercle donné, ou CircleBatch::npos s'il n'y en a aucun.
+        //!
+        //! \details La seconde version reçoit le centre du cercle testé.
+        size_t firstColliding(Circle const& circle) const;
+        size_t firstColliding(Vect2d const& center, float radius) const;
+        //!
+        //! \brief Retourne vrai si au moins un cercle est en collision avec
+        //! le cercle donné.
+        bool isColliding(Circle const& circle) const;
+        //!
+        //! \brief Ajoute à `pairs` toutes les paires (i, j), i < j, de
+        //! cercles de cet ensemble qui sont en collision.
+        //!
+        //! \return Le nombre de paires ajoutées.
+        size_t collidingPairs(std::vector<IndexPair> & pairs) const;
+        //!
+        //! \brief Ajoute à `pairs` toutes les paires (i, j) où le cercle i
+        //! de cet ensemble est en collision avec le cercle j de l'autre
+        //! ensemble.
+        //!
+        //! \return Le nombre de paires ajoutées.
+        size_t collidingPairs(CircleBatch const& other, std::vector<IndexPair> & pairs) const;
+
+    private:
+        Alignment mAlignment{ Alignment::CenterCenter };
+        std::vector<float> mX;
+        std::vector<float> mY;
+        std::vector<float> mRadius;
+        std::vector<Color> mFillColor;
+        std::vector<Color> mEdgeColor;
+        std::vector<float> mEdgeSize;
+    };
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_CIRCLE_BATCH_H_
@@ -188,8 +188,13 @@ namespace ezgame {
         //! \return La couleur mélangée.
         Color blended(Color const& otherColor, float blendFactor = 0.5, bool blendAlpha = false) const;
 
-        // doc to do
+        //!
+        //! \brief Retourne une couleur assombrie : mélange (voir blended) 
+        //! de `factor` de noir et de `1 - factor` de la couleur actuelle.
         Color darker(float factor = 0.5) const;
+        //!
+        //! \brief Retourne une couleur éclaircie : mélange (voir blended) 
+        //! de `factor` de blanc et de `1 - factor` de la couleur actuelle.
         Color lighter(float factor = 0.5) const;
         // to do : saturated
         // to do : desaturated
@@ -272,8 +277,11 @@ namespace ezgame {
         //! \return La couleur mélangée.
         void blend(Color const& color, float blendFactor = 0.5, bool blendAlpha = false);
         
-        // doc to do
+        //!
+        //! \brief Assombrit la couleur (voir darker).
         void darken(float factor = 0.5);
+        //!
+        //! \brief Éclaircit la couleur (voir lighter).
         void lighten(float factor = 0.5);
         // to do : saturate
         // to do : desaturate
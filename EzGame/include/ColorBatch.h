@@ -0,0 +1,95 @@
+#pragma once
+#ifndef _EZGAME_COLOR_BATCH_H_
+#define _EZGAME_COLOR_BATCH_H_
+
+
+// Inclusion des bibliothèques
+#include <span>
+#include "Color.h"
+#include "ColorRGBA8.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class ColorBatch
+    //!
+    //! \brief Classe statique de traitements de couleurs par lot.
+    //!
+    //! \details Ces fonctions convertissent ou mélangent des tableaux
+    //! complets de couleurs en un seul appel. Le traitement est fait par
+    //! blocs sans branchement que le compilateur vectorise (SSE/AVX), ce
+    //! qui convient à la recoloration de milliers d'entités par image
+    //! (clignotements de dommage, cartes de chaleur, ...).
+    //!
+    //! Les composantes HSL et HSV sont dans l'intervalle [0.0, 1.0], comme
+    //! pour Color (la teinte 1.0 correspond à 360 degrés). Les conversions
+    //! vers RGB conservent l'opacité déjà présente dans le tableau de
+    //! destination.
+    //!
+    //! Toutes les fonctions traitent le nombre d'éléments du plus petit
+    //! tableau donné.
+    //!
+    //! Exemple d'utilisation :
+    //! \code
+    //!     // assombrit toutes les couleurs en réduisant leur luminosité
+    //!     ColorBatch::rgbToHsl(colors, hues, saturations, lightnesses);
+    //!     for (float & lightness : lightnesses) lightness *= 0.5f;
+    //!     ColorBatch::hslToRgb(hues, saturations, lightnesses, colors);
+    //!
+    //!     // clignotement de dommage : chaque entité tend vers le rouge
+    //!     ColorBatch::blend(colors, flashColors, flashFactors, colors);
+    //! \endcode
+    class ColorBatch
+    {
+    public:
+        //! cond PRIVATE
+        ColorBatch() = delete;
+        ColorBatch(ColorBatch const&) = delete;
+        ColorBatch(ColorBatch &&) = delete;
+        ColorBatch& operator=(ColorBatch const&) = delete;
+        ColorBatch& operator=(ColorBatch &&) = delete;
+        ~ColorBatch() = delete;
+        //! endcond
+
+        //! \brief Convertit des couleurs réelles en couleurs compactes.
+        static void convert(std::span<Color const> colors, std::span<ColorRGBA8> result);
+        //!
+        //! \brief Convertit des couleurs compactes en couleurs réelles.
+        static void convert(std::span<ColorRGBA8 const> colors, std::span<Color> result);
+
+        //! \brief Calcule les composantes HSL des couleurs.
+        static void rgbToHsl(std::span<ColorRGBA8 const> colors, std::span<float> hues, std::span<float> saturations, std::span<float> lightnesses);
+        static void rgbToHsl(std::span<Color const> colors, std::span<float> hues, std::span<float> saturations, std::span<float> lightnesses);
+        //!
+        //! \brief Calcule les composantes HSV des couleurs.
+        static void rgbToHsv(std::span<ColorRGBA8 const> colors, std::span<float> hues, std::span<float> saturations, std::span<float> values);
+        static void rgbToHsv(std::span<Color const> colors, std::span<float> hues, std::span<float> saturations, std::span<float> values);
+        //!
+        //! \brief Définit les composantes RGB des couleurs à partir de
+        //! composantes HSL. L'opacité des couleurs est conservée.
+        static void hslToRgb(std::span<float const> hues, std::span<float const> saturations, std::span<float const> lightnesses, std::span<ColorRGBA8> colors);
+        static void hslToRgb(std::span<float const> hues, std::span<float const> saturations, std::span<float const> lightnesses, std::span<Color> colors);
+        //!
+        //! \brief Définit les composantes RGB des couleurs à partir de
+        //! composantes HSV. L'opacité des couleurs est conservée.
+        static void hsvToRgb(std::span<float const> hues, std::span<float const> saturations, std::span<float const> values, std::span<ColorRGBA8> colors);
+        static void hsvToRgb(std::span<float const> hues, std::span<float const> saturations, std::span<float const> values, std::span<Color> colors);
+
+        //! \brief Mélange deux tableaux de couleurs avec un facteur commun,
+        //! selon la convention de Color::blended : `blendFactor` est la
+        //! proportion de `colors` préservée. Le résultat peut être l'un des
+        //! tableaux d'entrée.
+        static void blend(std::span<ColorRGBA8 const> colors, std::span<ColorRGBA8 const> others, float blendFactor, std::span<ColorRGBA8> result, bool blendAlpha = false);
+        static void blend(std::span<Color const> colors, std::span<Color const> others, float blendFactor, std::span<Color> result, bool blendAlpha = false);
+        //!
+        //! \brief Mélange deux tableaux de couleurs avec un facteur propre à
+        //! chaque couleur.
+        static void blend(std::span<ColorRGBA8 const> colors, std::span<ColorRGBA8 const> others, std::span<float const> blendFactors, std::span<ColorRGBA8> result, bool blendAlpha = false);
+        static void blend(std::span<Color const> colors, std::span<Color const> others, std::span<float const> blendFactors, std::span<Color> result, bool blendAlpha = false);
+    };
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_COLOR_BATCH_H_
@@ -0,0 +1,191 @@
+#pragma once
+#ifndef _EZGAME_COLOR_GRADIENT_H_
+#define _EZGAME_COLOR_GRADIENT_H_
+
+
+// Inclusion des bibliothèques
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+#include <vector>
+#include "Color.h"
+#include "ColorRGBA8.h"
+#include "Random.h"
+#include "RandomStream.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class ColorGradient
+    //!
+    //! \brief Table de couleurs précalculées (dégradé ou palette).
+    //!
+    //! \details Le dégradé est calculé une seule fois à la création, dans
+    //! une table de taille fixe. Obtenir une couleur se résume ensuite à
+    //! une seule lecture dans la table, par indice ou par paramètre
+    //! normalisé [0, 1], plutôt qu'à un appel à Color::fromHsl,
+    //! Color::blended ou Color::randomized pour chaque particule à chaque
+    //! image.
+    //!
+    //! Une table peut être créée :
+    //!  - à partir de couleurs clés positionnées dans [0, 1]
+    //!    (ColorGradient::fromStops), interpolées en RGB;
+    //!  - à partir d'intervalles HSL (ColorGradient::fromHslRange),
+    //!    parcourus linéairement;
+    //!  - à partir d'une liste de couleurs utilisées telles quelles
+    //!    (ColorGradient::fromColors), pour une palette.
+    //!
+    //! La table est disponible en Color (pour CircleBatch et Screen) et en
+    //! ColorRGBA8.
+    //!
+    //! Exemple d'utilisation :
+    //! \code
+    //!     // construit une seule fois
+    //!     ColorGradient const fire{ ColorGradient::fromStops({
+    //!         { 0.0f, Color::Yellow }, { 0.5f, Color::Red }, { 1.0f, Color::Transparent } }) };
+    //!
+    //!     // à chaque image : la couleur de chaque particule dépend de son âge
+    //!     fire.sample(ages, std::span<Color>(particles.fillColors(), particles.size()));
+    //!     screen.draw(particles);
+    //! \endcode
+    class ColorGradient
+    {
+    public:
+        //! \brief Couleur clé d'un dégradé.
+        struct Stop
+        {
+            //! \brief Position de la couleur dans le dégradé [0, 1].
+            float position;
+            Color color;
+        };
+
+        //! \brief Nombre de couleurs de la table par défaut.
+        static constexpr size_t smDefaultSize{ 256 };
+
+        //! \brief Constructeur par défaut. La table contient une seule
+        //! couleur, blanche.
+        ColorGradient();
+
+        //! \brief Crée un dégradé interpolé en RGB entre des couleurs clés.
+        //! Les couleurs clés peuvent être données dans n'importe quel ordre;
+        //! avant la première et après la dernière, la couleur est constante.
+        //!
+        //! \param stops Les couleurs clés.
+        //! \param size Le nombre de couleurs de la table (au moins 1).
+        static ColorGradient fromStops(std::span<Stop const> stops, size_t size = smDefaultSize);
+        static ColorGradient fromStops(std::initializer_list<Stop> stops, size_t size = smDefaultSize);
+        //!
+        //! \brief Crée un dégradé parcourant linéairement des intervalles
+        //! HSL [0, 1]. La teinte peut sortir de [0, 1] pour faire le tour du
+        //! cercle chromatique (par exemple, de 0.8 à 1.2).
+        static ColorGradient fromHslRange(float hueFrom, float hueTo, float saturationFrom, float saturationTo, float lightnessFrom, float lightnessTo, float alpha = 1.0f, size_t size = smDefaultSize);
+        //!
+        //! \brief Crée une palette contenant exactement les couleurs
+        //! données.
+        static ColorGradient fromColors(std::span<Color const> colors);
+        static ColorGradient fromColors(std::initializer_list<Color> colors);
+
+        //! \brief Retourne le nombre de couleurs de la table.
+        size_t size() const;
+        //!
+        //! \brief Retourne la couleur d'indice donné [0, size[.
+        Color const& operator[](size_t index) const;
+        //!
+        //! \brief Retourne la couleur correspondant au paramètre normalisé
+        //! donné, arrondi à l'entrée la plus proche. Le paramètre est
+        //! limité à [0, 1].
+        Color const& at(float parameter) const;
+        ColorRGBA8 packedAt(float parameter) const;
+        //!
+        //! \brief Retourne une couleur de la table choisie aléatoirement,
+        //! en remplacement de Color::randomized.
+        Color const& random() const;
+        Color const& random(RandomStream & stream) const;
+
+        //! \brief Accès direct aux tables. Chaque table contient
+        //! ColorGradient::size éléments.
+        std::span<Color const> colors() const;
+        std::span<ColorRGBA8 const> packedColors() const;
+
+        //! \brief Écrit dans `colors` la couleur correspondant à chacun des
+        //! paramètres normalisés donnés (voir ColorGradient::at).
+        void sample(std::span<float const> parameters, std::span<Color> colors) const;
+        void sample(std::span<float const> parameters, std::span<ColorRGBA8> colors) const;
+
+    private:
+        std::vector<Color> mColors;
+        std::vector<ColorRGBA8> mPackedColors;
+        float mScale{};
+
+        explicit ColorGradient(std::vector<Color> && colors);
+        size_t indexOf(float parameter) const;
+    };
+
+
+
+
+
+
+
+
+
+
+
+    inline size_t ColorGradient::size() const
+    {
+        return mColors.size();
+    }
+
+    inline Color const& ColorGradient::operator[](size_t index) const
+    {
+        return mColors[index];
+    }
+
+    inline size_t ColorGradient::indexOf(float parameter) const
+    {
+        // Un paramètre hors de [0, 1] (ou NaN) est ramené à l'extrémité
+        // la plus proche. La comparaison précède la conversion : un
+        // paramètre trop grand (ou infini) ne peut pas être converti en
+        // size_t.
+        float const scaled{ parameter * mScale + 0.5f };
+        if (!(scaled > 0.0f)) {
+            return 0;
+        }
+        return scaled < mScale + 1.0f ? static_cast<size_t>(scaled) : mColors.size() - 1;
+    }
+
+    inline Color const& ColorGradient::at(float parameter) const
+    {
+        return mColors[indexOf(parameter)];
+    }
+
+    inline ColorRGBA8 ColorGradient::packedAt(float parameter) const
+    {
+        return mPackedColors[indexOf(parameter)];
+    }
+
+    inline Color const& ColorGradient::random() const
+    {
+        return mColors[Random::integer<size_t>(0, mColors.size() - 1)];
+    }
+
+    inline Color const& ColorGradient::random(RandomStream & stream) const
+    {
+        return mColors[stream.integer<size_t>(0, mColors.size() - 1)];
+    }
+
+    inline std::span<Color const> ColorGradient::colors() const
+    {
+        return mColors;
+    }
+
+    inline std::span<ColorRGBA8 const> ColorGradient::packedColors() const
+    {
+        return mPackedColors;
+    }
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_COLOR_GRADIENT_H_
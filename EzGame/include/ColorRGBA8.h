@@ -0,0 +1,201 @@
+#pragma once
+#ifndef _EZGAME_COLOR_RGBA8_H_
+#define _EZGAME_COLOR_RGBA8_H_
+
+
+// Inclusion des bibliothèques
+#include <cstdint>
+#include "Color.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class ColorRGBA8
+    //!
+    //! \brief Couleur compacte de 4 octets.
+    //!
+    //! \details Chacune des composantes rouge, verte, bleue et alpha est un
+    //! entier de 8 bits dans l'intervalle [0, 255]. Une couleur occupe ainsi
+    //! 4 octets plutôt que les 16 octets de Color, ce qui convient au
+    //! stockage de milliers de couleurs recalculées à chaque image.
+    //!
+    //! La conversion depuis Color arrondit chaque composante au plus
+    //! proche : l'erreur est d'au plus 1/510 par composante, et une couleur
+    //! convertie puis reconvertie (ColorRGBA8 -> Color -> ColorRGBA8) est
+    //! identique.
+    //!
+    //! Les traitements par lot (conversion HSL/HSV, mélange) sont offerts
+    //! par ColorBatch.
+    //!
+    //! L'alignement en mémoire est R-G-B-A. La valeur retournée par
+    //! ColorRGBA8::packed place le rouge dans l'octet de poids faible.
+    class ColorRGBA8
+    {
+    public:
+        //! \brief Constructeur par défaut. Noir opaque.
+        constexpr ColorRGBA8() = default;
+        //!
+        //! \brief Constructeur avec initialisation des composantes
+        //! [0, 255].
+        constexpr ColorRGBA8(uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha = 255);
+        //!
+        //! \brief Conversion depuis une couleur à composantes réelles.
+        explicit ColorRGBA8(Color const& color);
+
+        //! \brief Retourne la couleur équivalente à composantes réelles.
+        Color toColor() const;
+
+        constexpr uint8_t red() const;
+        constexpr uint8_t green() const;
+        constexpr uint8_t blue() const;
+        constexpr uint8_t alpha() const;
+        constexpr void setRed(uint8_t red);
+        constexpr void setGreen(uint8_t green);
+        constexpr void setBlue(uint8_t blue);
+        constexpr void setAlpha(uint8_t alpha);
+        constexpr void set(uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha = 255);
+
+        //! \brief Retourne les 4 composantes dans un entier de 32 bits
+        //! (rouge dans l'octet de poids faible).
+        constexpr uint32_t packed() const;
+        //!
+        //! \brief Crée une couleur à partir de la valeur retournée par
+        //! ColorRGBA8::packed.
+        static constexpr ColorRGBA8 fromPacked(uint32_t packed);
+
+        //! \brief Retourne la couleur mélangée, selon la même convention que
+        //! Color::blended.
+        //!
+        //! \param other La couleur à mélanger à celle-ci.
+        //! \param blendFactor La proportion de cette couleur à préserver
+        //! [0, 1].
+        //! \param blendAlpha Si vrai, l'opacité est aussi mélangée.
+        ColorRGBA8 blended(ColorRGBA8 const& other, float blendFactor = 0.5f, bool blendAlpha = false) const;
+
+        constexpr bool operator==(ColorRGBA8 const& other) const = default;
+
+        //! \brief Convertit une composante réelle [0.0, 1.0] en composante
+        //! de 8 bits, arrondie au plus proche et limitée à [0, 255].
+        static uint8_t toChannel(float value);
+        //!
+        //! \brief Convertit une composante de 8 bits en composante réelle
+        //! [0.0, 1.0].
+        static constexpr float fromChannel(uint8_t value);
+
+    private:
+        uint8_t mRed{};
+        uint8_t mGreen{};
+        uint8_t mBlue{};
+        uint8_t mAlpha{ 255 };
+    };
+
+    static_assert(sizeof(ColorRGBA8) == 4);
+
+
+
+
+
+
+
+
+
+
+
+    inline constexpr ColorRGBA8::ColorRGBA8(uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha)
+        : mRed{ red }, mGreen{ green }, mBlue{ blue }, mAlpha{ alpha }
+    {
+    }
+
+    inline ColorRGBA8::ColorRGBA8(Color const& color)
+        : mRed{ toChannel(color.red()) }, mGreen{ toChannel(color.green()) }, mBlue{ toChannel(color.blue()) }, mAlpha{ toChannel(color.alpha()) }
+    {
+    }
+
+    inline Color ColorRGBA8::toColor() const
+    {
+        return Color(fromChannel(mRed), fromChannel(mGreen), fromChannel(mBlue), fromChannel(mAlpha));
+    }
+
+    inline constexpr uint8_t ColorRGBA8::red() const
+    {
+        return mRed;
+    }
+
+    inline constexpr uint8_t ColorRGBA8::green() const
+    {
+        return mGreen;
+    }
+
+    inline constexpr uint8_t ColorRGBA8::blue() const
+    {
+        return mBlue;
+    }
+
+    inline constexpr uint8_t ColorRGBA8::alpha() const
+    {
+        return mAlpha;
+    }
+
+    inline constexpr void ColorRGBA8::setRed(uint8_t red)
+    {
+        mRed = red;
+    }
+
+    inline constexpr void ColorRGBA8::setGreen(uint8_t green)
+    {
+        mGreen = green;
+    }
+
+    inline constexpr void ColorRGBA8::setBlue(uint8_t blue)
+    {
+        mBlue = blue;
+    }
+
+    inline constexpr void ColorRGBA8::setAlpha(uint8_t alpha)
+    {
+        mAlpha = alpha;
+    }
+
+    inline constexpr void ColorRGBA8::set(uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha)
+    {
+        mRed = red;
+        mGreen = green;
+        mBlue = blue;
+        mAlpha = alpha;
+    }
+
+    inline constexpr uint32_t ColorRGBA8::packed() const
+    {
+        return uint32_t{ mRed } | (uint32_t{ mGreen } << 8) | (uint32_t{ mBlue } << 16) | (uint32_t{ mAlpha } << 24);
+    }
+
+    inline constexpr ColorRGBA8 ColorRGBA8::fromPacked(uint32_t packed)
+    {
+        return ColorRGBA8(static_cast<uint8_t>(packed), static_cast<uint8_t>(packed >> 8), static_cast<uint8_t>(packed >> 16), static_cast<uint8_t>(packed >> 24));
+    }
+
+    inline ColorRGBA8 ColorRGBA8::blended(ColorRGBA8 const& other, float blendFactor, bool blendAlpha) const
+    {
+        float const factor{ blendFactor < 0.0f ? 0.0f : (blendFactor > 1.0f ? 1.0f : blendFactor) };
+        auto mix = [factor](uint8_t a, uint8_t b) {
+            return static_cast<uint8_t>(static_cast<float>(b) + factor * (static_cast<float>(a) - static_cast<float>(b)) + 0.5f);
+        };
+        return ColorRGBA8(mix(mRed, other.mRed), mix(mGreen, other.mGreen), mix(mBlue, other.mBlue), blendAlpha ? mix(mAlpha, other.mAlpha) : mAlpha);
+    }
+
+    inline uint8_t ColorRGBA8::toChannel(float value)
+    {
+        float const scaled{ value * 255.0f + 0.5f };
+        return static_cast<uint8_t>(scaled < 0.0f ? 0.0f : (scaled > 255.0f ? 255.0f : scaled));
+    }
+
+    inline constexpr float ColorRGBA8::fromChannel(uint8_t value)
+    {
+        return static_cast<float>(value) * (1.0f / 255.0f);
+    }
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_COLOR_RGBA8_H_
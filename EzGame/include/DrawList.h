@@ -0,0 +1,177 @@
+#pragma once
+#ifndef _EZGAME_DRAW_LIST_H_
+#define _EZGAME_DRAW_LIST_H_
+
+
+// Inclusion des bibliothèques
+#include <cstddef>
+#include <span>
+#include <vector>
+#include "Alignment.h"
+#include "Color.h"
+#include "Circle.h"
+#include "CircleBatch.h"
+#include "Text.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class DrawList
+    //!
+    //! \brief Liste de commandes de dessin enregistrées pendant une image.
+    //!
+    //! \details Screen n'exécute pas immédiatement les primitives qui lui
+    //! sont données : elle les copie dans une liste de commandes, exécutée
+    //! à la fin de l'image. Une fois enregistrée, la liste ne dépend plus
+    //! des objets du moteur de jeu, qui peuvent être modifiés aussitôt;
+    //! c'est ce qui permet de l'exécuter sur un fil de rendu pendant que
+    //! le pas de simulation suivant s'exécute (voir
+    //! Application::setPipelined).
+    //!
+    //! Les données des cercles sont rangées par composante (comme dans
+    //! CircleBatch) : enregistrer un CircleBatch se résume à quelques
+    //! copies contiguës. Chaque commande désigne un intervalle de ces
+    //! données; des cercles consécutifs de même alignement partagent une
+    //! seule commande. Vider la liste conserve la mémoire réservée : d'une
+    //! image à l'autre, l'enregistrement n'alloue plus de mémoire.
+    class DrawList
+    {
+    public:
+        //! \brief Type d'une commande de dessin.
+        enum class Kind
+        {
+            Clear,      //!< Remplit l'écran de la couleur `clearColors()[first]`.
+            Circles,    //!< Dessine les cercles [first, first + count[.
+            Text        //!< Dessine le texte `texts()[first]`.
+        };
+
+        //! \brief Commande de dessin.
+        struct Command
+        {
+            Kind kind;
+            //! \brief Alignement des cercles de la commande.
+            Alignment alignment;
+            size_t first;
+            size_t count;
+        };
+
+        //! \brief Retourne le nombre de commandes enregistrées.
+        size_t size() const;
+        bool empty() const;
+        std::span<Command const> commands() const;
+
+        //! \brief Accès aux données des commandes.
+        std::span<Color const> clearColors() const;
+        size_t circleCount() const;
+        float const * xs() const;
+        float const * ys() const;
+        float const * radii() const;
+        Color const * fillColors() const;
+        Color const * edgeColors() const;
+        float const * edgeSizes() const;
+        std::span<Text const> texts() const;
+
+        //! \brief Enregistre une commande. Les données sont copiées.
+        void addClear(Color const& color);
+        void add(Circle const& circle);
+        void add(CircleBatch const& circles);
+        void add(Text const& text);
+        //!
+        //! \brief Retire toutes les commandes en conservant la mémoire
+        //! réservée.
+        void clear();
+
+    private:
+        std::vector<Command> mCommands;
+        std::vector<Color> mClearColors;
+        std::vector<float> mX;
+        std::vector<float> mY;
+        std::vector<float> mRadius;
+        std::vector<Color> mFillColor;
+        std::vector<Color> mEdgeColor;
+        std::vector<float> mEdgeSize;
+        // Les textes sont réaffectés plutôt que recréés : les chaînes
+        // conservent leur mémoire d'une image à l'autre.
+        std::vector<Text> mTexts;
+        size_t mTextCount{};
+
+        // Ajoute `count` cercles à la dernière commande si elle est
+        // compatible, ou crée une nouvelle commande.
+        void addCircles(Alignment alignment, size_t count);
+    };
+
+
+
+
+
+
+
+
+
+
+
+    inline size_t DrawList::size() const
+    {
+        return mCommands.size();
+    }
+
+    inline bool DrawList::empty() const
+    {
+        return mCommands.empty();
+    }
+
+    inline std::span<DrawList::Command const> DrawList::commands() const
+    {
+        return mCommands;
+    }
+
+    inline std::span<Color const> DrawList::clearColors() const
+    {
+        return mClearColors;
+    }
+
+    inline size_t DrawList::circleCount() const
+    {
+        return mX.size();
+    }
+
+    inline float const * DrawList::xs() const
+    {
+        return mX.data();
+    }
+
+    inline float const * DrawList::ys() const
+    {
+        return mY.data();
+    }
+
+    inline float const * DrawList::radii() const
+    {
+        return mRadius.data();
+    }
+
+    inline Color const * DrawList::fillColors() const
+    {
+        return mFillColor.data();
+    }
+
+    inline Color const * DrawList::edgeColors() const
+    {
+        return mEdgeColor.data();
+    }
+
+    inline float const * DrawList::edgeSizes() const
+    {
+        return mEdgeSize.data();
+    }
+
+    inline std::span<Text const> DrawList::texts() const
+    {
+        return std::span<Text const>(mTexts.data(), mTextCount);
+    }
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_DRAW_LIST_H_
@@ -0,0 +1,220 @@
+#pragma once
+#ifndef _EZGAME_FAST_MATH_H_
+#define _EZGAME_FAST_MATH_H_
+
+
+// Inclusion des bibliothèques
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include "SimdFloat.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class FastMath
+    //!
+    //! \brief Classe statique offrant des approximations rapides des
+    //! fonctions mathématiques utilisées par Vect2d.
+    //!
+    //! \details Ces fonctions sont optionnelles : elles remplacent
+    //! `std::sqrt`, `std::atan2`, `std::sin` et `std::cos` lorsque la
+    //! pleine précision n'est pas nécessaire (pilotage des agents, effets
+    //! visuels, ...). Elles sont utilisées par les variantes `...Fast` de
+    //! Vect2d (Vect2d::normalizeFast, Vect2d::orientationFast, ...).
+    //!
+    //! Sur les processeurs x86 récents, `std::sqrt` est une seule
+    //! instruction vectorisable : inverseSqrt n'est avantageux que
+    //! lorsque la boucle appelante n'est pas vectorisée.
+    //!
+    //! Erreurs maximales mesurées (voir benchmarks/FastMathBenchmark.cpp) :
+    //!  - inverseSqrt : erreur relative < 3e-7 avec SSE, < 5e-6 sans
+    //!  - atan2 : erreur absolue < 2e-6 radian
+    //!  - sin, cos et sincos : erreur absolue < 2e-7 pour un angle dans
+    //!    [-1000, 1000] radians (la réduction d'argument perd de la
+    //!    précision au-delà)
+    //!
+    //! Aucune de ces fonctions ne traite les valeurs infinies ou NaN.
+    class FastMath
+    {
+    public:
+        //! cond PRIVATE
+        FastMath() = delete;
+        FastMath(FastMath const&) = delete;
+        FastMath(FastMath &&) = delete;
+        FastMath& operator=(FastMath const&) = delete;
+        FastMath& operator=(FastMath &&) = delete;
+        ~FastMath() = delete;
+        //! endcond
+
+        //! \brief Approximation de `1 / std::sqrt(value)` pour une valeur
+        //! strictement positive.
+        static float inverseSqrt(float value);
+        //!
+        //! \brief Approximation de `std::atan2(y, x)`. Retourne 0 si x et y
+        //! sont nuls.
+        static float atan2(float y, float x);
+        //!
+        //! \brief Approximation simultanée de `std::sin(angle)` et de
+        //! `std::cos(angle)`.
+        static void sincos(float angle, float & sine, float & cosine);
+        static float sin(float angle);
+        static float cos(float angle);
+        //!
+        //! \brief Calcule le sinus et le cosinus de tous les angles
+        //! donnés.
+        //!
+        //! \details Le traitement est fait par blocs sans branchement que
+        //! le compilateur vectorise. Les trois tableaux doivent avoir la
+        //! même taille (seule la plus petite taille est traitée).
+        //!
+        //! Exemple d'utilisation :
+        //! \code
+        //!     std::vector<float> orientations(n), sines(n), cosines(n);
+        //!     FastMath::sincos(orientations, sines, cosines);
+        //! \endcode
+        static void sincos(std::span<float const> angles, std::span<float> sines, std::span<float> cosines);
+
+    private:
+        static const size_t smBatchBlockSize{ 8 };
+
+        static int quadrant(float angle, float & reduced);
+        static void sincosReduced(float reduced, int quadrant, float & sine, float & cosine);
+    };
+
+
+
+
+
+
+
+
+
+
+
+    inline float FastMath::inverseSqrt(float value)
+    {
+#ifdef EZGAME_SIMD_SSE
+        // Approximation matérielle (12 bits) raffinée d'une itération de
+        // Newton.
+        float const estimate{ _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value))) };
+        return estimate * (1.5f - 0.5f * value * estimate * estimate);
+#else
+        // Approximation par manipulation de l'exposant raffinée de deux
+        // itérations de Newton.
+        float estimate{ std::bit_cast<float>(0x5f375a86u - (std::bit_cast<uint32_t>(value) >> 1)) };
+        estimate *= 1.5f - 0.5f * value * estimate * estimate;
+        return estimate * (1.5f - 0.5f * value * estimate * estimate);
+#endif
+    }
+
+    inline float FastMath::atan2(float y, float x)
+    {
+        // Arc tangente polynomiale sur [0, 1] puis reconstitution de
+        // l'octant. Les corrections d'octant sont arithmétiques afin que
+        // la fonction reste sans branchement et vectorisable.
+        // Les valeurs absolues étant positives, leurs représentations
+        // binaires se comparent comme des entiers.
+        uint32_t const absoluteX{ std::bit_cast<uint32_t>(x) & 0x7fffffffu };
+        uint32_t const absoluteY{ std::bit_cast<uint32_t>(y) & 0x7fffffffu };
+        uint32_t const steep{ absoluteY > absoluteX };
+        uint32_t const backward{ std::bit_cast<uint32_t>(x) >> 31 };
+        float const smaller{ std::bit_cast<float>(steep ? absoluteX : absoluteY) };
+        float const larger{ std::bit_cast<float>(steep ? absoluteY : absoluteX) };
+        // Le plus petit réel normalisé évite la division par zéro (x et y
+        // nuls donnent 0) sans modifier les autres quotients.
+        float const ratio{ smaller / (larger + std::numeric_limits<float>::min()) };
+        float const squared{ ratio * ratio };
+        float angle{ ratio * (0.99997726f + squared * (-0.33262347f + squared * (0.19354346f + squared * (-0.11643287f + squared * (0.05265332f + squared * -0.01172120f))))) };
+        // angle devient pi/2 - angle si |y| > |x|, puis pi - angle si x < 0.
+        angle = std::bit_cast<float>(std::bit_cast<uint32_t>(angle) ^ (steep << 31)) + static_cast<float>(steep) * (0.5f * std::numbers::pi_v<float>);
+        angle = std::bit_cast<float>(std::bit_cast<uint32_t>(angle) ^ (backward << 31)) + static_cast<float>(backward) * std::numbers::pi_v<float>;
+        return std::copysign(angle, y);
+    }
+
+    inline int FastMath::quadrant(float angle, float & reduced)
+    {
+        // Réduction de l'angle sur [-pi/4, pi/4] par soustraction d'un
+        // multiple de pi/2 décomposé en trois termes (Cody-Waite).
+        float const scaled{ angle * (2.0f / std::numbers::pi_v<float>) };
+        int const index{ static_cast<int>(scaled + std::copysign(0.5f, scaled)) };
+        float const multiple{ static_cast<float>(index) };
+        reduced = ((angle - multiple * 1.5703125f) - multiple * 4.837512969970703125e-4f) - multiple * 7.54978995489188216e-8f;
+        return index;
+    }
+
+    inline void FastMath::sincosReduced(float reduced, int quadrant, float & sine, float & cosine)
+    {
+        float const squared{ reduced * reduced };
+        float const s{ reduced + reduced * squared * (-1.6666654611e-1f + squared * (8.3321608736e-3f + squared * -1.9515295891e-4f)) };
+        float const c{ 1.0f - 0.5f * squared + squared * squared * (4.166664568298827e-2f + squared * (-1.388731625493765e-3f + squared * 2.443315711809948e-5f)) };
+        // Sélection du quadrant sans branchement : les fonctions sont
+        // échangées pour les quadrants impairs et leurs signes suivent le
+        // cercle trigonométrique.
+        float const swapped{ static_cast<float>(quadrant & 1) };
+        float const sineSign{ static_cast<float>(1 - (quadrant & 2)) };
+        float const cosineSign{ static_cast<float>(1 - ((quadrant + 1) & 2)) };
+        sine = sineSign * (s + swapped * (c - s));
+        cosine = cosineSign * (c + swapped * (s - c));
+    }
+
+    inline void FastMath::sincos(float angle, float & sine, float & cosine)
+    {
+        float reduced;
+        int const index{ quadrant(angle, reduced) };
+        sincosReduced(reduced, index, sine, cosine);
+    }
+
+    inline float FastMath::sin(float angle)
+    {
+        float sine, cosine;
+        sincos(angle, sine, cosine);
+        return sine;
+    }
+
+    inline float FastMath::cos(float angle)
+    {
+        float sine, cosine;
+        sincos(angle, sine, cosine);
+        return cosine;
+    }
+
+    inline void FastMath::sincos(std::span<float const> angles, std::span<float> sines, std::span<float> cosines)
+    {
+        size_t count{ angles.size() };
+        count = sines.size() < count ? sines.size() : count;
+        count = cosines.size() < count ? cosines.size() : count;
+        float const * input{ angles.data() };
+        float * sineOutput{ sines.data() };
+        float * cosineOutput{ cosines.data() };
+
+        // Les blocs de taille fixe sont passés par des tampons locaux afin
+        // que le compilateur ne suppose aucun chevauchement.
+        size_t i{};
+        for (; i + smBatchBlockSize <= count; i += smBatchBlockSize) {
+            float blockSines[smBatchBlockSize];
+            float blockCosines[smBatchBlockSize];
+            for (size_t j{}; j < smBatchBlockSize; ++j) {
+                float reduced;
+                int const index{ quadrant(input[i + j], reduced) };
+                sincosReduced(reduced, index, blockSines[j], blockCosines[j]);
+            }
+            for (size_t j{}; j < smBatchBlockSize; ++j) {
+                sineOutput[i + j] = blockSines[j];
+                cosineOutput[i + j] = blockCosines[j];
+            }
+        }
+        for (; i < count; ++i) {
+            sincos(input[i], sineOutput[i], cosineOutput[i]);
+        }
+    }
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_FAST_MATH_H_
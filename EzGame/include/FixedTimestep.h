@@ -0,0 +1,78 @@
+#pragma once
+#ifndef _EZGAME_FIXED_TIMESTEP_H_
+#define _EZGAME_FIXED_TIMESTEP_H_
+
+
+// Inclusion des bibliothèques
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class FixedTimestep
+    //!
+    //! \brief Découpe le temps écoulé entre les images en pas de simulation
+    //! de durée fixe (voir Application::setFixedTimestep).
+    //!
+    //! \details Le temps écoulé de chaque image s'ajoute au temps accumulé,
+    //! qui est consommé par pas entiers. Au-delà de
+    //! FixedTimestep::maxStepsPerFrame pas, le retard est abandonné : seul
+    //! le reste inférieur à un pas est conservé. Le temps restant donne le
+    //! facteur d'interpolation de l'affichage (FixedTimestep::interpolation).
+    //!
+    //! Application lui transmet le temps réel écoulé; un test peut lui
+    //! imposer des temps quelconques.
+    class FixedTimestep
+    {
+    public:
+        using Duration = std::chrono::steady_clock::duration;
+
+        //!
+        //! \brief Construit un découpage en pas de `stepMicroseconds`
+        //! microsecondes (0 pour aucun pas fixe), d'au plus
+        //! `maxStepsPerFrame` pas par image (au moins 1).
+        FixedTimestep(int64_t stepMicroseconds = 0, size_t maxStepsPerFrame = 8);
+
+        //!
+        //! \brief Retourne la durée d'un pas en microseconde (0 si le pas
+        //! fixe n'est pas activé).
+        int64_t step() const;
+        //!
+        //! \brief Retourne le nombre maximum de pas par image.
+        size_t maxStepsPerFrame() const;
+        //!
+        //! \brief Indique si le pas fixe est activé.
+        bool isEnabled() const;
+        //!
+        //! \brief Recommence le découpage : le temps accumulé vaut un pas
+        //! (la première image exécute un pas de simulation) et aucun pas
+        //! n'est abandonné.
+        void reset();
+        //!
+        //! \brief Ajoute le temps écoulé depuis l'image précédente et
+        //! retourne le nombre de pas à exécuter pour l'image qui commence.
+        size_t advance(Duration elapsed);
+        //!
+        //! \brief Retourne le facteur d'interpolation [0, 1[ : le temps
+        //! accumulé restant, en fraction de pas. Retourne 0 si le pas fixe
+        //! n'est pas activé.
+        float interpolation() const;
+        //!
+        //! \brief Retourne le nombre de pas abandonnés depuis
+        //! FixedTimestep::reset.
+        size_t droppedSteps() const;
+
+    private:
+        int64_t mStep{};
+        size_t mMaxStepsPerFrame{};
+        Duration mAccumulated{};
+        size_t mDroppedSteps{};
+    };
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_FIXED_TIMESTEP_H_
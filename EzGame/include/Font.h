@@ -0,0 +1,148 @@
+#pragma once
+#ifndef _EZGAME_FONT_H_
+#define _EZGAME_FONT_H_
+
+
+// Inclusion des bibliothèques
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class Font
+    //!
+    //! \brief Police TrueType (`.ttf`) utilisée par le rendu logiciel des
+    //! textes.
+    //!
+    //! \details Seules les tables nécessaires au dessin sont lues : les
+    //! métriques (`head`, `hhea`, `hmtx`), la correspondance des caractères
+    //! (`cmap`, formats 4 et 12) et les contours des glyphes (`loca`,
+    //! `glyf`, glyphes simples et composés). Les instructions de hinting et
+    //! le crénage ne sont pas utilisés.
+    //!
+    //! Un glyphe est converti en carte de couverture (un octet par pixel,
+    //! 0 hors du glyphe et 255 à l'intérieur) par Font::rasterize. Le
+    //! résultat est conservé par GlyphAtlas : un glyphe n'est dessiné
+    //! qu'une fois par taille.
+    class Font
+    {
+    public:
+        //! \brief Carte de couverture d'un glyphe.
+        //!
+        //! \details `left` et `top` donnent la position du coin supérieur
+        //! gauche de la carte par rapport à l'origine du glyphe (sur la
+        //! ligne de base), l'axe y étant orienté vers le bas.
+        struct Bitmap
+        {
+            int left{};
+            int top{};
+            size_t width{};
+            size_t height{};
+            std::vector<uint8_t> coverage;
+        };
+
+        //! \brief Constructeur par défaut. Aucune police n'est chargée.
+        Font() = default;
+
+        //! \brief Charge la police du fichier donné.
+        //!
+        //! \return Vrai si le fichier a été lu et contient toutes les tables
+        //! nécessaires. En cas d'échec, la police est vide.
+        bool load(std::string const& fileName);
+        //!
+        //! \brief Retourne vrai si une police est chargée.
+        bool isLoaded() const;
+
+        //! \brief Retourne la distance entre la ligne de base et le haut
+        //! des caractères, pour la taille de texte donnée (en pixels).
+        float ascender(float size) const;
+        //!
+        //! \brief Retourne la distance (négative) entre la ligne de base et
+        //! le bas des caractères, pour la taille de texte donnée.
+        float descender(float size) const;
+        //!
+        //! \brief Retourne la distance entre deux lignes de base
+        //! consécutives, pour la taille de texte donnée.
+        float lineHeight(float size) const;
+
+        //! \brief Retourne l'indice du glyphe du caractère Unicode donné,
+        //! ou 0 (glyphe manquant) si la police ne le contient pas.
+        uint32_t glyphIndex(char32_t codePoint) const;
+        //!
+        //! \brief Retourne l'avance horizontale du glyphe donné, pour la
+        //! taille de texte donnée.
+        float advance(uint32_t glyph, float size) const;
+        //!
+        //! \brief Dessine le glyphe donné à la taille de texte donnée.
+        //!
+        //! \details La couverture de chaque pixel est estimée sur quatre
+        //! lignes de balayage par pixel, avec la règle de remplissage non
+        //! nulle. Un glyphe sans contour (une espace) ou mal formé donne une
+        //! carte vide.
+        void rasterize(uint32_t glyph, float size, Bitmap & bitmap) const;
+
+    private:
+        struct Point
+        {
+            float x;
+            float y;
+            bool onCurve;
+        };
+
+        std::vector<uint8_t> mData;
+        size_t mCmap{};
+        size_t mGlyf{};
+        size_t mLoca{};
+        size_t mHmtx{};
+        size_t mGlyphCount{};
+        size_t mMetricCount{};
+        bool mLongOffsets{};
+        float mUnitsPerEm{};
+        float mAscender{};
+        float mDescender{};
+        float mLineGap{};
+
+        bool glyphRange(uint32_t glyph, size_t & begin, size_t & end) const;
+        // Ajoute les contours du glyphe donné. Retourne faux si les données
+        // du glyphe sont mal formées.
+        bool outline(uint32_t glyph, std::vector<Point> & points, std::vector<size_t> & contourEnds, int depth) const;
+    };
+
+
+
+
+
+
+
+
+
+
+
+    inline bool Font::isLoaded() const
+    {
+        return !mData.empty();
+    }
+
+    inline float Font::ascender(float size) const
+    {
+        return mAscender * size / mUnitsPerEm;
+    }
+
+    inline float Font::descender(float size) const
+    {
+        return mDescender * size / mUnitsPerEm;
+    }
+
+    inline float Font::lineHeight(float size) const
+    {
+        return (mAscender - mDescender + mLineGap) * size / mUnitsPerEm;
+    }
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_FONT_H_
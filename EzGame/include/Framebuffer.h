@@ -0,0 +1,112 @@
+#pragma once
+#ifndef _EZGAME_FRAMEBUFFER_H_
+#define _EZGAME_FRAMEBUFFER_H_
+
+
+// Inclusion des bibliothèques
+#include <cstddef>
+#include <span>
+#include <string>
+#include <vector>
+#include "ColorRGBA8.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class Framebuffer
+    //!
+    //! \brief Image RGBA de 8 bits par composante, produite par Rasterizer.
+    //!
+    //! \details Les pixels sont rangés ligne par ligne, de haut en bas, et
+    //! de gauche à droite dans chaque ligne. Le pixel (0, 0) est le coin
+    //! supérieur gauche, comme pour les positions données à Screen.
+    //!
+    //! Framebuffer::save écrit l'image au format PPM binaire (P6), lisible
+    //! par la plupart des visionneuses et facile à comparer dans un test
+    //! d'intégration continue.
+    class Framebuffer
+    {
+    public:
+        //! \brief Constructeur par défaut. L'image est vide.
+        Framebuffer() = default;
+        //!
+        //! \brief Crée une image de la taille donnée, remplie de la couleur
+        //! donnée.
+        Framebuffer(size_t width, size_t height, ColorRGBA8 color = ColorRGBA8());
+
+        size_t width() const;
+        size_t height() const;
+        //!
+        //! \brief Retourne le pixel à la position donnée.
+        ColorRGBA8 pixel(size_t x, size_t y) const;
+        //!
+        //! \brief Retourne le premier pixel de la ligne donnée. Une ligne
+        //! contient Framebuffer::width pixels.
+        ColorRGBA8 * row(size_t y);
+        ColorRGBA8 const * row(size_t y) const;
+        std::span<ColorRGBA8 const> pixels() const;
+
+        //! \brief Change la taille de l'image. Le contenu n'est conservé
+        //! que si la taille ne change pas.
+        void resize(size_t width, size_t height);
+        //!
+        //! \brief Remplit l'image de la couleur donnée, sans mélange.
+        void fill(ColorRGBA8 color);
+
+        //! \brief Écrit l'image dans le fichier donné au format PPM binaire
+        //! (P6). La transparence n'est pas écrite.
+        //!
+        //! \return Vrai si le fichier a été entièrement écrit.
+        bool save(std::string const& fileName) const;
+
+    private:
+        size_t mWidth{};
+        size_t mHeight{};
+        std::vector<ColorRGBA8> mPixels;
+    };
+
+
+
+
+
+
+
+
+
+
+
+    inline size_t Framebuffer::width() const
+    {
+        return mWidth;
+    }
+
+    inline size_t Framebuffer::height() const
+    {
+        return mHeight;
+    }
+
+    inline ColorRGBA8 Framebuffer::pixel(size_t x, size_t y) const
+    {
+        return mPixels[y * mWidth + x];
+    }
+
+    inline ColorRGBA8 * Framebuffer::row(size_t y)
+    {
+        return mPixels.data() + y * mWidth;
+    }
+
+    inline ColorRGBA8 const * Framebuffer::row(size_t y) const
+    {
+        return mPixels.data() + y * mWidth;
+    }
+
+    inline std::span<ColorRGBA8 const> Framebuffer::pixels() const
+    {
+        return mPixels;
+    }
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_FRAMEBUFFER_H_
@@ -0,0 +1,148 @@
+#pragma once
+#ifndef _EZGAME_GLYPH_ATLAS_H_
+#define _EZGAME_GLYPH_ATLAS_H_
+
+
+// Inclusion des bibliothèques
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "Font.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class GlyphAtlas
+    //!
+    //! \brief Glyphes d'une police à une taille donnée, dessinés une seule
+    //! fois et rangés dans une même image de couverture.
+    //!
+    //! \details Un glyphe est dessiné par Font::rasterize la première fois
+    //! qu'il est demandé, puis copié dans l'atlas. Les glyphes sont rangés
+    //! sur des étagères : de gauche à droite sur l'étagère courante, puis
+    //! sur une nouvelle étagère lorsqu'elle est pleine. L'atlas double de
+    //! hauteur au besoin; la position d'un glyphe déjà rangé ne change pas.
+    //!
+    //! Un pixel vide sépare les glyphes, de sorte qu'une copie ne déborde
+    //! jamais sur un glyphe voisin.
+    class GlyphAtlas
+    {
+    public:
+        //! \brief Glyphe rangé dans l'atlas.
+        //!
+        //! \details (`x`, `y`) est le coin supérieur gauche du glyphe dans
+        //! l'atlas; `left` et `top` le situent par rapport à l'origine du
+        //! glyphe (voir Font::Bitmap).
+        struct Glyph
+        {
+            uint16_t x;
+            uint16_t y;
+            uint16_t width;
+            uint16_t height;
+            int16_t left;
+            int16_t top;
+            float advance;
+        };
+
+        //! \brief Largeur (en pixels) de l'atlas.
+        static constexpr size_t smWidth{ 512 };
+
+        //! \brief Crée un atlas vide pour la police et la taille données.
+        //! La police doit survivre à l'atlas.
+        GlyphAtlas(Font const & font, float size);
+        GlyphAtlas(GlyphAtlas const &) = delete;
+        GlyphAtlas& operator=(GlyphAtlas const &) = delete;
+
+        Font const & font() const;
+        float size() const;
+        //!
+        //! \brief Retourne le nombre de glyphes rangés.
+        size_t glyphCount() const;
+        //!
+        //! \brief Retourne la hauteur de l'atlas.
+        size_t height() const;
+        //!
+        //! \brief Retourne le premier octet de couverture de la ligne
+        //! donnée. Une ligne contient GlyphAtlas::smWidth octets.
+        uint8_t const * row(size_t y) const;
+
+        //! \brief Retourne le glyphe du caractère Unicode donné, en le
+        //! dessinant et en le rangeant s'il ne l'est pas déjà. La
+        //! référence retournée n'est valide que jusqu'à l'ajout d'un autre
+        //! glyphe.
+        Glyph const & glyph(char32_t codePoint);
+
+    private:
+        static constexpr uint32_t smMissing{ UINT32_MAX };
+
+        Font const & mFont;
+        float mSize;
+        size_t mHeight{};
+        std::vector<uint8_t> mPixels;
+        std::vector<Glyph> mGlyphs;
+        // Les caractères ASCII sont indexés directement.
+        std::array<uint32_t, 128> mAscii;
+        std::unordered_map<char32_t, uint32_t> mOthers;
+        Font::Bitmap mBitmap;
+
+        // Étagère courante.
+        size_t mShelfX{};
+        size_t mShelfY{};
+        size_t mShelfHeight{};
+
+        uint32_t add(char32_t codePoint);
+    };
+
+
+
+
+
+
+
+
+
+
+
+    inline Font const & GlyphAtlas::font() const
+    {
+        return mFont;
+    }
+
+    inline float GlyphAtlas::size() const
+    {
+        return mSize;
+    }
+
+    inline size_t GlyphAtlas::glyphCount() const
+    {
+        return mGlyphs.size();
+    }
+
+    inline size_t GlyphAtlas::height() const
+    {
+        return mHeight;
+    }
+
+    inline uint8_t const * GlyphAtlas::row(size_t y) const
+    {
+        return mPixels.data() + y * smWidth;
+    }
+
+    inline GlyphAtlas::Glyph const & GlyphAtlas::glyph(char32_t codePoint)
+    {
+        uint32_t index{ smMissing };
+        if (codePoint < mAscii.size()) {
+            index = mAscii[codePoint];
+        } else if (auto found{ mOthers.find(codePoint) }; found != mOthers.end()) {
+            index = found->second;
+        }
+        return mGlyphs[index != smMissing ? index : add(codePoint)];
+    }
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_GLYPH_ATLAS_H_
@@ -0,0 +1,82 @@
+#pragma once
+#ifndef _EZGAME_INPUT_RECORDING_H_
+#define _EZGAME_INPUT_RECORDING_H_
+
+
+// Inclusion des bibliothèques
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Keyboard.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class InputRecording
+    //!
+    //! \brief Enregistrement des entrées d'une session : l'instantané du
+    //! clavier et le temps écoulé (Timer::sinceLastTic) de chaque pas de
+    //! simulation.
+    //!
+    //! \details Application produit un enregistrement lorsqu'un fichier
+    //! d'enregistrement est défini (Application::setRecordFile) et le
+    //! relit lorsqu'un fichier de relecture est défini
+    //! (Application::setReplayFile). Un moteur de jeu qui ne dépend que de
+    //! son clavier et de son Timer (et d'un générateur aléatoire initialisé
+    //! par une graine fixe) refait alors exactement la même session, ce qui
+    //! permet de reproduire un problème de performance ou de bâtir un test
+    //! de charge à partir d'une vraie partie.
+    //!
+    //! Le fichier est binaire et compact (typiquement 3 octets par pas de
+    //! simulation) :
+    //!  - l'en-tête `EZIR`, la version du format (1 octet) et le nombre de
+    //!    touches de Keyboard::Key (1 octet);
+    //!  - le nombre de pas de simulation;
+    //!  - pour chaque pas : le temps écoulé en microsecondes, le nombre de
+    //!    touches dont l'état a changé depuis le pas précédent et l'indice
+    //!    de chacune de ces touches.
+    //!
+    //! Après l'en-tête, tous les entiers sont encodés en longueur variable
+    //! (LEB128 non signé : 7 bits par octet).
+    class InputRecording
+    {
+    public:
+        //! \brief Entrées d'un pas de simulation.
+        struct Frame
+        {
+            Keyboard::KeySet keys;
+            int64_t sinceLastTic;
+        };
+
+        //! \brief Retourne le nombre de pas de simulation enregistrés.
+        size_t size() const;
+        bool empty() const;
+        Frame const& operator[](size_t index) const;
+        std::vector<Frame> const& frames() const;
+
+        //! \brief Ajoute un pas de simulation à la fin de l'enregistrement.
+        void add(Keyboard::KeySet const& keys, int64_t sinceLastTic);
+        void reserve(size_t frameCount);
+        void clear();
+
+        //! \brief Écrit l'enregistrement dans le fichier donné.
+        //!
+        //! \return Vrai si le fichier a été entièrement écrit.
+        bool save(std::string const& fileName) const;
+        //!
+        //! \brief Remplace l'enregistrement par le contenu du fichier donné.
+        //!
+        //! \return Vrai si le fichier a été lu. Si le fichier est absent ou
+        //! invalide, l'enregistrement est vide et la fonction retourne faux.
+        bool load(std::string const& fileName);
+
+    private:
+        std::vector<Frame> mFrames;
+    };
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_INPUT_RECORDING_H_
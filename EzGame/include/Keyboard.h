@@ -4,7 +4,10 @@
 
 
 // Inclusion des bibliothèques
+#include <bitset>
+#include <cstddef>
 #include <cstdint>
+#include <iterator>
 
 
 // Déclaration du namespace ezgame
@@ -13,6 +16,30 @@ namespace ezgame {
     //! \class Keyboard
     //! 
     //! \brief Classe permettant de connaître l'état du clavier.
+    //!
+    //! \details L'état de toutes les touches est capturé une seule fois par
+    //! pas de simulation, par Application, juste avant l'appel de
+    //! `processEvents`. Les requêtes lisent cet instantané : elles sont peu
+    //! coûteuses et cohérentes entre elles pendant tout le pas de
+    //! simulation.
+    //!
+    //! L'instantané précédent est conservé, ce qui permet de détecter les
+    //! transitions (Keyboard::wasKeyPressed et Keyboard::wasKeyReleased).
+    //!
+    //! L'instantané est lu par les requêtes, définies dans la bibliothèque,
+    //! ou en entier, en lecture seule, par Keyboard::state (par exemple,
+    //! pour enregistrer les entrées de chaque pas). Avant le premier pas de
+    //! simulation, aucune touche n'est appuyée.
+    //!
+    //! Exemple d'utilisation :
+    //! \code
+    //!     if (keyboard.wasKeyPressed(Keyboard::Key::Space)) {
+    //!         fire(); // une seule fois par appui
+    //!     }
+    //!     for (Keyboard::Key key : keyboard.pressedKeys()) {
+    //!         // ...
+    //!     }
+    //! \endcode
     class Keyboard
     {
     public:
@@ -126,9 +153,75 @@ namespace ezgame {
             __count__   //!< \hideinitializer
         };
 
+        //! \brief Ensemble de touches, indicé par la valeur des touches.
+        using KeySet = std::bitset<static_cast<size_t>(Key::__count__)>;
+
+        //! \class KeyIterator
+        //!
+        //! \brief Itérateur sur les touches d'un ensemble KeySet.
+        class KeyIterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Key;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Key const*;
+            using reference = Key;
+
+            KeyIterator() = default;
+            KeyIterator(KeySet const& keys, size_t index);
+
+            Key operator*() const;
+            KeyIterator& operator++();
+            KeyIterator operator++(int);
+            bool operator==(KeyIterator const& other) const;
+
+        private:
+            KeySet const* mKeys{};
+            size_t mIndex{};
+
+            void skipReleased();
+        };
+
+        //! \class KeyRange
+        //!
+        //! \brief Séquence des touches d'un ensemble KeySet, parcourable
+        //! par une boucle `for`.
+        class KeyRange
+        {
+        public:
+            explicit KeyRange(KeySet const& keys);
+
+            KeyIterator begin() const;
+            KeyIterator end() const;
+            size_t size() const;
+            bool empty() const;
+
+        private:
+            KeySet const& mKeys;
+        };
+
         bool isKeyPressed(Key key) const; //!< Retourne vrai si la touche demandée est appuyée sinon retourne faux.
+        //!
+        //! \brief Retourne vrai si la touche demandée vient d'être appuyée
+        //! (relâchée au pas de simulation précédent, appuyée à celui-ci).
+        bool wasKeyPressed(Key key) const;
+        //!
+        //! \brief Retourne vrai si la touche demandée vient d'être relâchée
+        //! (appuyée au pas de simulation précédent, relâchée à celui-ci).
+        bool wasKeyReleased(Key key) const;
+        //!
+        //! \brief Retourne les touches appuyées, dans l'ordre de
+        //! l'énumération Key.
+        KeyRange pressedKeys() const;
+        //!
+        //! \brief Retourne l'instantané complet des touches appuyées.
+        KeySet const& state() const;
 
     private:
+        KeySet mPressed;
+        KeySet mPreviouslyPressed;
+
         Keyboard() = default;
         Keyboard(Keyboard const &) = delete;
         Keyboard(Keyboard &&) = delete;
@@ -136,9 +229,88 @@ namespace ezgame {
         Keyboard& operator=(Keyboard &&) = delete;
         ~Keyboard() = default;
 
+        // Capture l'état de toutes les touches auprès du système.
+        static KeySet poll();
+        // Remplace l'instantané courant; l'instantané courant devient 
+        // l'instantané précédent.
+        void update(KeySet const& pressed);
+        static bool isValid(Key key);
+
         friend class Application;
     };
 
+
+
+
+
+
+
+
+
+
+
+    inline Keyboard::KeyIterator::KeyIterator(KeySet const& keys, size_t index)
+        : mKeys{ &keys }, mIndex{ index }
+    {
+        skipReleased();
+    }
+
+    inline Keyboard::Key Keyboard::KeyIterator::operator*() const
+    {
+        return static_cast<Key>(mIndex);
+    }
+
+    inline Keyboard::KeyIterator& Keyboard::KeyIterator::operator++()
+    {
+        ++mIndex;
+        skipReleased();
+        return *this;
+    }
+
+    inline Keyboard::KeyIterator Keyboard::KeyIterator::operator++(int)
+    {
+        KeyIterator const previous{ *this };
+        ++*this;
+        return previous;
+    }
+
+    inline bool Keyboard::KeyIterator::operator==(KeyIterator const& other) const
+    {
+        return mIndex == other.mIndex;
+    }
+
+    inline void Keyboard::KeyIterator::skipReleased()
+    {
+        while (mIndex < mKeys->size() && !mKeys->test(mIndex)) {
+            ++mIndex;
+        }
+    }
+
+    inline Keyboard::KeyRange::KeyRange(KeySet const& keys)
+        : mKeys{ keys }
+    {
+    }
+
+    inline Keyboard::KeyIterator Keyboard::KeyRange::begin() const
+    {
+        return KeyIterator(mKeys, 0);
+    }
+
+    inline Keyboard::KeyIterator Keyboard::KeyRange::end() const
+    {
+        return KeyIterator(mKeys, mKeys.size());
+    }
+
+    inline size_t Keyboard::KeyRange::size() const
+    {
+        return mKeys.count();
+    }
+
+    inline bool Keyboard::KeyRange::empty() const
+    {
+        return mKeys.none();
+    }
+
 } // namespace ezgame
 
 #endif // _EZGAME_KEYBOARD_H_
\ No newline at end of file
@@ -0,0 +1,103 @@
+#pragma once
+#ifndef _EZGAME_PERFORMANCE_OVERLAY_H_
+#define _EZGAME_PERFORMANCE_OVERLAY_H_
+
+
+// Inclusion des bibliothèques
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "CircleBatch.h"
+#include "Text.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    class Screen;
+    class Timer;
+
+    //! \class PerformanceOverlay
+    //!
+    //! \brief Surcouche de performance dessinée par Application par-dessus
+    //! chaque image (voir Application::setOverlayVisible).
+    //!
+    //! \details Affiche le nombre d'images par seconde, les centiles et le
+    //! maximum du temps par image, une courbe des
+    //! PerformanceOverlay::smSampleCount derniers temps (un cercle par
+    //! image, coloré selon le budget Timer::frameBudget), le nombre d'appels
+    //! de rendu, le nombre d'objets dessinés par le jeu et le nombre
+    //! d'allocations par image (voir AllocationCounter).
+    //!
+    //! Les étiquettes ne changent jamais et les valeurs ne sont mises à jour
+    //! que toutes les PerformanceOverlay::smRefreshInterval microsecondes
+    //! (4 fois par seconde) : leurs mises en page sont presque toujours trouvées dans le cache du rendu
+    //! (voir TextCache). Les textes sont rangés dans les objets Text
+    //! eux-mêmes (voir Text::smInlineCapacity) et la courbe est un seul
+    //! CircleBatch : mettre à jour et dessiner la surcouche n'alloue rien.
+    class PerformanceOverlay
+    {
+    public:
+        //! \brief Nombre d'images de la courbe des temps par image.
+        static constexpr size_t smSampleCount{ 64 };
+        //! \brief Intervalle entre deux mises à jour des valeurs affichées,
+        //! en microseconde.
+        static constexpr int64_t smRefreshInterval{ 250'000 };
+
+        PerformanceOverlay();
+        PerformanceOverlay(PerformanceOverlay const &) = delete;
+        PerformanceOverlay& operator=(PerformanceOverlay const &) = delete;
+        ~PerformanceOverlay() = default;
+
+        //!
+        //! \brief Ajoute l'image qui se termine.
+        //!
+        //! \param frameTimer Le chronomètre des images (un tic par image).
+        //! \param drawCallCount Le nombre d'appels de rendu de la dernière
+        //! image exécutée (voir Screen::drawCallCount).
+        //! \param entityCount Le nombre de primitives dessinées par le jeu
+        //! pendant l'image.
+        //! \param allocationCount Le nombre total d'allocations (voir
+        //! AllocationCounter::count).
+        void update(Timer const & frameTimer, size_t drawCallCount, size_t entityCount, size_t allocationCount);
+        //!
+        //! \brief Recommence les mesures, par exemple lorsque la surcouche 
+        //! est de nouveau affichée. L'image suivante sert seulement de 
+        //! référence.
+        void reset();
+        //!
+        //! \brief Dessine la surcouche.
+        void draw(Screen & screen) const;
+
+    private:
+        enum Line : size_t
+        {
+            FramesPerSecond,
+            Percentile50,
+            Percentile99,
+            Maximum,
+            DrawCalls,
+            Entities,
+            Allocations,
+            LineCount
+        };
+
+        std::array<Text, LineCount> mLabels;
+        std::array<Text, LineCount> mValues;
+        CircleBatch mCurve;
+        std::array<int64_t, smSampleCount> mSamples{};
+        size_t mSampleIndex{};
+
+        // Accumulation depuis la dernière mise à jour des valeurs.
+        int64_t mSinceRefresh{};
+        size_t mFramesSinceRefresh{};
+        size_t mAllocationsAtRefresh{};
+        bool mStarted{};
+        // Les valeurs ne sont dessinées qu'après leur première mise à jour.
+        bool mRefreshed{};
+    };
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_PERFORMANCE_OVERLAY_H_
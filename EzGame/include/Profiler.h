@@ -0,0 +1,191 @@
+#pragma once
+#ifndef _EZGAME_PROFILER_H_
+#define _EZGAME_PROFILER_H_
+
+
+// Inclusion des bibliothèques
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#if defined(EZGAME_HEADLESS) && !defined(EZGAME_NO_PROFILER)
+#define EZGAME_PROFILER 1
+#endif
+
+#if defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#define EZGAME_PROFILER_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define EZGAME_PROFILER_RDTSC 1
+#else
+#include <chrono>
+#endif
+
+
+#define EZ_PROFILE_CONCATENATE_(a, b) a##b
+#define EZ_PROFILE_CONCATENATE(a, b) EZ_PROFILE_CONCATENATE_(a, b)
+
+//! \brief Mesure la durée de la portée courante sous le nom donné (une
+//! chaîne littérale), voir ezgame::Profiler.
+//!
+//! \details Si `EZGAME_NO_PROFILER` est défini, ou sans `EZGAME_HEADLESS`
+//! (bibliothèque précompilée, sans profileur), la macro ne produit aucun
+//! code.
+#if defined(EZGAME_PROFILER)
+#define EZ_PROFILE_SCOPE(name) ::ezgame::Profiler::Zone const EZ_PROFILE_CONCATENATE(ezProfileZone, __LINE__){ name }
+#else
+#define EZ_PROFILE_SCOPE(name) static_cast<void>(0)
+#endif
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class Profiler
+    //!
+    //! \brief Profileur par zones : mesure chaque portée marquée par
+    //! EZ_PROFILE_SCOPE et exporte les dernières images au format Chrome
+    //! Trace Event (JSON), lisible par `chrome://tracing` et Perfetto.
+    //!
+    //! \details Chaque fil d'exécution écrit ses zones dans son propre
+    //! tampon circulaire de Profiler::smEventCapacity zones, sans verrou :
+    //! une zone coûte deux lectures du compteur d'horloge du processeur et
+    //! trois écritures. Seule la première zone d'un fil prend un verrou,
+    //! pour inscrire son tampon. Les zones les plus anciennes sont
+    //! écrasées.
+    //!
+    //! Le début de chaque image est marqué par Application (voir
+    //! Profiler::markFrame), qui mesure aussi `provessEvents`,
+    //! `processDisplay`, la soumission (Screen::present) et l'exécution des
+    //! listes de commandes. Profiler::save exporte les zones des N
+    //! dernières images de tous les fils.
+    //!
+    //! Le profileur est compilé par défaut avec la bibliothèque construite
+    //! à partir de `EzGame/src` (`EZGAME_HEADLESS`); définir
+    //! `EZGAME_NO_PROFILER` retire toutes les zones de la compilation.
+    class Profiler
+    {
+    public:
+        //! \brief Nombre de zones conservées par fil (puissance de 2).
+        static constexpr size_t smEventCapacity{ 16384 };
+        //! \brief Nombre de débuts d'image conservés.
+        static constexpr size_t smFrameCapacity{ 4096 };
+
+        //! \class Zone
+        //!
+        //! \brief Zone mesurée de sa construction à sa destruction. Le nom
+        //! doit rester valide jusqu'à l'exportation (chaîne littérale).
+        class Zone
+        {
+        public:
+            explicit Zone(char const * name) noexcept;
+            Zone(Zone const &) = delete;
+            Zone& operator=(Zone const &) = delete;
+            ~Zone();
+
+        private:
+            char const * mName;
+            uint64_t mBegin;
+        };
+
+        Profiler() = delete;
+
+        //! \brief Retourne le compteur d'horloge courant (cycles de
+        //! référence du processeur, ou nanosecondes si le processeur n'en a
+        //! pas).
+        static uint64_t ticks() noexcept;
+        //!
+        //! \brief Enregistre une zone du fil courant.
+        static void record(char const * name, uint64_t begin, uint64_t end) noexcept;
+        //!
+        //! \brief Marque le début d'une image. À appeler d'un seul fil.
+        static void markFrame() noexcept;
+        //!
+        //! \brief Retourne le nombre d'images marquées.
+        static size_t frameCount() noexcept;
+        //!
+        //! \brief Nomme le fil courant dans les traces exportées.
+        static void setThreadName(std::string const & name);
+
+        //! \brief Écrit les zones des `frameCount` dernières images (de
+        //! tous les fils) dans le fichier donné, au format Chrome Trace
+        //! Event. Sans image marquée, toutes les zones conservées sont
+        //! écrites.
+        //!
+        //! \return Vrai si le fichier a été entièrement écrit.
+        static bool save(std::string const & fileName, size_t frameCount);
+
+    private:
+        struct Slot
+        {
+            std::atomic<char const *> name;
+            std::atomic<uint64_t> begin;
+            std::atomic<uint64_t> end;
+        };
+
+        // Tampon d'un fil : seul ce fil écrit; l'exportation lit les
+        // zones d'indices [head - smEventCapacity, head).
+        struct ThreadEvents
+        {
+            std::unique_ptr<Slot[]> slots;
+            std::atomic<uint64_t> head;
+        };
+
+        struct Registry;
+
+        static ThreadEvents & registerThread();
+        static inline thread_local ThreadEvents * stEvents{};
+    };
+
+
+
+
+
+
+
+
+
+
+
+    inline uint64_t Profiler::ticks() noexcept
+    {
+#if defined(EZGAME_PROFILER_RDTSC)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    inline void Profiler::record(char const * name, uint64_t begin, uint64_t end) noexcept
+    {
+        ThreadEvents * events{ stEvents };
+        if (!events) {
+            events = &registerThread();
+        }
+
+        uint64_t const head{ events->head.load(std::memory_order_relaxed) };
+        Slot & slot{ events->slots[head & (smEventCapacity - 1)] };
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.begin.store(begin, std::memory_order_relaxed);
+        slot.end.store(end, std::memory_order_relaxed);
+        events->head.store(head + 1, std::memory_order_release);
+    }
+
+    inline Profiler::Zone::Zone(char const * name) noexcept
+        : mName{ name }
+        , mBegin{ ticks() }
+    {
+    }
+
+    inline Profiler::Zone::~Zone()
+    {
+        record(mName, mBegin, ticks());
+    }
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_PROFILER_H_
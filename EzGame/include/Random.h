@@ -4,14 +4,22 @@
 
 
 // Inclusion des bibliothèques
+#include <atomic>
 #include <concepts>
+#include <cstdint>
 #include <random>
 #include <limits>
+#include <span>
+#include <type_traits>
+#include "RandomEngine.h"
 
 
 //! \cond PRIVATE
 template <typename T>
 concept Enumeration = std::is_enum_v<T>;
+
+template <typename T>
+concept CountedEnumeration = Enumeration<T> && requires { T::__count__; };
 //! \endcond
 
 
@@ -37,9 +45,31 @@ namespace ezgame {
     //! Les valeurs générées le sont de façon pseudo aléatoire avec une 
     //! distribution uniforme.
     //! 
+    //! Chaque fil d'exécution possède son propre générateur (Random::Engine, 
+    //! xoshiro256** par défaut ou PCG32 si `EZGAME_RANDOM_PCG32` est défini). 
+    //! Les appels de fils différents sont donc sûrs et sans contention. 
+    //! Random::seed réinitialise le générateur du fil courant et détermine 
+    //! les graines des fils qui utiliseront Random par la suite : une même 
+    //! graine reproduit les mêmes séquences.
+    //! 
+    //! Les méthodes Random::fill remplissent un tableau complet en un seul 
+    //! appel, sans passer par le générateur partagé à chaque valeur.
+    //! 
+    //! Vect2d::fromRandomized et Color::randomized utilisent ce même 
+    //! générateur. Avec la bibliothèque précompilée (sans 
+    //! `EZGAME_HEADLESS`), ces fonctions et Random::event sont celles de la 
+    //! bibliothèque et utilisent son propre générateur.
+    //! 
     class Random
     {
     public:
+        //! \brief Type du générateur pseudo aléatoire.
+#ifdef EZGAME_RANDOM_PCG32
+        using Engine = Pcg32;
+#else
+        using Engine = Xoshiro256StarStar;
+#endif
+
         //! cond PRIVATE
         Random() = delete;
         Random(Random const&) = delete;
@@ -285,9 +315,80 @@ namespace ezgame {
         //! \endcode
         template <Enumeration enum_type>
         static enum_type enumerator(enum_type lastEnumerator, bool lastIsCountEnumerator = false);
+        //!
+        //! \brief Génère un énumérateur d'une énumération terminée par 
+        //! l'énumérateur de compte `__count__`.
+        //! 
+        //! \details Cette fonction est un `template` non déductible. Tous 
+        //! les énumérateurs doivent être définis de 0 à `__count__ - 1`; 
+        //! `__count__` n'est jamais généré.
+        //! 
+        //! Exemple d'utilisation :
+        //! \code 
+        //!     enum class AccessLevel { Admin, User, Guest, __count__ };
+        //!     AccessLevel level{ Random::enumerator<AccessLevel>() };
+        //! \endcode
+        template <CountedEnumeration enum_type>
+        static enum_type enumerator();
+
+        //! \brief Réinitialise le générateur avec la graine donnée.
+        //! 
+        //! \details Le générateur du fil d'exécution courant est 
+        //! réinitialisé immédiatement. Les fils qui utilisent Random pour la 
+        //! première fois par la suite dérivent leur graine de celle-ci. Les 
+        //! générateurs des autres fils déjà actifs ne sont pas modifiés.
+        //! 
+        //! Exemple d'utilisation :
+        //! \code 
+        //!     Random::seed(2024);
+        //!     float first{ Random::real(0.0f, 1.0f) };
+        //!     Random::seed(2024);
+        //!     float second{ Random::real(0.0f, 1.0f) }; // second == first
+        //! \endcode
+        static void seed(uint64_t seed);
+        //!
+        //! \brief Réinitialise le générateur avec une graine non 
+        //! déterministe (std::random_device).
+        static void seed();
+        //!
+        //! \brief Retourne le générateur du fil d'exécution courant.
+        //! 
+        //! \details Le générateur respecte le concept 
+        //! `std::uniform_random_bit_generator` et peut être utilisé avec les 
+        //! distributions de la bibliothèque standard.
+        static Engine & engine();
+        //!
+        //! \brief Remplit le tableau de réels selon la plage 
+        //! [minimum, maximum[.
+        //! 
+        //! Exemple d'utilisation :
+        //! \code 
+        //!     std::vector<float> speeds(1000);
+        //!     Random::fill(speeds, 1.0f, 5.0f);
+        //! \endcode
+        static void fill(std::span<float> values, float minimum, float maximum);
+        static void fill(std::span<double> values, double minimum, double maximum);
+        //!
+        //! \brief Remplit le tableau d'entiers selon la plage 
+        //! [minimum, maximum].
+        static void fill(std::span<int> values, int minimum, int maximum);
 
     private:
-        static std::default_random_engine smEngine;
+        static inline std::atomic<uint64_t> smSeed{ Engine::smDefaultSeed };
+        static inline std::atomic<uint64_t> smThreadCount{};
+
+        static uint64_t nextThreadSeed();
+
+        // Conversions des bits d'un générateur (Engine ou RandomStream) 
+        // vers les distributions uniformes. Elles sont partagées afin 
+        // qu'une même suite de bits donne les mêmes valeurs.
+        friend class RandomStream;
+        template <typename Generator> static uint32_t next32(Generator & generator);
+        template <typename Generator> static uint64_t next64(Generator & generator);
+        template <std::floating_point real_type, typename Generator> static real_type unit(Generator & generator);
+        template <std::integral int_type, typename Generator> static int_type bounded(Generator & generator, int_type minimum, int_type maximum);
+        template <typename Generator> static uint64_t bounded64(Generator & generator, uint64_t range);
+        static uint64_t multiplyWide(uint64_t a, uint64_t b, uint64_t & high);
     };
 
 
@@ -301,6 +402,12 @@ namespace ezgame {
 
     
 
+#if defined(EZGAME_HEADLESS)
+    inline bool Random::event(float probability) {
+        return unit<float>(engine()) < probability;
+    }
+#endif
+
     template<std::integral int_type>
     inline int_type Random::integer() {
         return integer(std::numeric_limits<int_type>::min(), std::numeric_limits<int_type>::max());
@@ -313,7 +420,7 @@ namespace ezgame {
 
     template<std::integral int_type>
     inline int_type Random::integer(int_type minimum, int_type maximum) {
-        return std::uniform_int_distribution<int_type>(minimum, maximum)(smEngine);
+        return bounded(engine(), minimum, maximum);
     }
 
     template<std::floating_point real_type>
@@ -328,21 +435,19 @@ namespace ezgame {
 
     template<std::floating_point real_type>
     inline real_type Random::real(real_type minimum, real_type maximum) {
-        return std::uniform_real_distribution<real_type>(minimum, maximum)(smEngine);
+        return minimum + (maximum - minimum) * unit<real_type>(engine());
     }
 
     template<Enumeration enum_type, Enumeration ...enum_types>
     inline enum_type Random::enumerator(enum_type firstEnumerator, enum_types ...allOtherEnumerators)
     {
         std::initializer_list<enum_type> values({ firstEnumerator, allOtherEnumerators... });
-        std::uniform_int_distribution<std::size_t> distribution(0, values.size() - 1);
-        return *(values.begin() + distribution(smEngine));
+        return *(values.begin() + integer<size_t>(0, values.size() - 1));
     }
 
     template<Enumeration enum_type>
     inline enum_type Random::enumerator(size_t enumeratorCount) {
-        std::uniform_int_distribution<std::size_t> distribution(0, enumeratorCount - 1);
-        return static_cast<enum_type>(distribution(smEngine));
+        return static_cast<enum_type>(integer<size_t>(0, enumeratorCount - 1));
     }
 
     template<Enumeration enum_type>
@@ -350,6 +455,163 @@ namespace ezgame {
         return enumerator<enum_type>(static_cast<size_t>(lastEnumerator) + (lastIsCountEnumerator ? 1 : 0));
     }
 
+    template<CountedEnumeration enum_type>
+    inline enum_type Random::enumerator() {
+        return enumerator<enum_type>(static_cast<size_t>(enum_type::__count__));
+    }
+
+    inline void Random::seed(uint64_t seed) {
+        smSeed = seed;
+        smThreadCount = 1;
+        engine().seed(seed);
+    }
+
+    inline void Random::seed() {
+        std::random_device device;
+        seed((static_cast<uint64_t>(device()) << 32) | device());
+    }
+
+    inline Random::Engine & Random::engine() {
+        thread_local Engine engine{ nextThreadSeed() };
+        return engine;
+    }
+
+    inline uint64_t Random::nextThreadSeed() {
+        // Le premier fil utilise la graine telle quelle, les suivants une 
+        // graine dérivée de leur rang.
+        uint64_t const rank{ smThreadCount++ };
+        return rank == 0 ? smSeed.load() : SplitMix64{ smSeed.load() + rank }();
+    }
+
+    template<typename Generator>
+    inline uint32_t Random::next32(Generator & generator) {
+        if constexpr (Generator::max() == std::numeric_limits<uint32_t>::max()) {
+            return generator();
+        }
+        else {
+            // Les bits de poids fort sont les plus uniformes.
+            return static_cast<uint32_t>(generator() >> 32);
+        }
+    }
+
+    template<typename Generator>
+    inline uint64_t Random::next64(Generator & generator) {
+        if constexpr (Generator::max() == std::numeric_limits<uint32_t>::max()) {
+            uint64_t const high{ generator() };
+            return (high << 32) | generator();
+        }
+        else {
+            return generator();
+        }
+    }
+
+    template<std::floating_point real_type, typename Generator>
+    inline real_type Random::unit(Generator & generator) {
+        // Valeur dans [0, 1[ construite à partir d'autant de bits que la 
+        // mantisse en contient.
+        if constexpr (std::is_same_v<real_type, float>) {
+            return static_cast<float>(next32(generator) >> 8) * 0x1.0p-24f;
+        }
+        else if constexpr (std::is_same_v<real_type, double>) {
+            return static_cast<double>(next64(generator) >> 11) * 0x1.0p-53;
+        }
+        else {
+            return std::generate_canonical<real_type, std::numeric_limits<real_type>::digits>(generator);
+        }
+    }
+
+    template<std::integral int_type, typename Generator>
+    inline int_type Random::bounded(Generator & generator, int_type minimum, int_type maximum) {
+        using unsigned_type = std::make_unsigned_t<int_type>;
+        // La différence est ramenée au type non signé avant l'élargissement : 
+        // pour un type plus petit que int (short, char, ...), la promotion 
+        // vers int donnerait une différence négative.
+        uint64_t const range{ static_cast<unsigned_type>(static_cast<unsigned_type>(maximum) - static_cast<unsigned_type>(minimum)) };
+
+        if (range >= std::numeric_limits<uint32_t>::max()) {
+            return static_cast<int_type>(static_cast<unsigned_type>(static_cast<unsigned_type>(minimum) + static_cast<unsigned_type>(bounded64(generator, range))));
+        }
+
+        // Méthode de Lemire : multiplication plutôt que modulo, et rejet 
+        // seulement dans la petite zone biaisée.
+        uint64_t const count{ range + 1 };
+        uint64_t product{ static_cast<uint64_t>(next32(generator)) * count };
+        uint32_t low{ static_cast<uint32_t>(product) };
+        if (low < count) {
+            uint32_t const threshold{ static_cast<uint32_t>((uint64_t{ 1 } << 32) % count) };
+            while (low < threshold) {
+                product = static_cast<uint64_t>(next32(generator)) * count;
+                low = static_cast<uint32_t>(product);
+            }
+        }
+        return static_cast<int_type>(static_cast<unsigned_type>(static_cast<unsigned_type>(minimum) + static_cast<unsigned_type>(product >> 32)));
+    }
+
+    template<typename Generator>
+    inline uint64_t Random::bounded64(Generator & generator, uint64_t range) {
+        // Méthode de Lemire sur 64 bits, pour les plages d'au moins 2^32 
+        // valeurs : même suite de valeurs quelle que soit la bibliothèque 
+        // standard, contrairement à std::uniform_int_distribution.
+        if (range == std::numeric_limits<uint64_t>::max()) {
+            return next64(generator);
+        }
+        uint64_t const count{ range + 1 };
+        uint64_t high;
+        uint64_t low{ multiplyWide(next64(generator), count, high) };
+        if (low < count) {
+            uint64_t const threshold{ (uint64_t{} - count) % count };
+            while (low < threshold) {
+                low = multiplyWide(next64(generator), count, high);
+            }
+        }
+        return high;
+    }
+
+    inline uint64_t Random::multiplyWide(uint64_t a, uint64_t b, uint64_t & high) {
+        // Produit complet 64 x 64 -> 128 bits à partir de produits 
+        // partiels de 32 bits, sans extension propre à un compilateur.
+        uint64_t const aLow{ a & 0xFFFFFFFFu };
+        uint64_t const aHigh{ a >> 32 };
+        uint64_t const bLow{ b & 0xFFFFFFFFu };
+        uint64_t const bHigh{ b >> 32 };
+        uint64_t const lowLow{ aLow * bLow };
+        uint64_t const highLow{ aHigh * bLow };
+        uint64_t const lowHigh{ aLow * bHigh };
+        uint64_t const middle{ (lowLow >> 32) + (highLow & 0xFFFFFFFFu) + lowHigh };
+        high = aHigh * bHigh + (highLow >> 32) + (middle >> 32);
+        return (middle << 32) | (lowLow & 0xFFFFFFFFu);
+    }
+
+    inline void Random::fill(std::span<float> values, float minimum, float maximum) {
+        // Copie locale du générateur : son état reste dans les registres.
+        Engine & threadEngine{ engine() };
+        Engine local{ threadEngine };
+        float const range{ maximum - minimum };
+        for (float & value : values) {
+            value = minimum + range * unit<float>(local);
+        }
+        threadEngine = local;
+    }
+
+    inline void Random::fill(std::span<double> values, double minimum, double maximum) {
+        Engine & threadEngine{ engine() };
+        Engine local{ threadEngine };
+        double const range{ maximum - minimum };
+        for (double & value : values) {
+            value = minimum + range * unit<double>(local);
+        }
+        threadEngine = local;
+    }
+
+    inline void Random::fill(std::span<int> values, int minimum, int maximum) {
+        Engine & threadEngine{ engine() };
+        Engine local{ threadEngine };
+        for (int & value : values) {
+            value = bounded(local, minimum, maximum);
+        }
+        threadEngine = local;
+    }
+
 } // namespace ezgame
 
 
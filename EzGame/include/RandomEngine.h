@@ -0,0 +1,149 @@
+#pragma once
+#ifndef _EZGAME_RANDOM_ENGINE_H_
+#define _EZGAME_RANDOM_ENGINE_H_
+
+
+// Inclusion des bibliothèques
+#include <cstdint>
+#include <limits>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class SplitMix64
+    //!
+    //! \brief Générateur simple servant à dériver l'état des autres
+    //! générateurs à partir d'une graine de 64 bits.
+    //!
+    //! \details Deux graines voisines (par exemple 1 et 2) donnent des
+    //! états initiaux sans corrélation apparente.
+    class SplitMix64
+    {
+    public:
+        using result_type = uint64_t;
+
+        constexpr explicit SplitMix64(uint64_t seed) : mState{ seed } {}
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        constexpr result_type operator()()
+        {
+            uint64_t value{ mState += 0x9e3779b97f4a7c15ull };
+            value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+            value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+            return value ^ (value >> 31);
+        }
+
+    private:
+        uint64_t mState;
+    };
+
+    //! \class Xoshiro256StarStar
+    //!
+    //! \brief Générateur pseudo aléatoire xoshiro256** (Blackman et Vigna).
+    //!
+    //! \details Générateur rapide de 64 bits dont l'état tient sur 32
+    //! octets et dont la période est de 2^256 - 1. Il respecte le concept
+    //! `std::uniform_random_bit_generator` et peut donc être utilisé avec
+    //! les distributions de la bibliothèque standard.
+    //!
+    //! C'est le générateur utilisé par défaut par ezgame::Random.
+    class Xoshiro256StarStar
+    {
+    public:
+        using result_type = uint64_t;
+
+        //! \brief Graine utilisée par le constructeur par défaut.
+        static constexpr uint64_t smDefaultSeed{ 0x45a7c3e1d2b4f609ull };
+
+        constexpr Xoshiro256StarStar() : Xoshiro256StarStar(smDefaultSeed) {}
+        constexpr explicit Xoshiro256StarStar(uint64_t seed) { this->seed(seed); }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        //! \brief Réinitialise l'état à partir de la graine donnée.
+        constexpr void seed(uint64_t seed)
+        {
+            SplitMix64 mix{ seed };
+            for (uint64_t & state : mState) {
+                state = mix();
+            }
+        }
+
+        constexpr result_type operator()()
+        {
+            uint64_t const result{ rotateLeft(mState[1] * 5, 7) * 9 };
+            uint64_t const shifted{ mState[1] << 17 };
+            mState[2] ^= mState[0];
+            mState[3] ^= mState[1];
+            mState[1] ^= mState[2];
+            mState[0] ^= mState[3];
+            mState[2] ^= shifted;
+            mState[3] = rotateLeft(mState[3], 45);
+            return result;
+        }
+
+    private:
+        uint64_t mState[4]{};
+
+        static constexpr uint64_t rotateLeft(uint64_t value, int count)
+        {
+            return (value << count) | (value >> (64 - count));
+        }
+    };
+
+    //! \class Pcg32
+    //!
+    //! \brief Générateur pseudo aléatoire PCG32 (O'Neill, variante
+    //! XSH RR 64/32).
+    //!
+    //! \details Générateur de 32 bits dont l'état tient sur 16 octets et
+    //! dont la période est de 2^64. Il respecte le concept
+    //! `std::uniform_random_bit_generator`.
+    //!
+    //! ezgame::Random l'utilise à la place de Xoshiro256StarStar lorsque
+    //! `EZGAME_RANDOM_PCG32` est défini.
+    class Pcg32
+    {
+    public:
+        using result_type = uint32_t;
+
+        //! \brief Graine utilisée par le constructeur par défaut.
+        static constexpr uint64_t smDefaultSeed{ 0x45a7c3e1d2b4f609ull };
+
+        constexpr Pcg32() : Pcg32(smDefaultSeed) {}
+        constexpr explicit Pcg32(uint64_t seed) { this->seed(seed); }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        //! \brief Réinitialise l'état à partir de la graine donnée.
+        constexpr void seed(uint64_t seed)
+        {
+            SplitMix64 mix{ seed };
+            mIncrement = mix() | 1u;
+            mState = mix();
+            (*this)();
+        }
+
+        constexpr result_type operator()()
+        {
+            uint64_t const state{ mState };
+            mState = state * 6364136223846793005ull + mIncrement;
+            uint32_t const xorShifted{ static_cast<uint32_t>(((state >> 18) ^ state) >> 27) };
+            uint32_t const rotation{ static_cast<uint32_t>(state >> 59) };
+            return (xorShifted >> rotation) | (xorShifted << ((32 - rotation) & 31));
+        }
+
+    private:
+        uint64_t mState{};
+        uint64_t mIncrement{};
+    };
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_RANDOM_ENGINE_H_
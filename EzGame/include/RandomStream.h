@@ -0,0 +1,211 @@
+#pragma once
+#ifndef _EZGAME_RANDOM_STREAM_H_
+#define _EZGAME_RANDOM_STREAM_H_
+
+
+// Inclusion des bibliothèques
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include "Random.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class RandomStream
+    //!
+    //! \brief Suite de valeurs aléatoires déterminée par une clé
+    //! (graine, entité, tic), sans état partagé.
+    //!
+    //! \details Contrairement à Random, dont le générateur évolue à chaque
+    //! appel, une suite RandomStream est une fonction pure de sa clé : la
+    //! n-ième valeur tirée pour (graine, entité, tic) est toujours la même,
+    //! peu importe le fil d'exécution qui la tire, l'ordre de traitement des
+    //! entités ou le nombre de fils utilisés. Une simulation parallèle est
+    //! ainsi reproductible bit pour bit.
+    //!
+    //! Le générateur est Philox4x32-10 (Salmon et al., _Parallel Random
+    //! Numbers: As Easy as 1, 2, 3_) : chaque bloc de 4 valeurs de 32 bits
+    //! est obtenu en chiffrant le compteur (bloc, tic, entité) avec la
+    //! graine. L'objet ne conserve que la clé, le numéro du prochain bloc et
+    //! le bloc courant; il se crée sur la pile au besoin.
+    //!
+    //! Les méthodes reprennent celles de Random et utilisent les mêmes
+    //! conversions vers les distributions uniformes.
+    //!
+    //! Exemple d'utilisation :
+    //! \code
+    //!     // chaque entité tire ses valeurs de sa propre suite : le résultat
+    //!     // ne dépend pas du fil qui traite l'entité
+    //!     for (size_t entity{ first }; entity < last; ++entity) {
+    //!         RandomStream random(waveSeed, entity, tick);
+    //!         Vect2d position(random.real(0.0f, width), random.real(0.0f, height));
+    //!         Kind kind{ random.enumerator<Kind>() };
+    //!     }
+    //! \endcode
+    class RandomStream
+    {
+    public:
+        using result_type = uint32_t;
+        //! \brief Bloc de 4 valeurs produit par une évaluation de Philox.
+        using Block = std::array<uint32_t, 4>;
+
+        //! \brief Constructeur à partir de la clé de la suite.
+        //!
+        //! \param seed La graine de la simulation.
+        //! \param entity L'identifiant de l'entité.
+        //! \param tick Le tic (l'image) de la simulation.
+        RandomStream(uint64_t seed, uint64_t entity, uint32_t tick = 0);
+
+        //! \brief Retourne le bloc de rang donné de la suite (graine,
+        //! entité, tic), sans créer de suite.
+        static Block block(uint64_t seed, uint64_t entity, uint32_t tick, uint32_t index);
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+        //!
+        //! \brief Retourne la prochaine valeur de 32 bits de la suite.
+        result_type operator()();
+
+        bool event(float probability = 0.5f);
+        template <std::integral int_type> int_type integer();
+        template <std::integral int_type> int_type integer(int_type maximum);
+        template <std::integral int_type> int_type integer(int_type minimum, int_type maximum);
+        template <std::floating_point real_type> real_type real();
+        template <std::floating_point real_type> real_type real(real_type maximum);
+        template <std::floating_point real_type> real_type real(real_type minimum, real_type maximum);
+        template <Enumeration enum_type, Enumeration... enum_types>
+        enum_type enumerator(enum_type firstEnumerator, enum_types... allOtherEnumerators);
+        template <Enumeration enum_type>
+        enum_type enumerator(size_t enumeratorCount);
+        //!
+        //! \brief Génère un énumérateur d'une énumération terminée par
+        //! l'énumérateur de compte `__count__` (voir Random::enumerator).
+        template <CountedEnumeration enum_type>
+        enum_type enumerator();
+
+    private:
+        uint64_t mSeed;
+        uint64_t mEntity;
+        uint32_t mTick;
+        uint32_t mNextBlock{};
+        Block mBlock{};
+        uint32_t mAvailable{};
+    };
+
+
+
+
+
+
+
+
+
+
+
+    inline RandomStream::RandomStream(uint64_t seed, uint64_t entity, uint32_t tick)
+        : mSeed{ seed }, mEntity{ entity }, mTick{ tick }
+    {
+    }
+
+    inline RandomStream::Block RandomStream::block(uint64_t seed, uint64_t entity, uint32_t tick, uint32_t index)
+    {
+        uint32_t counter[4]{ index, tick, static_cast<uint32_t>(entity), static_cast<uint32_t>(entity >> 32) };
+        uint32_t key[2]{ static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32) };
+
+        // 10 rondes de Philox4x32.
+        for (int round{}; round < 10; ++round) {
+            uint64_t const product0{ uint64_t{ 0xD2511F53u } * counter[0] };
+            uint64_t const product1{ uint64_t{ 0xCD9E8D57u } * counter[2] };
+            uint32_t const next[4]{
+                static_cast<uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+                static_cast<uint32_t>(product1),
+                static_cast<uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+                static_cast<uint32_t>(product0) };
+            counter[0] = next[0];
+            counter[1] = next[1];
+            counter[2] = next[2];
+            counter[3] = next[3];
+            key[0] += 0x9E3779B9u;
+            key[1] += 0xBB67AE85u;
+        }
+
+        return Block{ counter[0], counter[1], counter[2], counter[3] };
+    }
+
+    inline RandomStream::result_type RandomStream::operator()()
+    {
+        if (mAvailable == 0) {
+            mBlock = block(mSeed, mEntity, mTick, mNextBlock++);
+            mAvailable = static_cast<uint32_t>(mBlock.size());
+        }
+        return mBlock[mBlock.size() - mAvailable--];
+    }
+
+    inline bool RandomStream::event(float probability)
+    {
+        return Random::unit<float>(*this) < probability;
+    }
+
+    template<std::integral int_type>
+    inline int_type RandomStream::integer()
+    {
+        return integer(std::numeric_limits<int_type>::min(), std::numeric_limits<int_type>::max());
+    }
+
+    template<std::integral int_type>
+    inline int_type RandomStream::integer(int_type maximum)
+    {
+        return integer(int_type{}, maximum);
+    }
+
+    template<std::integral int_type>
+    inline int_type RandomStream::integer(int_type minimum, int_type maximum)
+    {
+        return Random::bounded(*this, minimum, maximum);
+    }
+
+    template<std::floating_point real_type>
+    inline real_type RandomStream::real()
+    {
+        return real<real_type>(real_type{}, real_type{ 1.0 });
+    }
+
+    template<std::floating_point real_type>
+    inline real_type RandomStream::real(real_type maximum)
+    {
+        return real(real_type{}, maximum);
+    }
+
+    template<std::floating_point real_type>
+    inline real_type RandomStream::real(real_type minimum, real_type maximum)
+    {
+        return minimum + (maximum - minimum) * Random::unit<real_type>(*this);
+    }
+
+    template<Enumeration enum_type, Enumeration ...enum_types>
+    inline enum_type RandomStream::enumerator(enum_type firstEnumerator, enum_types ...allOtherEnumerators)
+    {
+        std::initializer_list<enum_type> values({ firstEnumerator, allOtherEnumerators... });
+        return *(values.begin() + integer<size_t>(0, values.size() - 1));
+    }
+
+    template<Enumeration enum_type>
+    inline enum_type RandomStream::enumerator(size_t enumeratorCount)
+    {
+        return static_cast<enum_type>(integer<size_t>(0, enumeratorCount - 1));
+    }
+
+    template<CountedEnumeration enum_type>
+    inline enum_type RandomStream::enumerator()
+    {
+        return enumerator<enum_type>(static_cast<size_t>(enum_type::__count__));
+    }
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_RANDOM_STREAM_H_
@@ -0,0 +1,94 @@
+#pragma once
+#ifndef _EZGAME_RASTERIZER_H_
+#define _EZGAME_RASTERIZER_H_
+
+
+// Inclusion des bibliothèques
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include "ColorRGBA8.h"
+#include "Framebuffer.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class Rasterizer
+    //!
+    //! \brief Rastériseur logiciel : dessine des cercles dans un
+    //! Framebuffer, sans processeur graphique ni fenêtre.
+    //!
+    //! \details Screen l'utilise lorsque le rendu logiciel est activé (voir
+    //! Application::setRasterized), ce qui permet d'obtenir de vraies images
+    //! sur un serveur ou une machine d'intégration continue.
+    //!
+    //! Un pixel appartient à un cercle si son centre est dans le cercle
+    //! (aucun anticrénelage). Le remplissage couvre le disque de rayon
+    //! `radius`; le contour couvre l'anneau entre `radius` et
+    //! `radius + edgeSize`. Les couleurs sont mélangées à l'image selon
+    //! leur transparence (`source * alpha + destination * (1 - alpha)`).
+    //!
+    //! L'image est découpée en tuiles carrées. Les cercles sont d'abord
+    //! répartis dans les tuiles qu'ils touchent, dans l'ordre du tableau;
+    //! chaque tuile est ensuite dessinée indépendamment, par plusieurs fils
+    //! d'exécution. Dans une tuile, chaque cercle est dessiné ligne par
+    //! ligne en segments horizontaux remplis par instructions SIMD.
+    class Rasterizer
+    {
+    public:
+        //! \brief Cercles à dessiner, rangés par composante. Les positions
+        //! sont celles des centres. Toutes les plages ont la même taille.
+        struct Circles
+        {
+            std::span<float const> xs;
+            std::span<float const> ys;
+            std::span<float const> radii;
+            std::span<float const> edgeSizes;
+            std::span<ColorRGBA8 const> fillColors;
+            std::span<ColorRGBA8 const> edgeColors;
+        };
+
+        //! \brief Taille (en pixels) du côté d'une tuile.
+        static constexpr size_t smTileSize{ 64 };
+
+        //! \brief Constructeur.
+        //!
+        //! \param threadCount Le nombre de fils d'exécution dessinant les
+        //! tuiles, incluant le fil appelant. 0 utilise un fil par cœur.
+        explicit Rasterizer(size_t threadCount = 0);
+        Rasterizer(Rasterizer const &) = delete;
+        Rasterizer& operator=(Rasterizer const &) = delete;
+        ~Rasterizer();
+
+        //! \brief Retourne le nombre de fils d'exécution, incluant le fil
+        //! appelant.
+        size_t threadCount() const;
+
+        //! \brief Dessine les cercles donnés, dans l'ordre, par-dessus le
+        //! contenu de l'image.
+        void render(Framebuffer & target, Circles const& circles);
+        //!
+        //! \brief Mélange d'abord la couleur donnée à toute l'image (voir
+        //! Screen::clear), puis dessine les cercles donnés.
+        void render(Framebuffer & target, ColorRGBA8 clearColor, Circles const& circles);
+
+        //! \brief Mélange la couleur donnée aux `count` pixels donnés.
+        //! Une couleur opaque remplace simplement les pixels.
+        static void fillSpan(ColorRGBA8 * pixels, size_t count, ColorRGBA8 color);
+        //!
+        //! \brief Mélange la couleur donnée aux `count` pixels donnés, la
+        //! transparence de chaque pixel étant multipliée par sa couverture
+        //! (0 à 255). Sert à copier les glyphes d'un GlyphAtlas.
+        static void blendMask(ColorRGBA8 * pixels, uint8_t const * coverage, size_t count, ColorRGBA8 color);
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> mImpl;
+    };
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_RASTERIZER_H_
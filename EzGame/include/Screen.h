@@ -4,9 +4,15 @@
 
 
 // Inclusion des bibliothèques
+#include <chrono>
 #include <memory>
+#include <string>
+#include <vector>
 #include "Color.h"
 #include "Circle.h"
+#include "CircleBatch.h"
+#include "DrawList.h"
+#include "Framebuffer.h"
 #include "Text.h"
 
 
@@ -25,7 +31,12 @@ namespace ezgame {
     //! Il est possible de :
     //!  - connaître la taille de la surface graphique (voir Screen::width et Screen::height)
     //!  - remplir la surface graphique d'une couleur uniforme (voir Screen::clear)
-    //!  - dessiner un objet Circle ou Text (voir Screen::draw)
+    //!  - dessiner un objet Circle, CircleBatch ou Text (voir Screen::draw)
+    //! 
+    //! Les primitives sont copiées dans une liste de commandes (voir 
+    //! DrawList) exécutée à la fin de l'image, éventuellement par un fil de 
+    //! rendu (voir Application::setPipelined). Un objet dessiné peut donc 
+    //! être modifié ou détruit dès le retour de Screen::draw.
     //! 
     class Screen
     {
@@ -37,6 +48,48 @@ namespace ezgame {
         //!
         //! \brief Retourne la hauteur de la surface graphique.
         size_t height() const;
+        //!
+        //! \brief Retourne le nombre d'appels au moteur de rendu de la 
+        //! dernière image exécutée.
+        //! 
+        //! \details Les commandes de dessin d'une image sont regroupées en 
+        //! lots avant d'être soumises : tous les cercles consécutifs (ou 
+        //! séparés seulement par des primitives qui ne les chevauchent pas) 
+        //! forment un seul appel, et les textes de même taille et de mêmes 
+        //! couleurs également. Un effacement compte pour un appel. Comparé 
+        //! à Screen::commandCount, ce nombre mesure l'efficacité du 
+        //! regroupement.
+        //! 
+        //! En mode pipeline (voir Application::setPipelined), la dernière 
+        //! image exécutée est généralement l'image précédente.
+        size_t drawCallCount() const;
+        //!
+        //! \brief Retourne le nombre de commandes de dessin enregistrées 
+        //! pour la dernière image exécutée.
+        size_t commandCount() const;
+        //!
+        //! \brief Retourne l'image de la dernière image exécutée, dessinée 
+        //! par le rendu logiciel (voir Application::setRasterized). L'image 
+        //! est vide si le rendu logiciel n'est pas activé.
+        //! 
+        //! \details En mode pipeline, cette fonction attend que le fil de 
+        //! rendu ait terminé l'image en cours.
+        Framebuffer const & framebuffer() const;
+        //!
+        //! \brief Retourne le nombre de textes dessinés par le rendu 
+        //! logiciel dont la mise en page a été trouvée dans le cache (voir 
+        //! TextCache), depuis le début de l'exécution.
+        //! 
+        //! \details Un texte identique (contenu, taille et alignement) à un 
+        //! texte d'une image précédente est dessiné par simple copie de ses 
+        //! glyphes. Les textes d'un affichage tête haute devraient presque 
+        //! toujours être trouvés.
+        size_t textCacheHitCount() const;
+        //!
+        //! \brief Retourne le nombre de textes dessinés par le rendu 
+        //! logiciel qui ont dû être mis en page, depuis le début de 
+        //! l'exécution.
+        size_t textCacheMissCount() const;
 
         // Mutateurs
         //!
@@ -51,6 +104,13 @@ namespace ezgame {
         //! \brief Dessine le cercle donné.
         void draw(Circle const& circle);
         //!
+        //! \brief Dessine tous les cercles de l'ensemble donné, dans 
+        //! l'ordre de leurs indices.
+        //! 
+        //! \details Équivaut à appeler Screen::draw pour chacun des cercles, 
+        //! mais en une seule soumission.
+        void draw(CircleBatch const& circles);
+        //!
         //! \brief Dessine le texte donné.
         void draw(Text const& text);
 
@@ -65,6 +125,23 @@ namespace ezgame {
         class Impl;
         std::unique_ptr<Impl> mImpl;
 
+        // Nombre total de primitives dessinées (rapport de performance).
+        size_t circleCount() const;
+        size_t textCount() const;
+        size_t totalDrawCallCount() const;
+        size_t totalCommandCount() const;
+        // Police utilisée par le rendu logiciel (vide si aucune).
+        std::string const & fontFileName() const;
+
+        // Exécution des listes de commandes, sur le fil principal ou sur le 
+        // fil de rendu, avec ou sans rendu logiciel. Screen::present exécute (ou transmet au fil de 
+        // rendu) la liste de l'image qui se termine.
+        void begin(bool pipelined, bool rasterized);
+        void present();
+        void end();
+        // Durée d'exécution de chacune des listes (rapport de performance).
+        std::vector<std::chrono::steady_clock::duration> const & renderTimes() const;
+
         friend class Application;
     };
 
@@ -0,0 +1,284 @@
+#pragma once
+#ifndef _EZGAME_SIMD_FLOAT_H_
+#define _EZGAME_SIMD_FLOAT_H_
+
+
+// Inclusion des bibliothèques
+#include <cmath>
+#include <cstddef>
+
+// Sélection du jeu d'instructions. La définition de EZGAME_NO_SIMD force
+// l'implémentation scalaire.
+//! \cond PRIVATE
+#if !defined(EZGAME_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define EZGAME_SIMD_SSE 1
+#include <immintrin.h>
+#endif
+#if defined(EZGAME_SIMD_SSE) && defined(__AVX__)
+#define EZGAME_SIMD_AVX 1
+#endif
+//! \endcond
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class Float4
+    //!
+    //! \brief Paquet de 4 réels traités simultanément.
+    //!
+    //! \details Les 4 valeurs sont conservées dans un registre SSE lorsque
+    //! le jeu d'instructions est disponible, sinon dans un tableau traité
+    //! valeur par valeur. Toutes les opérations agissent indépendamment sur
+    //! chacune des valeurs (_lanes_).
+    //!
+    //! Cette classe sert de brique de base à ezgame::Vect2dx4.
+    class Float4
+    {
+    public:
+        //! \brief Nombre de valeurs du paquet.
+        static constexpr size_t size{ 4 };
+
+        //! \brief Constructeur par défaut. Toutes les valeurs sont nulles.
+        Float4();
+        //!
+        //! \brief Constructeur donnant la même valeur à tout le paquet.
+        Float4(float value);
+
+        //! \brief Charge 4 valeurs consécutives (sans contrainte
+        //! d'alignement).
+        static Float4 load(float const * values);
+        //!
+        //! \brief Écrit les 4 valeurs consécutivement (sans contrainte
+        //! d'alignement).
+        void store(float * values) const;
+        //!
+        //! \brief Retourne la valeur à la position donnée [0, 3].
+        float operator[](size_t lane) const;
+
+        Float4 operator-() const;
+        Float4& operator+=(Float4 const& other);
+        Float4& operator-=(Float4 const& other);
+        Float4& operator*=(Float4 const& other);
+        Float4& operator/=(Float4 const& other);
+        friend Float4 operator+(Float4 a, Float4 const& b) { return a += b; }
+        friend Float4 operator-(Float4 a, Float4 const& b) { return a -= b; }
+        friend Float4 operator*(Float4 a, Float4 const& b) { return a *= b; }
+        friend Float4 operator/(Float4 a, Float4 const& b) { return a /= b; }
+
+        //! \brief Racine carrée de chaque valeur.
+        friend Float4 sqrt(Float4 const& value);
+        //! \brief Minimum de chaque paire de valeurs.
+        friend Float4 minimum(Float4 const& a, Float4 const& b);
+        //! \brief Maximum de chaque paire de valeurs.
+        friend Float4 maximum(Float4 const& a, Float4 const& b);
+        //! \brief Inverse (1 / x) de chaque valeur, ou 0 lorsque la valeur
+        //! n'est pas strictement positive.
+        friend Float4 reciprocalOrZero(Float4 const& value);
+        //! \brief Partie entière (arrondie vers zéro) de chaque valeur. Les
+        //! valeurs doivent être comprises entre -2^31 et 2^31.
+        friend Float4 truncate(Float4 const& value);
+        //! \brief Pour chaque valeur, retourne `ifLess` lorsque `a < b`,
+        //! sinon `otherwise`.
+        friend Float4 selectLess(Float4 const& a, Float4 const& b, Float4 const& ifLess, Float4 const& otherwise);
+        //! \brief Pour chaque valeur, retourne `ifEqual` lorsque `a == b`,
+        //! sinon `otherwise`.
+        friend Float4 selectEqual(Float4 const& a, Float4 const& b, Float4 const& ifEqual, Float4 const& otherwise);
+
+    private:
+#if defined(EZGAME_SIMD_SSE)
+        explicit Float4(__m128 value) : mValue{ value } {}
+        __m128 mValue;
+#else
+        float mValue[size];
+#endif
+    };
+
+
+    //! \class Float8
+    //!
+    //! \brief Paquet de 8 réels traités simultanément.
+    //!
+    //! \details Les 8 valeurs sont conservées dans un registre AVX lorsque
+    //! le jeu d'instructions est disponible, sinon dans deux paquets
+    //! ezgame::Float4.
+    //!
+    //! Cette classe sert de brique de base à ezgame::Vect2dx8.
+    class Float8
+    {
+    public:
+        //! \brief Nombre de valeurs du paquet.
+        static constexpr size_t size{ 8 };
+
+        //! \brief Constructeur par défaut. Toutes les valeurs sont nulles.
+        Float8();
+        //!
+        //! \brief Constructeur donnant la même valeur à tout le paquet.
+        Float8(float value);
+
+        //! \brief Charge 8 valeurs consécutives (sans contrainte
+        //! d'alignement).
+        static Float8 load(float const * values);
+        //!
+        //! \brief Écrit les 8 valeurs consécutivement (sans contrainte
+        //! d'alignement).
+        void store(float * values) const;
+        //!
+        //! \brief Retourne la valeur à la position donnée [0, 7].
+        float operator[](size_t lane) const;
+
+        Float8 operator-() const;
+        Float8& operator+=(Float8 const& other);
+        Float8& operator-=(Float8 const& other);
+        Float8& operator*=(Float8 const& other);
+        Float8& operator/=(Float8 const& other);
+        friend Float8 operator+(Float8 a, Float8 const& b) { return a += b; }
+        friend Float8 operator-(Float8 a, Float8 const& b) { return a -= b; }
+        friend Float8 operator*(Float8 a, Float8 const& b) { return a *= b; }
+        friend Float8 operator/(Float8 a, Float8 const& b) { return a /= b; }
+
+        //! \brief Racine carrée de chaque valeur.
+        friend Float8 sqrt(Float8 const& value);
+        //! \brief Minimum de chaque paire de valeurs.
+        friend Float8 minimum(Float8 const& a, Float8 const& b);
+        //! \brief Maximum de chaque paire de valeurs.
+        friend Float8 maximum(Float8 const& a, Float8 const& b);
+        //! \brief Inverse (1 / x) de chaque valeur, ou 0 lorsque la valeur
+        //! n'est pas strictement positive.
+        friend Float8 reciprocalOrZero(Float8 const& value);
+        //! \brief Partie entière (arrondie vers zéro) de chaque valeur. Les
+        //! valeurs doivent être comprises entre -2^31 et 2^31.
+        friend Float8 truncate(Float8 const& value);
+        //! \brief Pour chaque valeur, retourne `ifLess` lorsque `a < b`,
+        //! sinon `otherwise`.
+        friend Float8 selectLess(Float8 const& a, Float8 const& b, Float8 const& ifLess, Float8 const& otherwise);
+        //! \brief Pour chaque valeur, retourne `ifEqual` lorsque `a == b`,
+        //! sinon `otherwise`.
+        friend Float8 selectEqual(Float8 const& a, Float8 const& b, Float8 const& ifEqual, Float8 const& otherwise);
+
+    private:
+#if defined(EZGAME_SIMD_AVX)
+        explicit Float8(__m256 value) : mValue{ value } {}
+        __m256 mValue;
+#else
+        Float8(Float4 const& low, Float4 const& high) : mLow{ low }, mHigh{ high } {}
+        Float4 mLow;
+        Float4 mHigh;
+#endif
+    };
+
+
+
+
+
+
+
+
+
+
+
+#if defined(EZGAME_SIMD_SSE)
+
+    inline Float4::Float4() : mValue{ _mm_setzero_ps() } {}
+    inline Float4::Float4(float value) : mValue{ _mm_set1_ps(value) } {}
+    inline Float4 Float4::load(float const * values) { return Float4(_mm_loadu_ps(values)); }
+    inline void Float4::store(float * values) const { _mm_storeu_ps(values, mValue); }
+    inline float Float4::operator[](size_t lane) const { float values[size]; store(values); return values[lane]; }
+    inline Float4 Float4::operator-() const { return Float4(_mm_sub_ps(_mm_setzero_ps(), mValue)); }
+    inline Float4& Float4::operator+=(Float4 const& other) { mValue = _mm_add_ps(mValue, other.mValue); return *this; }
+    inline Float4& Float4::operator-=(Float4 const& other) { mValue = _mm_sub_ps(mValue, other.mValue); return *this; }
+    inline Float4& Float4::operator*=(Float4 const& other) { mValue = _mm_mul_ps(mValue, other.mValue); return *this; }
+    inline Float4& Float4::operator/=(Float4 const& other) { mValue = _mm_div_ps(mValue, other.mValue); return *this; }
+    inline Float4 sqrt(Float4 const& value) { return Float4(_mm_sqrt_ps(value.mValue)); }
+    inline Float4 minimum(Float4 const& a, Float4 const& b) { return Float4(_mm_min_ps(a.mValue, b.mValue)); }
+    inline Float4 maximum(Float4 const& a, Float4 const& b) { return Float4(_mm_max_ps(a.mValue, b.mValue)); }
+    inline Float4 reciprocalOrZero(Float4 const& value) {
+        __m128 const positive{ _mm_cmpgt_ps(value.mValue, _mm_setzero_ps()) };
+        return Float4(_mm_and_ps(positive, _mm_div_ps(_mm_set1_ps(1.0f), value.mValue)));
+    }
+    inline Float4 truncate(Float4 const& value) { return Float4(_mm_cvtepi32_ps(_mm_cvttps_epi32(value.mValue))); }
+    inline Float4 selectLess(Float4 const& a, Float4 const& b, Float4 const& ifLess, Float4 const& otherwise) {
+        __m128 const less{ _mm_cmplt_ps(a.mValue, b.mValue) };
+        return Float4(_mm_or_ps(_mm_and_ps(less, ifLess.mValue), _mm_andnot_ps(less, otherwise.mValue)));
+    }
+    inline Float4 selectEqual(Float4 const& a, Float4 const& b, Float4 const& ifEqual, Float4 const& otherwise) {
+        __m128 const equal{ _mm_cmpeq_ps(a.mValue, b.mValue) };
+        return Float4(_mm_or_ps(_mm_and_ps(equal, ifEqual.mValue), _mm_andnot_ps(equal, otherwise.mValue)));
+    }
+
+#else
+
+    inline Float4::Float4() : mValue{} {}
+    inline Float4::Float4(float value) : mValue{ value, value, value, value } {}
+    inline Float4 Float4::load(float const * values) { Float4 result; for (size_t i{}; i < size; ++i) { result.mValue[i] = values[i]; } return result; }
+    inline void Float4::store(float * values) const { for (size_t i{}; i < size; ++i) { values[i] = mValue[i]; } }
+    inline float Float4::operator[](size_t lane) const { return mValue[lane]; }
+    inline Float4 Float4::operator-() const { Float4 result; for (size_t i{}; i < size; ++i) { result.mValue[i] = -mValue[i]; } return result; }
+    inline Float4& Float4::operator+=(Float4 const& other) { for (size_t i{}; i < size; ++i) { mValue[i] += other.mValue[i]; } return *this; }
+    inline Float4& Float4::operator-=(Float4 const& other) { for (size_t i{}; i < size; ++i) { mValue[i] -= other.mValue[i]; } return *this; }
+    inline Float4& Float4::operator*=(Float4 const& other) { for (size_t i{}; i < size; ++i) { mValue[i] *= other.mValue[i]; } return *this; }
+    inline Float4& Float4::operator/=(Float4 const& other) { for (size_t i{}; i < size; ++i) { mValue[i] /= other.mValue[i]; } return *this; }
+    inline Float4 sqrt(Float4 const& value) { Float4 result; for (size_t i{}; i < Float4::size; ++i) { result.mValue[i] = std::sqrt(value.mValue[i]); } return result; }
+    inline Float4 minimum(Float4 const& a, Float4 const& b) { Float4 result; for (size_t i{}; i < Float4::size; ++i) { result.mValue[i] = a.mValue[i] < b.mValue[i] ? a.mValue[i] : b.mValue[i]; } return result; }
+    inline Float4 maximum(Float4 const& a, Float4 const& b) { Float4 result; for (size_t i{}; i < Float4::size; ++i) { result.mValue[i] = a.mValue[i] > b.mValue[i] ? a.mValue[i] : b.mValue[i]; } return result; }
+    inline Float4 reciprocalOrZero(Float4 const& value) { Float4 result; for (size_t i{}; i < Float4::size; ++i) { result.mValue[i] = value.mValue[i] > 0.0f ? 1.0f / value.mValue[i] : 0.0f; } return result; }
+    inline Float4 truncate(Float4 const& value) { Float4 result; for (size_t i{}; i < Float4::size; ++i) { result.mValue[i] = static_cast<float>(static_cast<int>(value.mValue[i])); } return result; }
+    inline Float4 selectLess(Float4 const& a, Float4 const& b, Float4 const& ifLess, Float4 const& otherwise) { Float4 result; for (size_t i{}; i < Float4::size; ++i) { result.mValue[i] = a.mValue[i] < b.mValue[i] ? ifLess.mValue[i] : otherwise.mValue[i]; } return result; }
+    inline Float4 selectEqual(Float4 const& a, Float4 const& b, Float4 const& ifEqual, Float4 const& otherwise) { Float4 result; for (size_t i{}; i < Float4::size; ++i) { result.mValue[i] = a.mValue[i] == b.mValue[i] ? ifEqual.mValue[i] : otherwise.mValue[i]; } return result; }
+
+#endif
+
+
+#if defined(EZGAME_SIMD_AVX)
+
+    inline Float8::Float8() : mValue{ _mm256_setzero_ps() } {}
+    inline Float8::Float8(float value) : mValue{ _mm256_set1_ps(value) } {}
+    inline Float8 Float8::load(float const * values) { return Float8(_mm256_loadu_ps(values)); }
+    inline void Float8::store(float * values) const { _mm256_storeu_ps(values, mValue); }
+    inline float Float8::operator[](size_t lane) const { float values[size]; store(values); return values[lane]; }
+    inline Float8 Float8::operator-() const { return Float8(_mm256_sub_ps(_mm256_setzero_ps(), mValue)); }
+    inline Float8& Float8::operator+=(Float8 const& other) { mValue = _mm256_add_ps(mValue, other.mValue); return *this; }
+    inline Float8& Float8::operator-=(Float8 const& other) { mValue = _mm256_sub_ps(mValue, other.mValue); return *this; }
+    inline Float8& Float8::operator*=(Float8 const& other) { mValue = _mm256_mul_ps(mValue, other.mValue); return *this; }
+    inline Float8& Float8::operator/=(Float8 const& other) { mValue = _mm256_div_ps(mValue, other.mValue); return *this; }
+    inline Float8 sqrt(Float8 const& value) { return Float8(_mm256_sqrt_ps(value.mValue)); }
+    inline Float8 minimum(Float8 const& a, Float8 const& b) { return Float8(_mm256_min_ps(a.mValue, b.mValue)); }
+    inline Float8 maximum(Float8 const& a, Float8 const& b) { return Float8(_mm256_max_ps(a.mValue, b.mValue)); }
+    inline Float8 reciprocalOrZero(Float8 const& value) {
+        __m256 const positive{ _mm256_cmp_ps(value.mValue, _mm256_setzero_ps(), _CMP_GT_OQ) };
+        return Float8(_mm256_and_ps(positive, _mm256_div_ps(_mm256_set1_ps(1.0f), value.mValue)));
+    }
+    inline Float8 truncate(Float8 const& value) { return Float8(_mm256_round_ps(value.mValue, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)); }
+    inline Float8 selectLess(Float8 const& a, Float8 const& b, Float8 const& ifLess, Float8 const& otherwise) {
+        return Float8(_mm256_blendv_ps(otherwise.mValue, ifLess.mValue, _mm256_cmp_ps(a.mValue, b.mValue, _CMP_LT_OQ)));
+    }
+    inline Float8 selectEqual(Float8 const& a, Float8 const& b, Float8 const& ifEqual, Float8 const& otherwise) {
+        return Float8(_mm256_blendv_ps(otherwise.mValue, ifEqual.mValue, _mm256_cmp_ps(a.mValue, b.mValue, _CMP_EQ_OQ)));
+    }
+
+#else
+
+    inline Float8::Float8() : mLow{}, mHigh{} {}
+    inline Float8::Float8(float value) : mLow{ value }, mHigh{ value } {}
+    inline Float8 Float8::load(float const * values) { return Float8(Float4::load(values), Float4::load(values + Float4::size)); }
+    inline void Float8::store(float * values) const { mLow.store(values); mHigh.store(values + Float4::size); }
+    inline float Float8::operator[](size_t lane) const { return lane < Float4::size ? mLow[lane] : mHigh[lane - Float4::size]; }
+    inline Float8 Float8::operator-() const { return Float8(-mLow, -mHigh); }
+    inline Float8& Float8::operator+=(Float8 const& other) { mLow += other.mLow; mHigh += other.mHigh; return *this; }
+    inline Float8& Float8::operator-=(Float8 const& other) { mLow -= other.mLow; mHigh -= other.mHigh; return *this; }
+    inline Float8& Float8::operator*=(Float8 const& other) { mLow *= other.mLow; mHigh *= other.mHigh; return *this; }
+    inline Float8& Float8::operator/=(Float8 const& other) { mLow /= other.mLow; mHigh /= other.mHigh; return *this; }
+    inline Float8 sqrt(Float8 const& value) { return Float8(sqrt(value.mLow), sqrt(value.mHigh)); }
+    inline Float8 minimum(Float8 const& a, Float8 const& b) { return Float8(minimum(a.mLow, b.mLow), minimum(a.mHigh, b.mHigh)); }
+    inline Float8 maximum(Float8 const& a, Float8 const& b) { return Float8(maximum(a.mLow, b.mLow), maximum(a.mHigh, b.mHigh)); }
+    inline Float8 reciprocalOrZero(Float8 const& value) { return Float8(reciprocalOrZero(value.mLow), reciprocalOrZero(value.mHigh)); }
+    inline Float8 truncate(Float8 const& value) { return Float8(truncate(value.mLow), truncate(value.mHigh)); }
+    inline Float8 selectLess(Float8 const& a, Float8 const& b, Float8 const& ifLess, Float8 const& otherwise) { return Float8(selectLess(a.mLow, b.mLow, ifLess.mLow, otherwise.mLow), selectLess(a.mHigh, b.mHigh, ifLess.mHigh, otherwise.mHigh)); }
+    inline Float8 selectEqual(Float8 const& a, Float8 const& b, Float8 const& ifEqual, Float8 const& otherwise) { return Float8(selectEqual(a.mLow, b.mLow, ifEqual.mLow, otherwise.mLow), selectEqual(a.mHigh, b.mHigh, ifEqual.mHigh, otherwise.mHigh)); }
+
+#endif
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_SIMD_FLOAT_H_
@@ -4,7 +4,10 @@
 
 
 //#include "Graphical.h"
+#include <array>
+#include <cstddef>
 #include <string>
+#include <string_view>
 #include "Vect2d.h"
 #include "Alignment.h"
 #include "Color.h"
@@ -19,10 +22,33 @@ namespace ezgame {
     //! 
     //! \details Cette classe est l'un des deux objets pouvant être affiché à l'écran. 
     //! 
-    //! Documentation à venir...
+    //! Un texte est défini par sa chaîne de caractères, sa taille en
+    //! pixels, sa position, son alignement, sa couleur de remplissage et
+    //! son contour (couleur et épaisseur). La position est celle du point
+    //! désigné par l'alignement (voir Alignment) : le début de la ligne de
+    //! base pour Alignment::BaseLeft, le coin supérieur gauche du rectangle
+    //! englobant pour Alignment::TopLeft, etc. La taille du texte et
+    //! l'épaisseur du contour ne sont jamais négatives.
+    //! 
+    //! Avec la bibliothèque construite à partir de `EzGame/src`
+    //! (`EZGAME_HEADLESS`), un texte d'au plus Text::smInlineCapacity
+    //! caractères est rangé dans l'objet lui-même : le modifier, le copier
+    //! ou le dessiner n'alloue aucune mémoire. Les nombres (voir
+    //! Text::setText) sont convertis directement dans ce tampon. Si le
+    //! nouveau texte est identique à l'ancien, rien n'est modifié, et sa
+    //! mise en page est retrouvée telle quelle par le rendu (voir
+    //! TextCache).
     class Text
     {
     public:
+        //! \brief Nombre maximal de caractères (octets) rangés dans l'objet.
+        //! Un texte plus long est rangé dans une chaîne allouée.
+        static constexpr size_t smInlineCapacity{ 32 };
+
+        //! \brief Constructeur par défaut : texte vide de taille
+        //! Text::smMinimumTextSize, à l'origine, aligné sur la ligne de base
+        //! à gauche, de la couleur par défaut (voir Color::Color) et sans
+        //! contour.
         Text();
         Text(std::string const & text, float textSize, Vect2d const& position, Color const color, Alignment alignment = Alignment::BaseLeft);
         Text(std::string const & text, float textSize, Vect2d const& position, Color const fillColor, Color const edgeColor, float edgeSize, Alignment alignment = Alignment::BaseLeft);
@@ -31,6 +57,10 @@ namespace ezgame {
         ~Text() = default;
 
         std::string text() const;
+        //!
+        //! \brief Retourne le texte sans le copier. La vue reste valide
+        //! jusqu'à la prochaine modification du texte.
+        std::string_view textView() const;
         float textSize() const;
         Vect2d position() const;
         Alignment alignment() const;
@@ -42,8 +72,14 @@ namespace ezgame {
         // to do : textHeight
 
         void setText(std::string const& text);
+        //!
+        //! \brief Remplace le texte par le nombre donné, en notation
+        //! décimale.
         void setText(size_t number);
         void setText(int number);
+        //!
+        //! \brief Remplace le texte par le nombre donné, avec `precision`
+        //! chiffres après le point décimal.
         void setText(float number, size_t precision = 3);
         void setText(std::string const& text, float textSize);
         void setTextSize(float textSize);
@@ -57,16 +93,49 @@ namespace ezgame {
         void setColors(Color const& fillColor, Color const& edgeColor, float edgeSize);
 
     private:
+        // Taille minimale du texte : une taille négative est ramenée à 0,
+        // comme l'épaisseur du contour.
         static float const smMinimumTextSize;
+#if defined(EZGAME_HEADLESS)
+        // Le texte est dans mInlineText si sa longueur le permet, sinon
+        // dans mLongText (vidé, sans libérer sa mémoire, dans le cas
+        // contraire).
+        std::array<char, smInlineCapacity> mInlineText{};
+        size_t mLength{};
+        std::string mLongText;
+#else
+        // Disposition de la bibliothèque précompilée.
         std::string mText;
+#endif
         float mTextSize;
         Vect2d mPosition;
         Alignment mAlignment;
         Color mFillColor;
         Color mEdgeColor;
         float mEdgeSize;
+
+        void assign(std::string_view text);
     };
 
+
+
+
+
+
+
+
+
+
+
+    inline std::string_view Text::textView() const
+    {
+#if defined(EZGAME_HEADLESS)
+        return mLength <= smInlineCapacity ? std::string_view(mInlineText.data(), mLength) : std::string_view(mLongText);
+#else
+        return mText;
+#endif
+    }
+
 } // namespace ezgame
 
 
@@ -0,0 +1,131 @@
+#pragma once
+#ifndef _EZGAME_TEXT_CACHE_H_
+#define _EZGAME_TEXT_CACHE_H_
+
+
+// Inclusion des bibliothèques
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Alignment.h"
+#include "Font.h"
+#include "GlyphAtlas.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class TextCache
+    //!
+    //! \brief Textes mis en page, conservés d'une image à l'autre.
+    //!
+    //! \details La mise en page d'un texte (décodage UTF-8, recherche des
+    //! glyphes, avances, boîte englobante et alignement) est faite une
+    //! seule fois pour chaque combinaison de texte, de taille et
+    //! d'alignement. Le résultat (Run) est une liste de rectangles de
+    //! l'atlas de la taille du texte (voir GlyphAtlas) et de leurs
+    //! positions par rapport à la position du texte : dessiner un texte
+    //! déjà mis en page se résume à copier ces rectangles.
+    //!
+    //! Les textes d'un affichage tête haute (pointage, images par seconde)
+    //! changent rarement et sont presque toujours trouvés dans le cache. Le
+    //! nombre de succès et d'échecs est compté (voir TextCache::hitCount et
+    //! TextCache::missCount).
+    //!
+    //! Le cache contient au plus TextCache::capacity textes : lorsqu'il
+    //! déborde, TextCache::trim le vide entièrement. Les atlas sont
+    //! conservés.
+    class TextCache
+    {
+    public:
+        //! \brief Rectangle de l'atlas à copier. (`x`, `y`) est la position
+        //! du coin supérieur gauche, en pixels, par rapport à la position
+        //! du texte arrondie au pixel le plus proche.
+        struct Quad
+        {
+            int x;
+            int y;
+            uint16_t atlasX;
+            uint16_t atlasY;
+            uint16_t width;
+            uint16_t height;
+        };
+
+        //! \brief Texte mis en page. La boîte englobante des glyphes est
+        //! donnée par rapport à la position du texte, alignement compris.
+        struct Run
+        {
+            GlyphAtlas const * atlas;
+            std::vector<Quad> quads;
+            float left;
+            float top;
+            float right;
+            float bottom;
+        };
+
+        //! \brief Capacité par défaut (en textes).
+        static constexpr size_t smDefaultCapacity{ 1024 };
+
+        //! \brief Crée un cache vide, sans police.
+        explicit TextCache(size_t capacity = smDefaultCapacity);
+        TextCache(TextCache const &) = delete;
+        TextCache& operator=(TextCache const &) = delete;
+        ~TextCache();
+
+        //! \brief Charge la police du fichier donné. Le cache et les atlas
+        //! sont vidés.
+        //!
+        //! \return Vrai si la police a été chargée (voir Font::load).
+        bool load(std::string const& fontFileName);
+        //!
+        //! \brief Retourne vrai si une police est chargée.
+        bool isLoaded() const;
+        Font const & font() const;
+
+        size_t capacity() const;
+        //!
+        //! \brief Retourne le nombre de textes mis en page dans le cache.
+        size_t size() const;
+        //!
+        //! \brief Retourne le nombre d'atlas (un par taille de texte).
+        size_t atlasCount() const;
+        //!
+        //! \brief Retourne le nombre total de glyphes dans les atlas.
+        size_t glyphCount() const;
+        //!
+        //! \brief Retourne le nombre de textes trouvés dans le cache par
+        //! TextCache::run.
+        size_t hitCount() const;
+        //!
+        //! \brief Retourne le nombre de textes mis en page par
+        //! TextCache::run (absents du cache).
+        size_t missCount() const;
+
+        //! \brief Retourne le texte mis en page, en le mettant en page s'il
+        //! est absent du cache. Le texte est lu en UTF-8; un octet invalide
+        //! est lu en Latin-1. Un saut de ligne commence une nouvelle ligne.
+        //!
+        //! \details La référence retournée reste valide jusqu'au prochain
+        //! appel à TextCache::trim ou TextCache::load. Sans police, le
+        //! texte retourné est vide.
+        Run const & run(std::string_view text, float size, Alignment alignment);
+
+        //! \brief Vide le cache s'il contient plus de TextCache::capacity
+        //! textes. À appeler entre deux images.
+        void trim();
+        //!
+        //! \brief Remet les compteurs de succès et d'échecs à zéro.
+        void resetCounters();
+
+    private:
+        class Impl;
+        std::unique_ptr<Impl> mImpl;
+    };
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_TEXT_CACHE_H_
@@ -22,11 +22,32 @@ namespace ezgame {
     //!  - en :
     //!    - milliseconde (un nombre entier de 64 bits)
     //!    - seconde (un nombre réel de 32 bits)
-    //!  - une estimation du nombre de tics par seconde.
+    //!  - une estimation du nombre de tics par seconde;
+    //!  - la distribution des temps écoulés entre les _n_ derniers tics 
+    //!    (centiles, maximum, gigue et nombre de tics hors budget).
+    //!
+    //! \details Les temps écoulés des _n_ derniers tics sont rangés dans un 
+    //! histogramme à précision relative constante (64 classes par 
+    //! puissance de 2, soit une erreur d'au plus 1,6 %), de 0 à 
+    //! Timer::smMaximumTicTime. Chaque tic ajoute son temps et retire celui 
+    //! du tic sorti de la fenêtre en temps constant : consulter les 
+    //! statistiques à chaque image ne coûte que le parcours de 
+    //! l'histogramme (Timer::percentile).
+    //!
+    //! La taille de la fenêtre et le budget par tic se règlent par 
+    //! Application::setTimerWindow et Application::setFrameBudget.
     //!
     class Timer
     {
     public:
+        //! \brief Plus long temps écoulé mesuré par les statistiques (en 
+        //! microseconde, environ 33 s). Un tic plus long est compté comme 
+        //! ayant cette durée.
+        static constexpr int64_t smMaximumTicTime{ (int64_t{ 1 } << 25) - 1 };
+        //! \brief Plus grande fenêtre de tics (voir 
+        //! Application::setTimerWindow).
+        static constexpr size_t smMaximumWindowSize{ 16384 };
+
         //!
         //! \brief Retourne le temps écoulé depuis le dernier tic en 
         //! microseconde.
@@ -41,6 +62,11 @@ namespace ezgame {
         //! \details Le temps donné est celui depuis la création de 
         //! l'application (objet Application) et non depuis l'appel de 
         //! la fonction Application::run.
+        //! 
+        //! Avec un pas de simulation fixe (voir 
+        //! Application::setFixedTimestep) ou pendant la relecture d'une 
+        //! session (voir Application::setReplayFile), le temps donné est la 
+        //! somme des temps écoulés imposés à chaque tic.
         int64_t sinceStartup() const;
         //!
         //! \brief Retourne le temps écoulé depuis le dernier tic en 
@@ -71,8 +97,41 @@ namespace ezgame {
         //! écoulé entre chacun des _n_ derniers tics. Ainsi, les _n_ 
         //! premières évaluations sont approximatives et biaisées. 
         //! 
-        //! La valeur _n_ est par défaut 1000.
+        //! La valeur _n_ est par défaut 1000 (voir 
+        //! Application::setTimerWindow).
         float fpsEstimation() const;
+        //!
+        //! \brief Retourne le centile `p` (dans [0, 1]) du temps écoulé 
+        //! entre les _n_ derniers tics en microseconde, par exemple 
+        //! `percentile(0.99)`.
+        //! 
+        //! \details La valeur retournée est la borne supérieure de la classe 
+        //! de l'histogramme contenant le centile (au plus 1,6 % de trop), 
+        //! sans dépasser Timer::max. Retourne 0 avant le premier tic.
+        int64_t percentile(double p) const;
+        //!
+        //! \brief Retourne le plus long temps écoulé entre les _n_ derniers 
+        //! tics en microseconde (exact).
+        int64_t max() const;
+        //!
+        //! \brief Retourne la gigue, soit l'écart type du temps écoulé entre 
+        //! les _n_ derniers tics, en microseconde.
+        float jitter() const;
+        //!
+        //! \brief Retourne le nombre de tics, parmi les _n_ derniers, dont le 
+        //! temps écoulé dépasse le budget (voir Timer::frameBudget).
+        size_t overBudgetCount() const;
+        //!
+        //! \brief Retourne le budget par tic en microseconde (par défaut, 
+        //! 16 667 us, soit 60 tics par seconde).
+        int64_t frameBudget() const;
+        //!
+        //! \brief Retourne la taille _n_ de la fenêtre des statistiques.
+        size_t windowSize() const;
+        //!
+        //! \brief Retourne le nombre de tics présents dans la fenêtre (au 
+        //! plus Timer::windowSize).
+        size_t windowTicCount() const;
 
     private:
         Timer(size_t framesUsedForFPS = 1000);
@@ -88,6 +147,14 @@ namespace ezgame {
         std::unique_ptr<Impl> mImpl;
 
         void tic();
+        // Tic dont le temps écoulé est imposé (pas de simulation fixe ou 
+        // relecture d'une session, voir InputRecording). Le temps depuis le 
+        // démarrage devient alors la somme des temps imposés.
+        void tic(int64_t sinceLastTic);
+        void updateWindow();
+        // Vide la fenêtre et lui donne la taille donnée.
+        void setWindowSize(size_t ticCount);
+        void setFrameBudget(int64_t microseconds);
     };
 
 } // namespace ezgame
@@ -4,9 +4,27 @@
 
 
 // Inclusion des bibliothèques
+#include <cmath>
+#include <cstddef>
 #include <random>
 #include <string>
+#include <string_view>
 #include <iostream>
+#if __has_include(<format>)
+#include <format>
+#endif
+#include "FastMath.h"
+
+
+// Les opérations arithmétiques sont définies en ligne (et constexpr) avec
+// la bibliothèque construite à partir de EzGame/src. La bibliothèque
+// précompilée (sans EZGAME_HEADLESS) exporte déjà ces opérations : elles
+// n'y sont que déclarées.
+#if defined(EZGAME_HEADLESS)
+#define EZGAME_VECT2D_CONSTEXPR constexpr
+#else
+#define EZGAME_VECT2D_CONSTEXPR
+#endif
 
 
 // Déclaration du namespace ezgame
@@ -21,15 +39,49 @@ namespace ezgame {
 	//! - outil de calcul vectoriel
 	//! - représenter une position dans l'esapce (un point)
 	//! 
+	//! Les opérations arithmétiques (accesseurs, opérateurs, longueur, 
+	//! distance, orientation, ...) sont définies en ligne dans ce fichier 
+	//! afin que le compilateur puisse les intégrer dans les boucles de 
+	//! calcul du moteur de jeu. Seules la génération aléatoire et la mise 
+	//! en forme textuelle sont définies dans la librairie. Avec la 
+	//! librairie précompilée (sans `EZGAME_HEADLESS`), ces opérations 
+	//! restent celles de la librairie.
+	//! 
+	//! Les variantes `...Fast` (normalizeFast, orientationFast, 
+	//! fromPolarFast, ...) utilisent les approximations de FastMath plutôt 
+	//! que les fonctions de la bibliothèque standard. Elles conviennent 
+	//! lorsque la pleine précision n'est pas requise (voir FastMath pour 
+	//! les erreurs maximales).
+	//! 
+	//! La mise en forme textuelle (toString, formatTo, operator<<) utilise 
+	//! un préfixe, un séparateur, un suffixe et une précision. Ces réglages 
+	//! sont propres à chaque fil d'exécution (`thread_local`) : les 
+	//! modifier n'affecte pas les autres fils. formatTo accepte aussi des 
+	//! réglages ponctuels (Vect2d::Format) et n'alloue jamais de mémoire.
+	//! 
 	//! Documentation à venir...
 	class Vect2d
 	{
 	public:
-		Vect2d();
-		Vect2d(float x, float y);
-		Vect2d(Vect2d const& other) = default;
-		Vect2d& operator=(Vect2d const& other) = default;
-		~Vect2d() = default;
+		//! \brief Réglages de mise en forme textuelle d'un vecteur.
+		//! 
+		//! \details Les chaînes ne sont pas copiées : elles doivent rester 
+		//! valides durant l'appel de formatTo.
+		struct Format
+		{
+			std::string_view prefix{ "(" };
+			std::string_view separator{ ", " };
+			std::string_view suffix{ ")" };
+			//! Nombre de décimales affichées, limité à 
+			//! [0, Vect2d::smMaximumPrecision].
+			int precision{ 3 };
+		};
+
+		EZGAME_VECT2D_CONSTEXPR Vect2d();
+		EZGAME_VECT2D_CONSTEXPR Vect2d(float x, float y);
+		constexpr Vect2d(Vect2d const& other) = default;
+		constexpr Vect2d& operator=(Vect2d const& other) = default;
+		constexpr ~Vect2d() = default;
 
 		static Vect2d fromPolar(float length, float orientation);
 		static Vect2d fromNormalized(float orientation);
@@ -37,28 +89,35 @@ namespace ezgame {
 		static Vect2d fromRandomized(float xMin, float xMax, float yMin, float yMax);
 		static Vect2d fromPolarRandomized(float lengthMin, float lengthMax);
 		static Vect2d fromPolarRandomized(float lengthMin, float lengthMax, float oriMin, float oriMax);
+		static Vect2d fromPolarFast(float length, float orientation);
+		static Vect2d fromNormalizedFast(float orientation);
 
 		bool isDefined() const;
 		bool isNormalized() const;
 
-		float x() const;
-		float y() const;
-		void setX(float x);
-		void setY(float y);
-		void set(float x, float y);
+		EZGAME_VECT2D_CONSTEXPR float x() const;
+		EZGAME_VECT2D_CONSTEXPR float y() const;
+		EZGAME_VECT2D_CONSTEXPR void setX(float x);
+		EZGAME_VECT2D_CONSTEXPR void setY(float y);
+		EZGAME_VECT2D_CONSTEXPR void set(float x, float y);
 
-		float squaredLength() const;
+		EZGAME_VECT2D_CONSTEXPR float squaredLength() const;
 		float length() const;
 		float orientation() const;
 		void setSquaredLength(float squaredLength);
 		void setLength(float length);
 		void setOrientation(float orientation);
 		void setPolar(float length, float orientation);
+		float orientationFast() const;
 
+		//! \brief Retourne le vecteur de même orientation et de longueur 1.
+		//! Le vecteur doit être défini (voir isDefined).
 		Vect2d normalized() const;
 		void normalize();
+		Vect2d normalizedFast() const;
+		void normalizeFast();
 
-		float squaredDistance(Vect2d const& other) const;
+		EZGAME_VECT2D_CONSTEXPR float squaredDistance(Vect2d const& other) const;
 		float distance(Vect2d const& other) const;
 
 		void randomize();
@@ -67,21 +126,43 @@ namespace ezgame {
 		void randomizePolar(float lengthMin, float lengthMax, float oriMin, float oriMax);
 
 		std::string toString() const;
+		//! 
+		//! \brief Écrit le vecteur dans le tampon donné, sans allocation.
+		//! 
+		//! \details Le texte est suivi d'un caractère nul. Les réglages du 
+		//! fil d'exécution courant sont utilisés, sauf si un Format est 
+		//! donné.
+		//! 
+		//! \return Le nombre de caractères écrits (sans le caractère nul) 
+		//! ou 0 si le tampon est trop petit. Un tampon de 
+		//! Vect2d::smFormatBufferSize caractères suffit pour les réglages 
+		//! par défaut.
+		//! 
+		//! Exemple d'utilisation :
+		//! \code
+		//!     char buffer[Vect2d::smFormatBufferSize];
+		//!     size_t length{ position.formatTo(buffer, sizeof(buffer)) };
+		//!     size_t compact{ position.formatTo(buffer, sizeof(buffer), { "", " ", "", 1 }) };
+		//! \endcode
+		size_t formatTo(char * buffer, size_t size) const;
+		size_t formatTo(char * buffer, size_t size, Format const& format) const;
 
 		bool operator==(Vect2d const& other) const;
 		bool operator!=(Vect2d const& other) const;
 
-		Vect2d operator+(Vect2d other) const;
-		Vect2d operator-(Vect2d other) const;
-		Vect2d operator*(float scalar) const;
-		Vect2d operator/(float scalar) const;
-		friend Vect2d operator*(float scalar, Vect2d const& other);
-		friend Vect2d operator/(float scalar, Vect2d const& other);
+		EZGAME_VECT2D_CONSTEXPR Vect2d operator+(Vect2d other) const;
+		EZGAME_VECT2D_CONSTEXPR Vect2d operator-(Vect2d other) const;
+		EZGAME_VECT2D_CONSTEXPR Vect2d operator*(float scalar) const;
+		EZGAME_VECT2D_CONSTEXPR Vect2d operator/(float scalar) const;
+		friend EZGAME_VECT2D_CONSTEXPR Vect2d operator*(float scalar, Vect2d const& other);
+		//! \brief Équivalent à `other / scalar`, comme `scalar * other` 
+		//! équivaut à `other * scalar`.
+		friend EZGAME_VECT2D_CONSTEXPR Vect2d operator/(float scalar, Vect2d const& other);
 
-		Vect2d& operator+=(Vect2d const& other);
-		Vect2d& operator-=(Vect2d const& other);
-		Vect2d& operator*=(float scalar);
-		Vect2d& operator/=(float scalar);
+		EZGAME_VECT2D_CONSTEXPR Vect2d& operator+=(Vect2d const& other);
+		EZGAME_VECT2D_CONSTEXPR Vect2d& operator-=(Vect2d const& other);
+		EZGAME_VECT2D_CONSTEXPR Vect2d& operator*=(float scalar);
+		EZGAME_VECT2D_CONSTEXPR Vect2d& operator/=(float scalar);
 
 		friend std::ostream& operator<<(std::ostream& stream, Vect2d const& vector);
 
@@ -92,16 +173,34 @@ namespace ezgame {
 		static void setSeparator(std::string const& separator);
 		static void setSuffix(std::string const& suffix);
 		static void setFormat(std::string const& prefix, std::string const& separator, std::string const& suffix);
+		static size_t precision();
+		//! 
+		//! \brief Modifie le nombre de décimales affichées, limité à 
+		//! Vect2d::smMaximumPrecision.
+		static void setPrecision(size_t precision);
+		//! 
+		//! \brief Retourne les réglages du fil d'exécution courant. Les 
+		//! chaînes restent valides jusqu'à leur prochaine modification.
+		static Format format();
+
+		//! \brief Nombre maximal de décimales affichées. Au-delà, les 
+		//! décimales d'un float ne sont plus significatives.
+		static constexpr size_t smMaximumPrecision{ 20 };
+		//! 
+		//! \brief Taille de tampon suffisante pour formatTo avec les 
+		//! préfixe, séparateur et suffixe par défaut, toute précision et 
+		//! toute valeur finie.
+		static constexpr size_t smFormatBufferSize{ 128 };
 
 		static float epsilon();
 		static void setEpsilon(float epsilon);
 
 	private:
 		static float smEpsilon;
-		static size_t smPrecision;
-		static std::string smPrefix;
-		static std::string smSeparator;
-		static std::string smSuffix;
+		static thread_local size_t smPrecision;
+		static thread_local std::string smPrefix;
+		static thread_local std::string smSeparator;
+		static thread_local std::string smSuffix;
 
 		float mX;
 		float mY;
@@ -110,6 +209,277 @@ namespace ezgame {
 		static bool floatsApproxEqual(float a, float b, float epsilon);
 	};
 
+
+
+
+
+
+
+
+
+
+
+
+#if defined(EZGAME_HEADLESS)
+	inline constexpr Vect2d::Vect2d()
+		: mX{}, mY{}
+	{
+	}
+
+	inline constexpr Vect2d::Vect2d(float x, float y)
+		: mX{ x }, mY{ y }
+	{
+	}
+
+	inline Vect2d Vect2d::fromPolar(float length, float orientation)
+	{
+		return Vect2d(length * std::cos(orientation), length * std::sin(orientation));
+	}
+
+	inline Vect2d Vect2d::fromNormalized(float orientation)
+	{
+		return fromPolar(1.0f, orientation);
+	}
+
+	inline bool Vect2d::isDefined() const
+	{
+		return !floatsApproxZero(mX, smEpsilon) || !floatsApproxZero(mY, smEpsilon);
+	}
+
+	inline bool Vect2d::isNormalized() const
+	{
+		return floatsApproxEqual(squaredLength(), 1.0f, smEpsilon);
+	}
+
+	inline constexpr float Vect2d::x() const
+	{
+		return mX;
+	}
+
+	inline constexpr float Vect2d::y() const
+	{
+		return mY;
+	}
+
+	inline constexpr void Vect2d::setX(float x)
+	{
+		mX = x;
+	}
+
+	inline constexpr void Vect2d::setY(float y)
+	{
+		mY = y;
+	}
+
+	inline constexpr void Vect2d::set(float x, float y)
+	{
+		mX = x;
+		mY = y;
+	}
+
+	inline constexpr float Vect2d::squaredLength() const
+	{
+		return mX * mX + mY * mY;
+	}
+
+	inline float Vect2d::length() const
+	{
+		return std::sqrt(squaredLength());
+	}
+
+	inline float Vect2d::orientation() const
+	{
+		return std::atan2(mY, mX);
+	}
+
+	inline void Vect2d::setSquaredLength(float squaredLength)
+	{
+		setLength(std::sqrt(squaredLength));
+	}
+
+	inline void Vect2d::setLength(float length)
+	{
+		setPolar(length, orientation());
+	}
+
+	inline void Vect2d::setOrientation(float orientation)
+	{
+		setPolar(length(), orientation);
+	}
+
+	inline void Vect2d::setPolar(float length, float orientation)
+	{
+		*this = fromPolar(length, orientation);
+	}
+
+	inline Vect2d Vect2d::normalized() const
+	{
+		return *this / length();
+	}
+
+	inline void Vect2d::normalize()
+	{
+		*this = normalized();
+	}
+
+	inline constexpr float Vect2d::squaredDistance(Vect2d const& other) const
+	{
+		return (other - *this).squaredLength();
+	}
+
+	inline float Vect2d::distance(Vect2d const& other) const
+	{
+		return std::sqrt(squaredDistance(other));
+	}
+
+	inline bool Vect2d::operator==(Vect2d const& other) const
+	{
+		return floatsApproxEqual(mX, other.mX, smEpsilon) && floatsApproxEqual(mY, other.mY, smEpsilon);
+	}
+
+	inline bool Vect2d::operator!=(Vect2d const& other) const
+	{
+		return !(*this == other);
+	}
+
+	inline constexpr Vect2d Vect2d::operator+(Vect2d other) const
+	{
+		return Vect2d(mX + other.mX, mY + other.mY);
+	}
+
+	inline constexpr Vect2d Vect2d::operator-(Vect2d other) const
+	{
+		return Vect2d(mX - other.mX, mY - other.mY);
+	}
+
+	inline constexpr Vect2d Vect2d::operator*(float scalar) const
+	{
+		return Vect2d(mX * scalar, mY * scalar);
+	}
+
+	inline constexpr Vect2d Vect2d::operator/(float scalar) const
+	{
+		return Vect2d(mX / scalar, mY / scalar);
+	}
+
+	inline constexpr Vect2d operator*(float scalar, Vect2d const& other)
+	{
+		return other * scalar;
+	}
+
+	inline constexpr Vect2d operator/(float scalar, Vect2d const& other)
+	{
+		return other / scalar;
+	}
+
+	inline constexpr Vect2d& Vect2d::operator+=(Vect2d const& other)
+	{
+		mX += other.mX;
+		mY += other.mY;
+		return *this;
+	}
+
+	inline constexpr Vect2d& Vect2d::operator-=(Vect2d const& other)
+	{
+		mX -= other.mX;
+		mY -= other.mY;
+		return *this;
+	}
+
+	inline constexpr Vect2d& Vect2d::operator*=(float scalar)
+	{
+		mX *= scalar;
+		mY *= scalar;
+		return *this;
+	}
+
+	inline constexpr Vect2d& Vect2d::operator/=(float scalar)
+	{
+		mX /= scalar;
+		mY /= scalar;
+		return *this;
+	}
+
+	inline float Vect2d::epsilon()
+	{
+		return smEpsilon;
+	}
+
+	inline void Vect2d::setEpsilon(float epsilon)
+	{
+		smEpsilon = std::abs(epsilon);
+	}
+
+	inline bool Vect2d::floatsApproxZero(float a, float epsilon)
+	{
+		return std::abs(a) <= epsilon;
+	}
+
+	inline bool Vect2d::floatsApproxEqual(float a, float b, float epsilon)
+	{
+		return floatsApproxZero(a - b, epsilon);
+	}
+#endif
+
+	inline Vect2d Vect2d::fromPolarFast(float length, float orientation)
+	{
+		float sine, cosine;
+		FastMath::sincos(orientation, sine, cosine);
+		return Vect2d(length * cosine, length * sine);
+	}
+
+	inline Vect2d Vect2d::fromNormalizedFast(float orientation)
+	{
+		return fromPolarFast(1.0f, orientation);
+	}
+
+	inline float Vect2d::orientationFast() const
+	{
+		return FastMath::atan2(mY, mX);
+	}
+
+	inline Vect2d Vect2d::normalizedFast() const
+	{
+		return *this * FastMath::inverseSqrt(squaredLength());
+	}
+
+	inline void Vect2d::normalizeFast()
+	{
+		*this = normalizedFast();
+	}
+
 } // namespace ezgame
 
+
+#if defined(__cpp_lib_format)
+//! \brief Mise en forme de Vect2d avec std::format, selon les réglages du 
+//! fil d'exécution courant. Aucune allocation n'est faite au-delà de celles 
+//! de la destination, sauf si le texte dépasse Vect2d::smFormatBufferSize 
+//! (réglages très longs) : comme operator<<, le texte est alors obtenu par 
+//! Vect2d::toString.
+template <>
+struct std::formatter<ezgame::Vect2d, char>
+{
+	constexpr auto parse(std::format_parse_context & context)
+	{
+		return context.begin();
+	}
+
+	template <typename FormatContext>
+	auto format(ezgame::Vect2d const& vector, FormatContext & context) const
+	{
+		char buffer[ezgame::Vect2d::smFormatBufferSize];
+		size_t const length{ vector.formatTo(buffer, sizeof(buffer)) };
+		if (length > 0) {
+			return std::copy(buffer, buffer + length, context.out());
+		}
+		std::string const text{ vector.toString() };
+		return std::copy(text.begin(), text.end(), context.out());
+	}
+};
+#endif
+
+
+#undef EZGAME_VECT2D_CONSTEXPR
+
 #endif // _EZGAME_VECT_2_D_H_
\ No newline at end of file
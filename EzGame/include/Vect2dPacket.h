@@ -0,0 +1,300 @@
+#pragma once
+#ifndef _EZGAME_VECT_2_D_PACKET_H_
+#define _EZGAME_VECT_2_D_PACKET_H_
+
+
+// Inclusion des bibliothèques
+#include <cmath>
+#include <cstddef>
+#include "SimdFloat.h"
+#include "Vect2d.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    //! \class Vect2dPacket
+    //!
+    //! \brief Paquet de vecteurs 2d traités simultanément.
+    //!
+    //! \details Un paquet contient `FloatN::size` vecteurs stockés par
+    //! composantes : toutes les coordonnées x dans un registre, toutes les
+    //! coordonnées y dans un autre. Chaque opération s'applique donc en
+    //! une seule instruction à tous les vecteurs du paquet.
+    //!
+    //! Les opérations reprennent celles de la classe Vect2d.
+    //!
+    //! Les types à utiliser sont :
+    //!  - ezgame::Vect2dx4 : 4 vecteurs (SSE)
+    //!  - ezgame::Vect2dx8 : 8 vecteurs (AVX)
+    //!
+    //! Sans jeu d'instructions SIMD disponible, le même code utilise une
+    //! implémentation scalaire (voir ezgame::Float4).
+    //!
+    //! Exemple d'utilisation :
+    //! \code
+    //!     // déplace n projectiles stockés dans des tableaux de x et de y
+    //!     for (size_t i{}; i + Vect2dx8::size <= n; i += Vect2dx8::size) {
+    //!         Vect2dx8 position{ Vect2dx8::load(xs + i, ys + i) };
+    //!         Vect2dx8 speed{ Vect2dx8::load(vxs + i, vys + i) };
+    //!         position += speed * dt;
+    //!         position.store(xs + i, ys + i);
+    //!     }
+    //! \endcode
+    //!
+    //! \tparam FloatN Le paquet de réels utilisé pour chaque composante
+    //! (ezgame::Float4 ou ezgame::Float8).
+    template <typename FloatN>
+    class Vect2dPacket
+    {
+    public:
+        //! \brief Nombre de vecteurs du paquet.
+        static constexpr size_t size{ FloatN::size };
+
+        //! \brief Constructeur par défaut. Tous les vecteurs sont nuls.
+        Vect2dPacket() = default;
+        //!
+        //! \brief Constructeur à partir des composantes.
+        Vect2dPacket(FloatN const& x, FloatN const& y);
+        //!
+        //! \brief Constructeur donnant le même vecteur à tout le paquet.
+        explicit Vect2dPacket(Vect2d const& vector);
+
+        //! \brief Charge les vecteurs depuis deux tableaux contigus de
+        //! coordonnées (par exemple CircleBatch::xs et CircleBatch::ys).
+        static Vect2dPacket load(float const * xs, float const * ys);
+        //!
+        //! \brief Charge les vecteurs depuis un tableau contigu de Vect2d.
+        static Vect2dPacket load(Vect2d const * vectors);
+        //!
+        //! \brief Crée les vecteurs à partir de coordonnées polaires.
+        static Vect2dPacket fromPolar(FloatN const& length, FloatN const& orientation);
+
+        //! \brief Écrit les vecteurs dans deux tableaux contigus de
+        //! coordonnées.
+        void store(float * xs, float * ys) const;
+        //!
+        //! \brief Écrit les vecteurs dans un tableau contigu de Vect2d.
+        void store(Vect2d * vectors) const;
+
+        FloatN const& x() const;
+        FloatN const& y() const;
+        void setX(FloatN const& x);
+        void setY(FloatN const& y);
+        void set(FloatN const& x, FloatN const& y);
+        //!
+        //! \brief Retourne le vecteur à la position donnée du paquet.
+        Vect2d operator[](size_t lane) const;
+
+        FloatN squaredLength() const;
+        FloatN length() const;
+        //!
+        //! \brief Retourne les vecteurs normalisés. Les vecteurs nuls
+        //! restent nuls.
+        Vect2dPacket normalized() const;
+        void normalize();
+
+        FloatN squaredDistance(Vect2dPacket const& other) const;
+        FloatN distance(Vect2dPacket const& other) const;
+
+        Vect2dPacket operator+(Vect2dPacket const& other) const;
+        Vect2dPacket operator-(Vect2dPacket const& other) const;
+        Vect2dPacket operator*(FloatN const& scalar) const;
+        Vect2dPacket operator/(FloatN const& scalar) const;
+        friend Vect2dPacket operator*(FloatN const& scalar, Vect2dPacket const& other) { return other * scalar; }
+
+        Vect2dPacket& operator+=(Vect2dPacket const& other);
+        Vect2dPacket& operator-=(Vect2dPacket const& other);
+        Vect2dPacket& operator*=(FloatN const& scalar);
+        Vect2dPacket& operator/=(FloatN const& scalar);
+
+    private:
+        FloatN mX;
+        FloatN mY;
+    };
+
+    //! \brief Paquet de 4 vecteurs 2d.
+    using Vect2dx4 = Vect2dPacket<Float4>;
+    //! \brief Paquet de 8 vecteurs 2d.
+    using Vect2dx8 = Vect2dPacket<Float8>;
+
+
+
+
+
+
+
+
+
+
+
+    template <typename FloatN>
+    inline Vect2dPacket<FloatN>::Vect2dPacket(FloatN const& x, FloatN const& y)
+        : mX{ x }, mY{ y }
+    {
+    }
+
+    template <typename FloatN>
+    inline Vect2dPacket<FloatN>::Vect2dPacket(Vect2d const& vector)
+        : mX{ vector.x() }, mY{ vector.y() }
+    {
+    }
+
+    template <typename FloatN>
+    inline Vect2dPacket<FloatN> Vect2dPacket<FloatN>::load(float const * xs, float const * ys) {
+        return Vect2dPacket(FloatN::load(xs), FloatN::load(ys));
+    }
+
+    template <typename FloatN>
+    inline Vect2dPacket<FloatN> Vect2dPacket<FloatN>::load(Vect2d const * vectors) {
+        float xs[size];
+        float ys[size];
+        for (size_t i{}; i < size; ++i) {
+            xs[i] = vectors[i].x();
+            ys[i] = vectors[i].y();
+        }
+        return load(xs, ys);
+    }
+
+    template <typename FloatN>
+    inline Vect2dPacket<FloatN> Vect2dPacket<FloatN>::fromPolar(FloatN const& length, FloatN const& orientation) {
+        float angles[size];
+        float xs[size];
+        float ys[size];
+        orientation.store(angles);
+        for (size_t i{}; i < size; ++i) {
+            xs[i] = std::cos(angles[i]);
+            ys[i] = std::sin(angles[i]);
+        }
+        return Vect2dPacket(FloatN::load(xs) * length, FloatN::load(ys) * length);
+    }
+
+    template <typename FloatN>
+    inline void Vect2dPacket<FloatN>::store(float * xs, float * ys) const {
+        mX.store(xs);
+        mY.store(ys);
+    }
+
+    template <typename FloatN>
+    inline void Vect2dPacket<FloatN>::store(Vect2d * vectors) const {
+        float xs[size];
+        float ys[size];
+        store(xs, ys);
+        for (size_t i{}; i < size; ++i) {
+            vectors[i].set(xs[i], ys[i]);
+        }
+    }
+
+    template <typename FloatN>
+    inline FloatN const& Vect2dPacket<FloatN>::x() const {
+        return mX;
+    }
+
+    template <typename FloatN>
+    inline FloatN const& Vect2dPacket<FloatN>::y() const {
+        return mY;
+    }
+
+    template <typename FloatN>
+    inline void Vect2dPacket<FloatN>::setX(FloatN const& x) {
+        mX = x;
+    }
+
+    template <typename FloatN>
+    inline void Vect2dPacket<FloatN>::setY(FloatN const& y) {
+        mY = y;
+    }
+
+    template <typename FloatN>
+    inline void Vect2dPacket<FloatN>::set(FloatN const& x, FloatN const& y) {
+        mX = x;
+        mY = y;
+    }
+
+    template <typename FloatN>
+    inline Vect2d Vect2dPacket<FloatN>::operator[](size_t lane) const {
+        return Vect2d(mX[lane], mY[lane]);
+    }
+
+    template <typename FloatN>
+    inline FloatN Vect2dPacket<FloatN>::squaredLength() const {
+        return mX * mX + mY * mY;
+    }
+
+    template <typename FloatN>
+    inline FloatN Vect2dPacket<FloatN>::length() const {
+        return sqrt(squaredLength());
+    }
+
+    template <typename FloatN>
+    inline Vect2dPacket<FloatN> Vect2dPacket<FloatN>::normalized() const {
+        return *this * reciprocalOrZero(length());
+    }
+
+    template <typename FloatN>
+    inline void Vect2dPacket<FloatN>::normalize() {
+        *this = normalized();
+    }
+
+    template <typename FloatN>
+    inline FloatN Vect2dPacket<FloatN>::squaredDistance(Vect2dPacket const& other) const {
+        return (other - *this).squaredLength();
+    }
+
+    template <typename FloatN>
+    inline FloatN Vect2dPacket<FloatN>::distance(Vect2dPacket const& other) const {
+        return sqrt(squaredDistance(other));
+    }
+
+    template <typename FloatN>
+    inline Vect2dPacket<FloatN> Vect2dPacket<FloatN>::operator+(Vect2dPacket const& other) const {
+        return Vect2dPacket(mX + other.mX, mY + other.mY);
+    }
+
+    template <typename FloatN>
+    inline Vect2dPacket<FloatN> Vect2dPacket<FloatN>::operator-(Vect2dPacket const& other) const {
+        return Vect2dPacket(mX - other.mX, mY - other.mY);
+    }
+
+    template <typename FloatN>
+    inline Vect2dPacket<FloatN> Vect2dPacket<FloatN>::operator*(FloatN const& scalar) const {
+        return Vect2dPacket(mX * scalar, mY * scalar);
+    }
+
+    template <typename FloatN>
+    inline Vect2dPacket<FloatN> Vect2dPacket<FloatN>::operator/(FloatN const& scalar) const {
+        return Vect2dPacket(mX / scalar, mY / scalar);
+    }
+
+    template <typename FloatN>
+    inline Vect2dPacket<FloatN>& Vect2dPacket<FloatN>::operator+=(Vect2dPacket const& other) {
+        mX += other.mX;
+        mY += other.mY;
+        return *this;
+    }
+
+    template <typename FloatN>
+    inline Vect2dPacket<FloatN>& Vect2dPacket<FloatN>::operator-=(Vect2dPacket const& other) {
+        mX -= other.mX;
+        mY -= other.mY;
+        return *this;
+    }
+
+    template <typename FloatN>
+    inline Vect2dPacket<FloatN>& Vect2dPacket<FloatN>::operator*=(FloatN const& scalar) {
+        mX *= scalar;
+        mY *= scalar;
+        return *this;
+    }
+
+    template <typename FloatN>
+    inline Vect2dPacket<FloatN>& Vect2dPacket<FloatN>::operator/=(FloatN const& scalar) {
+        mX /= scalar;
+        mY /= scalar;
+        return *this;
+    }
+
+} // namespace ezgame
+
+
+#endif // _EZGAME_VECT_2_D_PACKET_H_
@@ -0,0 +1,120 @@
+// Remplacement compté des opérateurs new et delete globaux
+// (EZGAME_COUNT_ALLOCATIONS).
+//
+// Le compteur est un atomique relâché : son coût est celui d'une addition
+// atomique par allocation. Les variantes avec alignement imposé
+// (std::align_val_t) gardent leur implémentation par défaut et ne sont pas
+// comptées.
+
+
+// Inclusion des bibliothèques
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    namespace {
+
+        std::atomic<size_t> allocationCount{};
+
+    } // namespace
+
+    bool AllocationCounter::isEnabled() noexcept
+    {
+#if defined(EZGAME_COUNT_ALLOCATIONS)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    size_t AllocationCounter::count() noexcept
+    {
+        return allocationCount.load(std::memory_order_relaxed);
+    }
+
+#if defined(EZGAME_COUNT_ALLOCATIONS)
+    namespace {
+
+        void * countedAllocation(size_t size) noexcept
+        {
+            allocationCount.fetch_add(1, std::memory_order_relaxed);
+            return std::malloc(size > 0 ? size : 1);
+        }
+
+        void * countedAllocationOrThrow(size_t size)
+        {
+            while (true) {
+                if (void * pointer{ countedAllocation(size) }) {
+                    return pointer;
+                }
+                std::new_handler const handler{ std::get_new_handler() };
+                if (!handler) {
+                    throw std::bad_alloc();
+                }
+                handler();
+            }
+        }
+
+    } // namespace
+#endif
+
+} // namespace ezgame
+
+
+#if defined(EZGAME_COUNT_ALLOCATIONS)
+void * operator new(size_t size)
+{
+    return ezgame::countedAllocationOrThrow(size);
+}
+
+void * operator new[](size_t size)
+{
+    return ezgame::countedAllocationOrThrow(size);
+}
+
+void * operator new(size_t size, std::nothrow_t const &) noexcept
+{
+    return ezgame::countedAllocation(size);
+}
+
+void * operator new[](size_t size, std::nothrow_t const &) noexcept
+{
+    return ezgame::countedAllocation(size);
+}
+
+void operator delete(void * pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void * pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void * pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void * pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void * pointer, std::nothrow_t const &) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void * pointer, std::nothrow_t const &) noexcept
+{
+    std::free(pointer);
+}
+#endif
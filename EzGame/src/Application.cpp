@@ -0,0 +1,597 @@
+// Implémentation sans fenêtre (headless) de la classe Application.
+//
+// Cette implémentation n'ouvre aucune fenêtre et ne dépend d'aucune 
+// bibliothèque graphique. Elle exécute le moteur de jeu pendant un nombre 
+// fixe d'images puis affiche un rapport de performance sur la sortie 
+// d'erreur standard. Elle sert à mesurer le débit d'un moteur de jeu sur 
+// une machine de compilation (Linux) et à y détecter les régressions.
+
+
+// Inclusion des bibliothèques
+#include "Application.h"
+#include "AllocationCounter.h"
+#include "FixedTimestep.h"
+#include "Keyboard.h"
+#include "Timer.h"
+#include "Screen.h"
+#include "InputRecording.h"
+#include "PerformanceOverlay.h"
+#include "Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    namespace {
+
+        using Clock = std::chrono::steady_clock;
+
+        size_t const smMinimumSize{ 64 };
+        size_t const smMaximumSize{ 2048 };
+        size_t const smDefaultFrameLimit{ 1000 };
+
+        size_t defaultFrameLimit()
+        {
+            char const * value{ std::getenv("EZGAME_FRAME_LIMIT") };
+            return value ? static_cast<size_t>(std::strtoull(value, nullptr, 10)) : smDefaultFrameLimit;
+        }
+
+        std::string environment(char const * name)
+        {
+            char const * value{ std::getenv(name) };
+            return value ? std::string(value) : std::string();
+        }
+
+        double toMicroseconds(Clock::duration duration)
+        {
+            return std::chrono::duration<double, std::micro>(duration).count();
+        }
+
+        // Retourne le centile p (dans [0, 1]) des durées données. Le vecteur 
+        // est réordonné partiellement.
+        double percentile(std::vector<Clock::duration> & durations, double p)
+        {
+            if (durations.empty()) {
+                return 0.0;
+            }
+
+            auto nth{ durations.begin() + static_cast<std::ptrdiff_t>(p * static_cast<double>(durations.size() - 1)) };
+            std::nth_element(durations.begin(), nth, durations.end());
+            return toMicroseconds(*nth);
+        }
+
+    } // namespace
+
+    //! \cond PRIVATE
+    class Application::Impl
+    {
+    public:
+        explicit Impl(Application & app)
+            : screen{ app }
+        {
+        }
+
+        size_t width{};
+        size_t height{};
+        std::string title;
+        std::string iconFileName;
+        size_t frameLimit{ defaultFrameLimit() };
+
+        // Pas de simulation fixe (désactivé : une image par pas de 
+        // simulation).
+        FixedTimestep fixedTimestep;
+        size_t pendingSteps{};
+        size_t stepCount{};
+
+        // Exécution de l'affichage sur un fil de rendu.
+        bool pipelined{ environment("EZGAME_PIPELINED") == "1" };
+
+        // Rendu logiciel et capture de la dernière image.
+        std::string captureFile{ environment("EZGAME_CAPTURE") };
+        bool rasterized{ environment("EZGAME_RASTERIZE") == "1" || !captureFile.empty() };
+
+        // Enregistrement et relecture des entrées.
+        std::string recordFile{ environment("EZGAME_RECORD") };
+        std::string replayFile{ environment("EZGAME_REPLAY") };
+        bool replayRealTime{};
+        bool replaying{};
+        size_t replayIndex{};
+        InputRecording recording;
+
+        // Exportation du profil des dernières images.
+        std::string profileFile{ environment("EZGAME_PROFILE") };
+        size_t profileFrameCount{ 300 };
+        size_t profileSaveCount{};
+
+        // Surcouche de performance et chronomètre des images (un tic par 
+        // image, quel que soit le nombre de pas de simulation).
+        bool overlayVisible{ environment("EZGAME_OVERLAY") == "1" };
+        PerformanceOverlay overlay;
+        Timer frameTimer;
+        size_t drawnCircleCount{};
+        size_t drawnTextCount{};
+        Clock::duration overlayTime{};
+        size_t overlayFrameCount{};
+
+        Keyboard keyboard;
+        Timer timer;
+        Screen screen;
+
+        // Mesures de chaque image (boucle complète et chacune des phases).
+        size_t frameIndex{};
+        Clock::time_point start;
+        Clock::time_point frameStart;
+        Clock::time_point eventsEnd;
+        std::vector<Clock::duration> frameTimes;
+        std::vector<Clock::duration> eventsTimes;
+        std::vector<Clock::duration> displayTimes;
+    };
+    //! \endcond
+
+    Application::Application()
+        : mImpl{ std::make_unique<Impl>(*this) }
+    {
+    }
+
+    Application::~Application() = default;
+
+    size_t Application::width() const
+    {
+        return mImpl->width;
+    }
+
+    size_t Application::height() const
+    {
+        return mImpl->height;
+    }
+
+    std::string Application::title() const
+    {
+        return mImpl->title;
+    }
+
+    std::string Application::iconFileName() const
+    {
+        return mImpl->iconFileName;
+    }
+
+    size_t Application::frameLimit() const
+    {
+        return mImpl->frameLimit;
+    }
+
+    void Application::setFrameLimit(size_t frameCount)
+    {
+        mImpl->frameLimit = frameCount;
+    }
+
+    int64_t Application::fixedTimestep() const
+    {
+        return mImpl->fixedTimestep.step();
+    }
+
+    size_t Application::maxStepsPerFrame() const
+    {
+        return mImpl->fixedTimestep.maxStepsPerFrame();
+    }
+
+    void Application::setFixedTimestep(int64_t stepMicroseconds, size_t maxStepsPerFrame)
+    {
+        mImpl->fixedTimestep = FixedTimestep(stepMicroseconds, maxStepsPerFrame);
+    }
+
+    size_t Application::timerWindow() const
+    {
+        return mImpl->timer.windowSize();
+    }
+
+    int64_t Application::frameBudget() const
+    {
+        return mImpl->timer.frameBudget();
+    }
+
+    void Application::setTimerWindow(size_t ticCount)
+    {
+        mImpl->timer.setWindowSize(ticCount);
+        mImpl->frameTimer.setWindowSize(ticCount);
+    }
+
+    void Application::setFrameBudget(int64_t microseconds)
+    {
+        mImpl->timer.setFrameBudget(microseconds);
+        mImpl->frameTimer.setFrameBudget(microseconds);
+    }
+
+    bool Application::isPipelined() const
+    {
+        return mImpl->pipelined;
+    }
+
+    void Application::setPipelined(bool pipelined)
+    {
+        mImpl->pipelined = pipelined;
+    }
+
+    bool Application::isRasterized() const
+    {
+        return mImpl->rasterized;
+    }
+
+    std::string Application::captureFile() const
+    {
+        return mImpl->captureFile;
+    }
+
+    void Application::setRasterized(bool rasterized)
+    {
+        mImpl->rasterized = rasterized;
+    }
+
+    bool Application::isOverlayVisible() const
+    {
+        return mImpl->overlayVisible;
+    }
+
+    void Application::setOverlayVisible(bool visible)
+    {
+        if (visible != mImpl->overlayVisible) {
+            mImpl->overlay.reset();
+        }
+        mImpl->overlayVisible = visible;
+    }
+
+    void Application::setCaptureFile(std::string const & fileName)
+    {
+        mImpl->captureFile = fileName;
+        mImpl->rasterized = mImpl->rasterized || !fileName.empty();
+    }
+
+    std::string Application::recordFile() const
+    {
+        return mImpl->recordFile;
+    }
+
+    std::string Application::replayFile() const
+    {
+        return mImpl->replayFile;
+    }
+
+    bool Application::isReplayRealTime() const
+    {
+        return mImpl->replayRealTime;
+    }
+
+    void Application::setRecordFile(std::string const & fileName)
+    {
+        mImpl->recordFile = fileName;
+    }
+
+    void Application::setReplayFile(std::string const & fileName, bool realTime)
+    {
+        mImpl->replayFile = fileName;
+        mImpl->replayRealTime = realTime;
+    }
+
+    std::string Application::profileFile() const
+    {
+        return mImpl->profileFile;
+    }
+
+    size_t Application::profileFrameCount() const
+    {
+        return mImpl->profileFrameCount;
+    }
+
+    void Application::setProfileFile(std::string const & fileName, size_t frameCount)
+    {
+        mImpl->profileFile = fileName;
+        mImpl->profileFrameCount = std::clamp(frameCount, size_t{ 1 }, Profiler::smFrameCapacity);
+    }
+
+    void * Application::w()
+    {
+        return nullptr;
+    }
+
+    void Application::setup(size_t width, size_t height, std::string const & title, std::string const & iconFileName)
+    {
+        mImpl->width = std::clamp(width, smMinimumSize, smMaximumSize);
+        mImpl->height = std::clamp(height, smMinimumSize, smMaximumSize);
+        mImpl->title = title;
+        mImpl->iconFileName = iconFileName;
+    }
+
+    void Application::run(std::function<UpdateModelFunction> updateModel, std::function<UpdateViewFunction> updateView)
+    {
+        begin();
+        while (beginFrame()) {
+            EZ_PROFILE_SCOPE("Application::frame");
+            bool keepRunning{ true };
+            while (keepRunning && beginStep()) {
+                EZ_PROFILE_SCOPE("provessEvents");
+                keepRunning = updateModel(keyboard(), timer());
+            }
+            endEvents();
+            if (!keepRunning) {
+                break;
+            }
+
+            {
+                EZ_PROFILE_SCOPE("processDisplay");
+                updateView(screen());
+            }
+            endFrame();
+        }
+        end();
+    }
+
+    Keyboard const & Application::keyboard() const
+    {
+        return mImpl->keyboard;
+    }
+
+    Timer const & Application::timer() const
+    {
+        return mImpl->timer;
+    }
+
+    Screen & Application::screen()
+    {
+        return mImpl->screen;
+    }
+
+    void Application::begin()
+    {
+        Impl & impl{ *mImpl };
+        size_t const reserved{ impl.frameLimit > 0 ? impl.frameLimit : smDefaultFrameLimit };
+        impl.frameTimes.clear();
+        impl.eventsTimes.clear();
+        impl.displayTimes.clear();
+        impl.frameTimes.reserve(reserved);
+        impl.eventsTimes.reserve(reserved);
+        impl.displayTimes.reserve(reserved);
+        impl.frameIndex = 0;
+        impl.stepCount = 0;
+        impl.pendingSteps = 0;
+        // La première image exécute un pas de simulation.
+        impl.fixedTimestep.reset();
+
+        impl.replaying = false;
+        impl.replayIndex = 0;
+        impl.recording.clear();
+        if (!impl.replayFile.empty()) {
+            impl.replaying = impl.recording.load(impl.replayFile);
+            if (!impl.replaying) {
+                std::clog << "[EzGame] relecture impossible : " << impl.replayFile << std::endl;
+            }
+        } else if (!impl.recordFile.empty()) {
+            impl.recording.reserve(reserved);
+        }
+
+        impl.profileSaveCount = 0;
+#if defined(EZGAME_PROFILER)
+        Profiler::setThreadName("fil principal");
+#endif
+
+        // Le chronomètre des images part d'ici et oublie le temps écoulé 
+        // depuis la création de l'application.
+        impl.frameTimer.tic();
+        impl.frameTimer.setWindowSize(impl.frameTimer.windowSize());
+        impl.overlay.reset();
+        impl.drawnCircleCount = 0;
+        impl.drawnTextCount = 0;
+        impl.overlayTime = Clock::duration{};
+        impl.overlayFrameCount = 0;
+
+        impl.screen.begin(impl.pipelined, impl.rasterized);
+        impl.start = Clock::now();
+        impl.frameStart = impl.start;
+    }
+
+    bool Application::beginFrame()
+    {
+        Impl & impl{ *mImpl };
+        if (impl.replaying) {
+            if (impl.replayIndex >= impl.recording.size()) {
+                return false;
+            }
+            if (impl.replayRealTime && impl.frameIndex > 0) {
+                std::this_thread::sleep_until(impl.frameStart + std::chrono::microseconds(impl.recording[impl.replayIndex].sinceLastTic));
+            }
+        } else if (impl.frameLimit > 0 && impl.frameIndex >= impl.frameLimit) {
+            return false;
+        }
+
+        ++impl.frameIndex;
+#if defined(EZGAME_PROFILER)
+        Profiler::markFrame();
+#endif
+        Clock::time_point const now{ Clock::now() };
+        // Avec un pas fixe, rattrape le temps réel écoulé (voir 
+        // FixedTimestep).
+        impl.pendingSteps = impl.replaying ? 1 : impl.fixedTimestep.advance(now - impl.frameStart);
+        impl.frameStart = now;
+        impl.frameTimer.tic();
+        return true;
+    }
+
+    bool Application::beginStep()
+    {
+        Impl & impl{ *mImpl };
+        if (impl.pendingSteps == 0) {
+            return false;
+        }
+
+        --impl.pendingSteps;
+        ++impl.stepCount;
+        if (impl.replaying) {
+            beginReplayedStep();
+        } else {
+            if (impl.fixedTimestep.isEnabled()) {
+                impl.timer.tic(impl.fixedTimestep.step());
+            } else {
+                impl.timer.tic();
+            }
+            impl.keyboard.update(Keyboard::poll());
+            if (!impl.recordFile.empty()) {
+                impl.recording.add(impl.keyboard.state(), impl.timer.sinceLastTic());
+            }
+        }
+
+        // F3 : surcouche de performance.
+        if (impl.keyboard.wasKeyPressed(Keyboard::Key::F3)) {
+            impl.overlayVisible = !impl.overlayVisible;
+            impl.overlay.reset();
+        }
+
+#if defined(EZGAME_PROFILER)
+        // F12 : profil des dernières images.
+        if (!impl.profileFile.empty() && impl.keyboard.wasKeyPressed(Keyboard::Key::F12)) {
+            impl.profileSaveCount += Profiler::save(impl.profileFile, impl.profileFrameCount) ? 1 : 0;
+        }
+#endif
+        return true;
+    }
+
+    bool Application::beginReplayedStep()
+    {
+        Impl & impl{ *mImpl };
+        InputRecording::Frame const & frame{ impl.recording[impl.replayIndex++] };
+        impl.timer.tic(frame.sinceLastTic);
+        impl.keyboard.update(frame.keys);
+        return true;
+    }
+
+    float Application::interpolation() const
+    {
+        Impl const & impl{ *mImpl };
+        return impl.replaying ? 0.0f : impl.fixedTimestep.interpolation();
+    }
+
+    void Application::endEvents()
+    {
+        mImpl->eventsEnd = Clock::now();
+    }
+
+    void Application::endFrame()
+    {
+        Impl & impl{ *mImpl };
+        if (impl.overlayVisible) {
+            EZ_PROFILE_SCOPE("PerformanceOverlay");
+            Clock::time_point const overlayStart{ Clock::now() };
+            size_t const entityCount{ impl.screen.circleCount() - impl.drawnCircleCount + impl.screen.textCount() - impl.drawnTextCount };
+            impl.overlay.update(impl.frameTimer, impl.screen.drawCallCount(), entityCount, AllocationCounter::count());
+            impl.overlay.draw(impl.screen);
+            impl.overlayTime += Clock::now() - overlayStart;
+            ++impl.overlayFrameCount;
+        }
+        impl.drawnCircleCount = impl.screen.circleCount();
+        impl.drawnTextCount = impl.screen.textCount();
+        impl.screen.present();
+        Clock::time_point const displayEnd{ Clock::now() };
+        impl.frameTimes.push_back(displayEnd - impl.frameStart);
+        impl.eventsTimes.push_back(impl.eventsEnd - impl.frameStart);
+        impl.displayTimes.push_back(displayEnd - impl.eventsEnd);
+    }
+
+    void Application::end()
+    {
+        Impl & impl{ *mImpl };
+        impl.screen.end();
+        Clock::duration const elapsed{ Clock::now() - impl.start };
+
+        size_t const frameCount{ impl.frameTimes.size() };
+        double const seconds{ std::chrono::duration<double>(elapsed).count() };
+        auto mean = [frameCount](std::vector<Clock::duration> const & durations) {
+            Clock::duration total{};
+            for (Clock::duration duration : durations) {
+                total += duration;
+            }
+            return frameCount > 0 ? toMicroseconds(total) / static_cast<double>(frameCount) : 0.0;
+        };
+        double const eventsMean{ mean(impl.eventsTimes) };
+        double const displayMean{ mean(impl.displayTimes) };
+        double const circlesPerFrame{ frameCount > 0 ? static_cast<double>(impl.screen.circleCount()) / static_cast<double>(frameCount) : 0.0 };
+        double const textsPerFrame{ frameCount > 0 ? static_cast<double>(impl.screen.textCount()) / static_cast<double>(frameCount) : 0.0 };
+
+        std::clog << std::fixed << std::setprecision(3)
+                  << "[EzGame] " << (impl.title.empty() ? "EzGame" : impl.title) << " : "
+                  << frameCount << " images en " << seconds << " s ("
+                  << (seconds > 0.0 ? static_cast<double>(frameCount) / seconds : 0.0) << " images/s)\n"
+                  << "[EzGame] temps par image : p50 = " << percentile(impl.frameTimes, 0.50)
+                  << " us, p99 = " << percentile(impl.frameTimes, 0.99) << " us\n"
+                  << "[EzGame] processEvents : moyenne = " << eventsMean
+                  << " us, p50 = " << percentile(impl.eventsTimes, 0.50)
+                  << " us, p99 = " << percentile(impl.eventsTimes, 0.99) << " us\n"
+                  << "[EzGame] processDisplay : moyenne = " << displayMean
+                  << " us, p50 = " << percentile(impl.displayTimes, 0.50)
+                  << " us, p99 = " << percentile(impl.displayTimes, 0.99) << " us\n"
+                  << "[EzGame] primitives par image : " << circlesPerFrame << " cercle(s), "
+                  << textsPerFrame << " texte(s)" << std::endl;
+
+        std::vector<Clock::duration> renderTimes{ impl.screen.renderTimes() };
+        double const renderMean{ mean(renderTimes) };
+        std::clog << "[EzGame] rendu (" << (impl.pipelined ? "fil de rendu" : "fil principal") << ") : moyenne = " << renderMean
+                  << " us, p50 = " << percentile(renderTimes, 0.50)
+                  << " us, p99 = " << percentile(renderTimes, 0.99) << " us\n"
+                  << "[EzGame] appels de rendu par image : " << (renderTimes.empty() ? 0.0 : static_cast<double>(impl.screen.totalDrawCallCount()) / static_cast<double>(renderTimes.size()))
+                  << " pour " << (renderTimes.empty() ? 0.0 : static_cast<double>(impl.screen.totalCommandCount()) / static_cast<double>(renderTimes.size()))
+                  << " commande(s)" << std::endl;
+
+        if (impl.fixedTimestep.isEnabled() && !impl.replaying) {
+            std::clog << "[EzGame] pas fixe de " << impl.fixedTimestep.step() << " us : " << impl.stepCount
+                      << " pas de simulation, " << impl.fixedTimestep.droppedSteps() << " abandonne(s)" << std::endl;
+        }
+
+        if (impl.overlayFrameCount > 0) {
+            std::clog << "[EzGame] surcouche de performance : " << impl.overlayFrameCount << " image(s), moyenne = "
+                      << toMicroseconds(impl.overlayTime) / static_cast<double>(impl.overlayFrameCount) << " us" << std::endl;
+        }
+
+        Timer const & timer{ impl.timer };
+        std::clog << "[EzGame] " << timer.windowTicCount() << " dernier(s) tic(s) : p50 = " << timer.percentile(0.50)
+                  << " us, p99 = " << timer.percentile(0.99) << " us, max = " << timer.max()
+                  << " us, gigue = " << timer.jitter() << " us, " << timer.overBudgetCount()
+                  << " hors budget (" << timer.frameBudget() << " us)" << std::endl;
+
+        if (impl.rasterized && impl.screen.textCount() > 0) {
+            if (impl.screen.fontFileName().empty()) {
+                std::clog << "[EzGame] textes : aucune police trouvee (EZGAME_FONT), textes non dessines" << std::endl;
+            } else {
+                std::clog << "[EzGame] textes : " << impl.screen.textCacheHitCount() << " mise(s) en page trouvee(s) dans le cache, "
+                          << impl.screen.textCacheMissCount() << " calculee(s) (" << impl.screen.fontFileName() << ")" << std::endl;
+            }
+        }
+
+        if (impl.rasterized && !impl.captureFile.empty()) {
+            bool const saved{ impl.screen.framebuffer().save(impl.captureFile) };
+            std::clog << "[EzGame] capture : derniere image " << (saved ? "ecrite dans " : "non ecrite dans ") << impl.captureFile << std::endl;
+        }
+
+        if (impl.replaying) {
+            std::clog << "[EzGame] relecture : " << impl.replayIndex << " pas de simulation de " << impl.replayFile << std::endl;
+        } else if (!impl.recordFile.empty()) {
+            bool const saved{ impl.recording.save(impl.recordFile) };
+            std::clog << "[EzGame] enregistrement : " << impl.recording.size() << " pas de simulation "
+                      << (saved ? "ecrits dans " : "non ecrits dans ") << impl.recordFile << std::endl;
+        }
+
+#if defined(EZGAME_PROFILER)
+        if (!impl.profileFile.empty()) {
+            bool const saved{ Profiler::save(impl.profileFile, impl.profileFrameCount) };
+            std::clog << "[EzGame] profil : " << std::min(impl.profileFrameCount, Profiler::frameCount()) << " image(s) "
+                      << (saved ? "ecrite(s) dans " : "non ecrite(s) dans ") << impl.profileFile
+                      << " (F12 : " << impl.profileSaveCount << " exportation(s))" << std::endl;
+        }
+#endif
+    }
+
+} // namespace ezgame
@@ -0,0 +1,149 @@
+// Définitions de la classe Circle.
+
+
+// Inclusion des bibliothèques
+#include "Circle.h"
+
+#include <algorithm>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    float const Circle::smMinimumRadius{ 1.0f };
+
+    Circle::Circle()
+        : Circle(smMinimumRadius, Vect2d(), Color())
+    {
+    }
+
+    Circle::Circle(float radius, Vect2d const& position, Color const color, Alignment alignment)
+        : Circle(radius, position, color, color, 0.0f, alignment)
+    {
+    }
+
+    Circle::Circle(float radius, Vect2d const& position, Color const fillColor, Color const edgeColor, float edgeSize, Alignment alignment)
+        : mRadius{ std::max(radius, smMinimumRadius) }
+        , mPosition{ position }
+        , mAlignment{ alignment }
+        , mFillColor{ fillColor }
+        , mEdgeColor{ edgeColor }
+        , mEdgeSize{ std::max(edgeSize, 0.0f) }
+    {
+    }
+
+    float Circle::radius() const
+    {
+        return mRadius;
+    }
+
+    Vect2d Circle::position() const
+    {
+        return mPosition;
+    }
+
+    Alignment Circle::alignment() const
+    {
+        return mAlignment;
+    }
+
+    Color Circle::fillColor() const
+    {
+        return mFillColor;
+    }
+
+    Color Circle::edgeColor() const
+    {
+        return mEdgeColor;
+    }
+
+    float Circle::edgeSize() const
+    {
+        return mEdgeSize;
+    }
+
+    Vect2d Circle::center() const
+    {
+        return mPosition + centerOffset(mAlignment) * mRadius;
+    }
+
+    Vect2d Circle::centerOffset(Alignment alignment)
+    {
+        switch (alignment) {
+            case Alignment::TopLeft:        return Vect2d(1.0f, 1.0f);
+            case Alignment::TopCenter:      return Vect2d(0.0f, 1.0f);
+            case Alignment::TopRight:       return Vect2d(-1.0f, 1.0f);
+            case Alignment::CenterLeft:     return Vect2d(1.0f, 0.0f);
+            case Alignment::CenterRight:    return Vect2d(-1.0f, 0.0f);
+            case Alignment::BottomLeft:     return Vect2d(1.0f, -1.0f);
+            case Alignment::BottomCenter:   return Vect2d(0.0f, -1.0f);
+            case Alignment::BottomRight:    return Vect2d(-1.0f, -1.0f);
+            default:                        return Vect2d();
+        }
+    }
+
+    bool Circle::isColliding(Circle const& circle) const
+    {
+        float const radiusSum{ mRadius + circle.mRadius };
+        return center().squaredDistance(circle.center()) <= radiusSum * radiusSum;
+    }
+
+    void Circle::setRadius(float radius)
+    {
+        mRadius = std::max(radius, smMinimumRadius);
+    }
+
+    void Circle::setPosition(Vect2d const& position)
+    {
+        mPosition = position;
+    }
+
+    void Circle::setAlignment(Alignment alignment)
+    {
+        mAlignment = alignment;
+    }
+
+    void Circle::setFill(Color const& color)
+    {
+        mFillColor = color;
+    }
+
+    void Circle::setEdge(Color const& color)
+    {
+        mEdgeColor = color;
+    }
+
+    void Circle::setEdge(float size)
+    {
+        mEdgeSize = std::max(size, 0.0f);
+    }
+
+    void Circle::setEdge(Color const& color, float size)
+    {
+        setEdge(color);
+        setEdge(size);
+    }
+
+    void Circle::setColors(Color const& fillColor, Color const& edgeColor)
+    {
+        mFillColor = fillColor;
+        mEdgeColor = edgeColor;
+    }
+
+    void Circle::setColors(Color const& fillColor, Color const& edgeColor, float edgeSize)
+    {
+        setColors(fillColor, edgeColor);
+        setEdge(edgeSize);
+    }
+
+    void Circle::adjustSize(float relativeSize)
+    {
+        setRadius(mRadius * relativeSize);
+    }
+
+    void Circle::move(Vect2d const& displacement)
+    {
+        mPosition += displacement;
+    }
+
+} // namespace ezgame
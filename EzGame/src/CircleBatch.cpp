@@ -0,0 +1,325 @@
+// Inclusion des bibliothèques
+#include "CircleBatch.h"
+
+#include <algorithm>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    namespace {
+
+        // Nombre de cercles testés par bloc lors de la recherche d'une 
+        // première collision. Le test d'un bloc est sans branchement et 
+        // vectorisable; seul le résultat du bloc est testé.
+        size_t const smCollisionBlockSize{ 16 };
+
+        inline bool overlaps(float dx, float dy, float radiusSum)
+        {
+            return dx * dx + dy * dy <= radiusSum * radiusSum;
+        }
+
+    } // namespace
+
+    CircleBatch::CircleBatch(size_t capacity, Alignment alignment)
+        : mAlignment{ alignment }
+    {
+        reserve(capacity);
+    }
+
+    size_t CircleBatch::size() const
+    {
+        return mX.size();
+    }
+
+    bool CircleBatch::empty() const
+    {
+        return mX.empty();
+    }
+
+    Alignment CircleBatch::alignment() const
+    {
+        return mAlignment;
+    }
+
+    Circle CircleBatch::circle(size_t index) const
+    {
+        return Circle(mRadius[index], position(index), mFillColor[index], mEdgeColor[index], mEdgeSize[index], mAlignment);
+    }
+
+    float CircleBatch::radius(size_t index) const
+    {
+        return mRadius[index];
+    }
+
+    Vect2d CircleBatch::position(size_t index) const
+    {
+        return Vect2d(mX[index], mY[index]);
+    }
+
+    Color CircleBatch::fillColor(size_t index) const
+    {
+        return mFillColor[index];
+    }
+
+    Color CircleBatch::edgeColor(size_t index) const
+    {
+        return mEdgeColor[index];
+    }
+
+    float CircleBatch::edgeSize(size_t index) const
+    {
+        return mEdgeSize[index];
+    }
+
+    float const * CircleBatch::xs() const
+    {
+        return mX.data();
+    }
+
+    float const * CircleBatch::ys() const
+    {
+        return mY.data();
+    }
+
+    float const * CircleBatch::radii() const
+    {
+        return mRadius.data();
+    }
+
+    Color const * CircleBatch::fillColors() const
+    {
+        return mFillColor.data();
+    }
+
+    Color const * CircleBatch::edgeColors() const
+    {
+        return mEdgeColor.data();
+    }
+
+    float const * CircleBatch::edgeSizes() const
+    {
+        return mEdgeSize.data();
+    }
+
+    float * CircleBatch::xs()
+    {
+        return mX.data();
+    }
+
+    float * CircleBatch::ys()
+    {
+        return mY.data();
+    }
+
+    Color * CircleBatch::fillColors()
+    {
+        return mFillColor.data();
+    }
+
+    Color * CircleBatch::edgeColors()
+    {
+        return mEdgeColor.data();
+    }
+
+    void CircleBatch::reserve(size_t capacity)
+    {
+        mX.reserve(capacity);
+        mY.reserve(capacity);
+        mRadius.reserve(capacity);
+        mFillColor.reserve(capacity);
+        mEdgeColor.reserve(capacity);
+        mEdgeSize.reserve(capacity);
+    }
+
+    void CircleBatch::clear()
+    {
+        mX.clear();
+        mY.clear();
+        mRadius.clear();
+        mFillColor.clear();
+        mEdgeColor.clear();
+        mEdgeSize.clear();
+    }
+
+    size_t CircleBatch::add(Circle const& circle)
+    {
+        // Un cercle d'un autre alignement est converti : son centre est
+        // conservé et sa position est exprimée selon l'alignement commun.
+        Vect2d position{ circle.position() };
+        if (circle.alignment() != mAlignment) {
+            position = circle.center() - Circle::centerOffset(mAlignment) * circle.radius();
+        }
+        return add(circle.radius(), position, circle.fillColor(), circle.edgeColor(), circle.edgeSize());
+    }
+
+    size_t CircleBatch::add(float radius, Vect2d const& position, Color const& color)
+    {
+        return add(radius, position, color, color, 0.0f);
+    }
+
+    size_t CircleBatch::add(float radius, Vect2d const& position, Color const& fillColor, Color const& edgeColor, float edgeSize)
+    {
+        mX.push_back(position.x());
+        mY.push_back(position.y());
+        mRadius.push_back(std::max(radius, Circle::smMinimumRadius));
+        mFillColor.push_back(fillColor);
+        mEdgeColor.push_back(edgeColor);
+        mEdgeSize.push_back(std::max(edgeSize, 0.0f));
+        return mX.size() - 1;
+    }
+
+    void CircleBatch::remove(size_t index)
+    {
+        size_t const last{ mX.size() - 1 };
+        mX[index] = mX[last];
+        mY[index] = mY[last];
+        mRadius[index] = mRadius[last];
+        mFillColor[index] = mFillColor[last];
+        mEdgeColor[index] = mEdgeColor[last];
+        mEdgeSize[index] = mEdgeSize[last];
+        mX.pop_back();
+        mY.pop_back();
+        mRadius.pop_back();
+        mFillColor.pop_back();
+        mEdgeColor.pop_back();
+        mEdgeSize.pop_back();
+    }
+
+    void CircleBatch::setAlignment(Alignment alignment)
+    {
+        mAlignment = alignment;
+    }
+
+    void CircleBatch::setRadius(size_t index, float radius)
+    {
+        mRadius[index] = std::max(radius, Circle::smMinimumRadius);
+    }
+
+    void CircleBatch::setPosition(size_t index, Vect2d const& position)
+    {
+        mX[index] = position.x();
+        mY[index] = position.y();
+    }
+
+    void CircleBatch::setFill(size_t index, Color const& color)
+    {
+        mFillColor[index] = color;
+    }
+
+    void CircleBatch::setEdge(size_t index, Color const& color, float size)
+    {
+        mEdgeColor[index] = color;
+        mEdgeSize[index] = std::max(size, 0.0f);
+    }
+
+    void CircleBatch::move(size_t index, Vect2d const& displacement)
+    {
+        mX[index] += displacement.x();
+        mY[index] += displacement.y();
+    }
+
+    void CircleBatch::moveAll(Vect2d const& displacement)
+    {
+        float const dx{ displacement.x() };
+        float const dy{ displacement.y() };
+        for (float & x : mX) {
+            x += dx;
+        }
+        for (float & y : mY) {
+            y += dy;
+        }
+    }
+
+    size_t CircleBatch::firstColliding(Circle const& circle) const
+    {
+        return firstColliding(circle.center(), circle.radius());
+    }
+
+    size_t CircleBatch::firstColliding(Vect2d const& center, float radius) const
+    {
+        // Le centre de chaque cercle est sa position décalée de son rayon
+        // selon l'alignement commun.
+        Vect2d const offset{ Circle::centerOffset(mAlignment) };
+        float const ox{ offset.x() };
+        float const oy{ offset.y() };
+        float const x{ center.x() };
+        float const y{ center.y() };
+        size_t const count{ size() };
+        float const * xs{ mX.data() };
+        float const * ys{ mY.data() };
+        float const * radii{ mRadius.data() };
+
+        size_t index{};
+        for (; index + smCollisionBlockSize <= count; index += smCollisionBlockSize) {
+            bool any{ false };
+            for (size_t k{}; k < smCollisionBlockSize; ++k) {
+                float const r{ radii[index + k] };
+                any |= overlaps(xs[index + k] + ox * r - x, ys[index + k] + oy * r - y, r + radius);
+            }
+            if (any) {
+                break;
+            }
+        }
+        for (; index < count; ++index) {
+            float const r{ radii[index] };
+            if (overlaps(xs[index] + ox * r - x, ys[index] + oy * r - y, r + radius)) {
+                return index;
+            }
+        }
+
+        return npos;
+    }
+
+    bool CircleBatch::isColliding(Circle const& circle) const
+    {
+        return firstColliding(circle) != npos;
+    }
+
+    size_t CircleBatch::collidingPairs(std::vector<IndexPair> & pairs) const
+    {
+        size_t const initialSize{ pairs.size() };
+        size_t const count{ size() };
+        Vect2d const offset{ Circle::centerOffset(mAlignment) };
+        float const ox{ offset.x() };
+        float const oy{ offset.y() };
+        for (size_t i{}; i < count; ++i) {
+            float const radius{ mRadius[i] };
+            float const x{ mX[i] + ox * radius };
+            float const y{ mY[i] + oy * radius };
+            for (size_t j{ i + 1 }; j < count; ++j) {
+                float const r{ mRadius[j] };
+                if (overlaps(mX[j] + ox * r - x, mY[j] + oy * r - y, r + radius)) {
+                    pairs.emplace_back(i, j);
+                }
+            }
+        }
+
+        return pairs.size() - initialSize;
+    }
+
+    size_t CircleBatch::collidingPairs(CircleBatch const& other, std::vector<IndexPair> & pairs) const
+    {
+        size_t const initialSize{ pairs.size() };
+        size_t const count{ size() };
+        size_t const otherCount{ other.size() };
+        Vect2d const offset{ Circle::centerOffset(mAlignment) };
+        Vect2d const otherOffset{ Circle::centerOffset(other.mAlignment) };
+        float const ox{ otherOffset.x() };
+        float const oy{ otherOffset.y() };
+        for (size_t i{}; i < count; ++i) {
+            float const radius{ mRadius[i] };
+            float const x{ mX[i] + offset.x() * radius };
+            float const y{ mY[i] + offset.y() * radius };
+            for (size_t j{}; j < otherCount; ++j) {
+                float const r{ other.mRadius[j] };
+                if (overlaps(other.mX[j] + ox * r - x, other.mY[j] + oy * r - y, r + radius)) {
+                    pairs.emplace_back(i, j);
+                }
+            }
+        }
+
+        return pairs.size() - initialSize;
+    }
+
+} // namespace ezgame
@@ -0,0 +1,407 @@
+// Définitions de la classe Color.
+//
+// Seules les composantes RGBA sont conservées; les composantes HSL et HSV
+// sont calculées à chaque appel. Toutes les composantes données sont
+// limitées à [0, 1], sauf la teinte, qui est ramenée dans [0, 1[ (une
+// teinte de 1.25 équivaut à 0.25), comme dans ColorBatch.
+//
+// Les couleurs aléatoires sont tirées du générateur de Random (propre à
+// chaque fil d'exécution et réinitialisable par Random::seed), comme les
+// vecteurs de Vect2d::fromRandomized. Une même graine reproduit donc les
+// mêmes couleurs.
+
+
+// Inclusion des bibliothèques
+#include "Color.h"
+#include "Random.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    namespace {
+
+        // Ramène la teinte dans [0, 1[.
+        float wrapHue(float hue)
+        {
+            float const wrapped{ hue - std::floor(hue) };
+            return wrapped < 1.0f ? wrapped : 0.0f;
+        }
+
+        // Teinte [0, 1[ à partir des composantes, de leur maximum et de
+        // l'écart entre leur maximum et leur minimum. La teinte d'un gris
+        // est nulle.
+        float hueOf(float red, float green, float blue, float highest, float delta)
+        {
+            if (delta <= 0.0f) {
+                return 0.0f;
+            }
+            float hue;
+            if (highest == red) {
+                hue = (green - blue) / delta;
+            } else if (highest == green) {
+                hue = (blue - red) / delta + 2.0f;
+            } else {
+                hue = (red - green) / delta + 4.0f;
+            }
+            return wrapHue(hue / 6.0f);
+        }
+
+    } // namespace
+
+    Color const Color::Transparent(0.0f, 0.0f, 0.0f, 0.0f);
+    Color const Color::NoColor(0.0f, 0.0f, 0.0f, 0.0f);
+
+    Color const Color::Black(0.0f, 0.0f, 0.0f, 1.0f);
+    Color const Color::Red(1.0f, 0.0f, 0.0f, 1.0f);
+    Color const Color::Green(0.0f, 1.0f, 0.0f, 1.0f);
+    Color const Color::Blue(0.0f, 0.0f, 1.0f, 1.0f);
+    Color const Color::Yellow(1.0f, 1.0f, 0.0f, 1.0f);
+    Color const Color::Cyan(0.0f, 1.0f, 1.0f, 1.0f);
+    Color const Color::Magenta(1.0f, 0.0f, 1.0f, 1.0f);
+    Color const Color::White(1.0f, 1.0f, 1.0f, 1.0f);
+
+    Color const Color::Orange(1.0f, 0.5f, 0.0f, 1.0f);
+    Color const Color::Lime(0.5f, 1.0f, 0.0f, 1.0f);
+    Color const Color::Fuchsia(1.0f, 0.0f, 0.5f, 1.0f);
+    Color const Color::Violet(0.5f, 0.0f, 1.0f, 1.0f);
+    Color const Color::Aqua(0.0f, 1.0f, 0.5f, 1.0f);
+    Color const Color::Sky(0.0f, 0.5f, 1.0f, 1.0f);
+
+    Color const Color::LightGray(0.75f, 0.75f, 0.75f, 1.0f);
+    Color const Color::Gray(0.5f, 0.5f, 0.5f, 1.0f);
+    Color const Color::DarkGray(0.25f, 0.25f, 0.25f, 1.0f);
+
+    Color::Color()
+        : Color(0.0f, 0.0f, 0.0f, 1.0f)
+    {
+    }
+
+    Color::Color(float red, float green, float blue, float alpha)
+        : mRed{ clamp(red) }
+        , mGreen{ clamp(green) }
+        , mBlue{ clamp(blue) }
+        , mAlpha{ clamp(alpha) }
+    {
+    }
+
+    float Color::red() const
+    {
+        return mRed;
+    }
+
+    float Color::green() const
+    {
+        return mGreen;
+    }
+
+    float Color::blue() const
+    {
+        return mBlue;
+    }
+
+    float Color::alpha() const
+    {
+        return mAlpha;
+    }
+
+    float Color::hslHue() const
+    {
+        float hue, saturation, lightness;
+        getHsl(hue, saturation, lightness);
+        return hue;
+    }
+
+    float Color::hslSaturation() const
+    {
+        float hue, saturation, lightness;
+        getHsl(hue, saturation, lightness);
+        return saturation;
+    }
+
+    float Color::hslLightness() const
+    {
+        float hue, saturation, lightness;
+        getHsl(hue, saturation, lightness);
+        return lightness;
+    }
+
+    void Color::getHsl(float& hue, float& saturation, float& lightness) const
+    {
+        float const highest{ std::max({ mRed, mGreen, mBlue }) };
+        float const lowest{ std::min({ mRed, mGreen, mBlue }) };
+        float const delta{ highest - lowest };
+        float const denominator{ 1.0f - std::abs(highest + lowest - 1.0f) };
+        hue = hueOf(mRed, mGreen, mBlue, highest, delta);
+        saturation = denominator > 0.0f ? std::min(delta / denominator, 1.0f) : 0.0f;
+        lightness = (highest + lowest) * 0.5f;
+    }
+
+    float Color::hsvHue() const
+    {
+        float hue, saturation, value;
+        getHsv(hue, saturation, value);
+        return hue;
+    }
+
+    float Color::hsvSaturation() const
+    {
+        float hue, saturation, value;
+        getHsv(hue, saturation, value);
+        return saturation;
+    }
+
+    float Color::hsvValue() const
+    {
+        float hue, saturation, value;
+        getHsv(hue, saturation, value);
+        return value;
+    }
+
+    void Color::getHsv(float& hue, float& saturation, float& value) const
+    {
+        float const highest{ std::max({ mRed, mGreen, mBlue }) };
+        float const delta{ highest - std::min({ mRed, mGreen, mBlue }) };
+        hue = hueOf(mRed, mGreen, mBlue, highest, delta);
+        saturation = highest > 0.0f ? delta / highest : 0.0f;
+        value = highest;
+    }
+
+    Color Color::blended(Color const& otherColor, float blendFactor, bool blendAlpha) const
+    {
+        Color color{ *this };
+        color.blend(otherColor, blendFactor, blendAlpha);
+        return color;
+    }
+
+    Color Color::darker(float factor) const
+    {
+        Color color{ *this };
+        color.darken(factor);
+        return color;
+    }
+
+    Color Color::lighter(float factor) const
+    {
+        Color color{ *this };
+        color.lighten(factor);
+        return color;
+    }
+
+    void Color::setRed(float red)
+    {
+        mRed = clamp(red);
+    }
+
+    void Color::setGreen(float green)
+    {
+        mGreen = clamp(green);
+    }
+
+    void Color::setBlue(float blue)
+    {
+        mBlue = clamp(blue);
+    }
+
+    void Color::setAlpha(float alpha)
+    {
+        mAlpha = clamp(alpha);
+    }
+
+    void Color::set(float red, float green, float blue)
+    {
+        set(red, green, blue, mAlpha);
+    }
+
+    void Color::set(float red, float green, float blue, float alpha)
+    {
+        mRed = clamp(red);
+        mGreen = clamp(green);
+        mBlue = clamp(blue);
+        mAlpha = clamp(alpha);
+    }
+
+    void Color::setHslHue(float hue)
+    {
+        float currentHue, saturation, lightness;
+        getHsl(currentHue, saturation, lightness);
+        setHsl(hue, saturation, lightness);
+    }
+
+    void Color::setHslSaturation(float saturation)
+    {
+        float hue, currentSaturation, lightness;
+        getHsl(hue, currentSaturation, lightness);
+        setHsl(hue, saturation, lightness);
+    }
+
+    void Color::setHslLightness(float lightness)
+    {
+        float hue, saturation, currentLightness;
+        getHsl(hue, saturation, currentLightness);
+        setHsl(hue, saturation, lightness);
+    }
+
+    void Color::setHsl(float hue, float saturation, float lightness)
+    {
+        setHsl(hue, saturation, lightness, mAlpha);
+    }
+
+    void Color::setHsl(float hue, float saturation, float lightness, float alpha)
+    {
+        hue = wrapHue(hue);
+        saturation = clamp(saturation);
+        lightness = clamp(lightness);
+
+        float const q{ lightness < 0.5f ? lightness * (1.0f + saturation) : lightness + saturation - lightness * saturation };
+        float const p{ 2.0f * lightness - q };
+        set(hslHueToRGB(p, q, hue + 1.0f / 3.0f), hslHueToRGB(p, q, hue), hslHueToRGB(p, q, hue - 1.0f / 3.0f), alpha);
+    }
+
+    void Color::setHsvHue(float hue)
+    {
+        float currentHue, saturation, value;
+        getHsv(currentHue, saturation, value);
+        setHsv(hue, saturation, value);
+    }
+
+    void Color::setHsvSaturation(float saturation)
+    {
+        float hue, currentSaturation, value;
+        getHsv(hue, currentSaturation, value);
+        setHsv(hue, saturation, value);
+    }
+
+    void Color::setHsvValue(float value)
+    {
+        float hue, saturation, currentValue;
+        getHsv(hue, saturation, currentValue);
+        setHsv(hue, saturation, value);
+    }
+
+    void Color::setHsv(float hue, float saturation, float value)
+    {
+        setHsv(hue, saturation, value, mAlpha);
+    }
+
+    void Color::setHsv(float hue, float saturation, float value, float alpha)
+    {
+        float const sector{ wrapHue(hue) * 6.0f };
+        saturation = clamp(saturation);
+        value = clamp(value);
+
+        // Composantes la plus forte (value), la plus faible (lowest) et
+        // intermédiaire, montante (rising) ou descendante (falling).
+        float const fraction{ sector - std::floor(sector) };
+        float const lowest{ value * (1.0f - saturation) };
+        float const falling{ value * (1.0f - saturation * fraction) };
+        float const rising{ value * (1.0f - saturation * (1.0f - fraction)) };
+        switch (static_cast<int>(sector)) {
+        case 0: set(value, rising, lowest, alpha); break;
+        case 1: set(falling, value, lowest, alpha); break;
+        case 2: set(lowest, value, rising, alpha); break;
+        case 3: set(lowest, falling, value, alpha); break;
+        case 4: set(rising, lowest, value, alpha); break;
+        default: set(value, lowest, falling, alpha); break;
+        }
+    }
+
+    Color Color::fromHsl(float hue, float saturation, float lightness, float alpha)
+    {
+        Color color;
+        color.setHsl(hue, saturation, lightness, alpha);
+        return color;
+    }
+
+    Color Color::fromHsv(float hue, float saturation, float value, float alpha)
+    {
+        Color color;
+        color.setHsv(hue, saturation, value, alpha);
+        return color;
+    }
+
+    void Color::blend(Color const& color, float blendFactor, bool blendAlpha)
+    {
+        blendFactor = clamp(blendFactor);
+        float const otherFactor{ 1.0f - blendFactor };
+        set(mRed * blendFactor + color.mRed * otherFactor,
+            mGreen * blendFactor + color.mGreen * otherFactor,
+            mBlue * blendFactor + color.mBlue * otherFactor,
+            blendAlpha ? mAlpha * blendFactor + color.mAlpha * otherFactor : mAlpha);
+    }
+
+    void Color::darken(float factor)
+    {
+        blend(Black, 1.0f - clamp(factor));
+    }
+
+    void Color::lighten(float factor)
+    {
+        blend(White, 1.0f - clamp(factor));
+    }
+
+    Color Color::gray(float level)
+    {
+        return Color(level, level, level, 1.0f);
+    }
+
+    float Color::clamp(float value)
+    {
+        return std::clamp(value, 0.0f, 1.0f);
+    }
+
+    float Color::hslHueToRGB(float p, float q, float t)
+    {
+        if (t < 0.0f) {
+            t += 1.0f;
+        } else if (t > 1.0f) {
+            t -= 1.0f;
+        }
+        if (t < 1.0f / 6.0f) {
+            return p + (q - p) * 6.0f * t;
+        }
+        if (t < 1.0f / 2.0f) {
+            return q;
+        }
+        if (t < 2.0f / 3.0f) {
+            return p + (q - p) * (2.0f / 3.0f - t) * 6.0f;
+        }
+        return p;
+    }
+
+    void Color::randomize(bool randomizeAlpha)
+    {
+        set(Random::real(0.0f, 1.0f), Random::real(0.0f, 1.0f), Random::real(0.0f, 1.0f), randomizeAlpha ? Random::real(0.0f, 1.0f) : mAlpha);
+    }
+
+    void Color::randomize(float hueFrom, float hueTo, float saturationFrom, float saturationTo, float lightnessFrom, float lightnessTo)
+    {
+        randomize(hueFrom, hueTo, saturationFrom, saturationTo, lightnessFrom, lightnessTo, mAlpha, mAlpha);
+    }
+
+    void Color::randomize(float hueFrom, float hueTo, float saturationFrom, float saturationTo, float lightnessFrom, float lightnessTo, float alphaFrom, float alphaTo)
+    {
+        *this = randomized(hueFrom, hueTo, saturationFrom, saturationTo, lightnessFrom, lightnessTo, alphaFrom, alphaTo);
+    }
+
+    Color Color::randomized(bool randomizeAlpha)
+    {
+        Color color;
+        color.randomize(randomizeAlpha);
+        return color;
+    }
+
+    Color Color::randomized(float hueFrom, float hueTo, float saturationFrom, float saturationTo, float lightnessFrom, float lightnessTo)
+    {
+        return randomized(hueFrom, hueTo, saturationFrom, saturationTo, lightnessFrom, lightnessTo, 1.0f, 1.0f);
+    }
+
+    Color Color::randomized(float hueFrom, float hueTo, float saturationFrom, float saturationTo, float lightnessFrom, float lightnessTo, float alphaFrom, float alphaTo)
+    {
+        return fromHsl(Random::real(hueFrom, hueTo), Random::real(saturationFrom, saturationTo), Random::real(lightnessFrom, lightnessTo), Random::real(alphaFrom, alphaTo));
+    }
+
+} // namespace ezgame
@@ -0,0 +1,367 @@
+// Traitements de couleurs par lot.
+//
+// Les composantes des couleurs sont d'abord copiées par tranches dans des
+// tableaux locaux (rouge, vert, bleu). Le calcul est ensuite fait par blocs
+// de 8 valeurs avec des paquets Float8 (AVX, SSE ou scalaire selon la
+// cible), sans branchement : les sélections sont des min/max et des
+// mélanges par masque. Les résultats sont enfin recopiés dans les couleurs.
+// Le dernier bloc incomplet est complété par des zéros.
+//
+// Les méthodes de Color n'étant pas en ligne, les traitements sur des
+// tableaux de Color restent limités par l'accès aux composantes; le gain
+// est le plus grand sur des tableaux de ColorRGBA8.
+
+
+// Inclusion des bibliothèques
+#include "ColorBatch.h"
+#include "SimdFloat.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    namespace {
+
+        size_t const smBlockSize{ 8 };
+        // Nombre de couleurs copiées à la fois dans les tableaux locaux
+        // (multiple de smBlockSize).
+        size_t const smChunkSize{ 256 };
+
+        using Block = float[smBlockSize];
+
+        template <typename... span_types>
+        size_t commonSize(span_types const&... spans)
+        {
+            size_t size{ static_cast<size_t>(-1) };
+            ((size = spans.size() < size ? spans.size() : size), ...);
+            return size;
+        }
+
+        inline float clampUnit(float value)
+        {
+            return value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+        }
+
+        void load(std::span<ColorRGBA8 const> colors, size_t first, size_t count, float * red, float * green, float * blue)
+        {
+            for (size_t i{}; i < count; ++i) {
+                red[i] = ColorRGBA8::fromChannel(colors[first + i].red());
+                green[i] = ColorRGBA8::fromChannel(colors[first + i].green());
+                blue[i] = ColorRGBA8::fromChannel(colors[first + i].blue());
+            }
+        }
+
+        void load(std::span<Color const> colors, size_t first, size_t count, float * red, float * green, float * blue)
+        {
+            for (size_t i{}; i < count; ++i) {
+                red[i] = colors[first + i].red();
+                green[i] = colors[first + i].green();
+                blue[i] = colors[first + i].blue();
+            }
+        }
+
+        void store(std::span<ColorRGBA8> colors, size_t first, size_t count, float const * red, float const * green, float const * blue)
+        {
+            // Les fonctions de bloc produisent des composantes dans [0, 1] :
+            // l'arrondi se passe de la limitation de ColorRGBA8::toChannel.
+            auto channel = [](float value) { return static_cast<uint8_t>(static_cast<int>(value * 255.0f + 0.5f)); };
+            for (size_t i{}; i < count; ++i) {
+                ColorRGBA8 & color{ colors[first + i] };
+                color.set(channel(red[i]), channel(green[i]), channel(blue[i]), color.alpha());
+            }
+        }
+
+        void store(std::span<Color> colors, size_t first, size_t count, float const * red, float const * green, float const * blue)
+        {
+            for (size_t i{}; i < count; ++i) {
+                Color & color{ colors[first + i] };
+                color.set(red[i], green[i], blue[i], color.alpha());
+            }
+        }
+
+        // Ramène chaque valeur dans [0, 1].
+        inline Float8 clampUnit(Float8 const& value)
+        {
+            return minimum(maximum(value, Float8(0.0f)), Float8(1.0f));
+        }
+
+        // Ramène chaque teinte dans [0, 1[.
+        inline Float8 wrapHue(Float8 const& hue)
+        {
+            Float8 const wrapped{ hue - truncate(hue) };
+            return selectLess(wrapped, Float8(0.0f), wrapped + Float8(1.0f), wrapped);
+        }
+
+        // Teinte [0, 1[ à partir des composantes, de leur maximum et de
+        // l'écart entre leur maximum et leur minimum.
+        inline Float8 hue(Float8 const& red, Float8 const& green, Float8 const& blue, Float8 const& maximum, Float8 const& delta)
+        {
+            Float8 const inverse{ reciprocalOrZero(delta) * Float8(1.0f / 6.0f) };
+            Float8 const fromRed{ (green - blue) * inverse };
+            Float8 const redSector{ selectLess(fromRed, Float8(0.0f), fromRed + Float8(1.0f), fromRed) };
+            Float8 const greenSector{ (blue - red) * inverse + Float8(2.0f / 6.0f) };
+            Float8 const blueSector{ (red - green) * inverse + Float8(4.0f / 6.0f) };
+            return selectEqual(maximum, red, redSector, selectEqual(maximum, green, greenSector, blueSector));
+        }
+
+        void rgbToHslBlock(float const * redBlock, float const * greenBlock, float const * blueBlock, float * hues, float * saturations, float * lightnesses)
+        {
+            Float8 const red{ Float8::load(redBlock) };
+            Float8 const green{ Float8::load(greenBlock) };
+            Float8 const blue{ Float8::load(blueBlock) };
+            Float8 const highest{ maximum(maximum(red, green), blue) };
+            Float8 const lowest{ minimum(minimum(red, green), blue) };
+            Float8 const delta{ highest - lowest };
+            Float8 const sum{ highest + lowest };
+            // s = d / (1 - |2 l - 1|)
+            Float8 const denominator{ Float8(1.0f) - maximum(sum - Float8(1.0f), Float8(1.0f) - sum) };
+            hue(red, green, blue, highest, delta).store(hues);
+            minimum(delta * reciprocalOrZero(denominator), Float8(1.0f)).store(saturations);
+            (sum * Float8(0.5f)).store(lightnesses);
+        }
+
+        void rgbToHsvBlock(float const * redBlock, float const * greenBlock, float const * blueBlock, float * hues, float * saturations, float * values)
+        {
+            Float8 const red{ Float8::load(redBlock) };
+            Float8 const green{ Float8::load(greenBlock) };
+            Float8 const blue{ Float8::load(blueBlock) };
+            Float8 const highest{ maximum(maximum(red, green), blue) };
+            Float8 const delta{ highest - minimum(minimum(red, green), blue) };
+            hue(red, green, blue, highest, delta).store(hues);
+            (delta * reciprocalOrZero(highest)).store(saturations);
+            highest.store(values);
+        }
+
+        // f(n) = l - a max(-1, min(k - 3, 9 - k, 1)), k = (n + 12 h) mod 12
+        inline Float8 hslChannel(float offset, Float8 const& hue, Float8 const& lightness, Float8 const& amplitude)
+        {
+            Float8 const sum{ Float8(offset) + hue * Float8(12.0f) };
+            Float8 const k{ selectLess(sum, Float8(12.0f), sum, sum - Float8(12.0f)) };
+            Float8 const ramp{ minimum(minimum(k - Float8(3.0f), Float8(9.0f) - k), Float8(1.0f)) };
+            return lightness - amplitude * maximum(ramp, Float8(-1.0f));
+        }
+
+        void hslToRgbBlock(float const * hues, float const * saturations, float const * lightnesses, float * red, float * green, float * blue)
+        {
+            Float8 const hue{ wrapHue(Float8::load(hues)) };
+            Float8 const lightness{ clampUnit(Float8::load(lightnesses)) };
+            Float8 const amplitude{ clampUnit(Float8::load(saturations)) * minimum(lightness, Float8(1.0f) - lightness) };
+            hslChannel(0.0f, hue, lightness, amplitude).store(red);
+            hslChannel(8.0f, hue, lightness, amplitude).store(green);
+            hslChannel(4.0f, hue, lightness, amplitude).store(blue);
+        }
+
+        // f(n) = v - v s max(0, min(k, 4 - k, 1)), k = (n + 6 h) mod 6
+        inline Float8 hsvChannel(float offset, Float8 const& hue, Float8 const& value, Float8 const& amplitude)
+        {
+            Float8 const sum{ Float8(offset) + hue * Float8(6.0f) };
+            Float8 const k{ selectLess(sum, Float8(6.0f), sum, sum - Float8(6.0f)) };
+            Float8 const ramp{ minimum(minimum(k, Float8(4.0f) - k), Float8(1.0f)) };
+            return value - amplitude * maximum(ramp, Float8(0.0f));
+        }
+
+        void hsvToRgbBlock(float const * hues, float const * saturations, float const * values, float * red, float * green, float * blue)
+        {
+            Float8 const hue{ wrapHue(Float8::load(hues)) };
+            Float8 const value{ clampUnit(Float8::load(values)) };
+            Float8 const amplitude{ value * clampUnit(Float8::load(saturations)) };
+            hsvChannel(5.0f, hue, value, amplitude).store(red);
+            hsvChannel(3.0f, hue, value, amplitude).store(green);
+            hsvChannel(1.0f, hue, value, amplitude).store(blue);
+        }
+
+        // Applique une fonction de bloc aux 3 tableaux d'entrée. Les blocs
+        // complets sont lus et écrits directement dans les tableaux; le
+        // dernier bloc incomplet passe par des tableaux locaux complétés
+        // par des zéros.
+        template <typename block_function>
+        void applyBlocks(float const * first, float const * second, float const * third, float * firstResult, float * secondResult, float * thirdResult, size_t count, block_function function)
+        {
+            size_t const blockEnd{ count - count % smBlockSize };
+            for (size_t begin{}; begin < blockEnd; begin += smBlockSize) {
+                function(first + begin, second + begin, third + begin, firstResult + begin, secondResult + begin, thirdResult + begin);
+            }
+            if (blockEnd < count) {
+                Block a{}, b{}, c{}, aResult, bResult, cResult;
+                for (size_t i{}; i < count - blockEnd; ++i) {
+                    a[i] = first[blockEnd + i];
+                    b[i] = second[blockEnd + i];
+                    c[i] = third[blockEnd + i];
+                }
+                function(a, b, c, aResult, bResult, cResult);
+                for (size_t i{}; i < count - blockEnd; ++i) {
+                    firstResult[blockEnd + i] = aResult[i];
+                    secondResult[blockEnd + i] = bResult[i];
+                    thirdResult[blockEnd + i] = cResult[i];
+                }
+            }
+        }
+
+        // Les composantes RGB sont copiées par tranches dans des tableaux
+        // locaux avant le calcul : lire en paquet des valeurs écrites une à
+        // une juste avant bloquerait le processeur à chaque bloc
+        // (_store forwarding_).
+        template <typename color_type, typename block_function>
+        void fromRgb(std::span<color_type const> colors, std::span<float> first, std::span<float> second, std::span<float> third, block_function function)
+        {
+            size_t const size{ commonSize(colors, first, second, third) };
+            float red[smChunkSize], green[smChunkSize], blue[smChunkSize];
+            for (size_t begin{}; begin < size; begin += smChunkSize) {
+                size_t const count{ size - begin < smChunkSize ? size - begin : smChunkSize };
+                load(colors, begin, count, red, green, blue);
+                applyBlocks(red, green, blue, first.data() + begin, second.data() + begin, third.data() + begin, count, function);
+            }
+        }
+
+        template <typename color_type, typename block_function>
+        void toRgb(std::span<float const> first, std::span<float const> second, std::span<float const> third, std::span<color_type> colors, block_function function)
+        {
+            size_t const size{ commonSize(first, second, third, colors) };
+            float red[smChunkSize], green[smChunkSize], blue[smChunkSize];
+            for (size_t begin{}; begin < size; begin += smChunkSize) {
+                size_t const count{ size - begin < smChunkSize ? size - begin : smChunkSize };
+                applyBlocks(first.data() + begin, second.data() + begin, third.data() + begin, red, green, blue, count, function);
+                store(colors, begin, count, red, green, blue);
+            }
+        }
+
+        // Mélange composante par composante des octets de 8 couleurs
+        // compactes : other + factor * (color - other), arrondi comme
+        // ColorRGBA8::blended.
+        void blendBlock(uint8_t const * colors, uint8_t const * others, float const * factors, uint8_t * result)
+        {
+            uint8_t mixed[smBlockSize * 4];
+            for (size_t i{}; i < smBlockSize * 4; ++i) {
+                float const color{ static_cast<float>(colors[i]) };
+                float const other{ static_cast<float>(others[i]) };
+                mixed[i] = static_cast<uint8_t>(static_cast<int>(other + factors[i] * (color - other) + 0.5f));
+            }
+            for (size_t i{}; i < smBlockSize * 4; ++i) {
+                result[i] = mixed[i];
+            }
+        }
+
+        // Les couleurs compactes sont traitées comme une suite d'octets
+        // R-G-B-A (voir ColorRGBA8). Les facteurs de chaque octet sont
+        // préparés par tranches, comme pour fromRgb. Les couleurs du dernier
+        // bloc incomplet sont mélangées par ColorRGBA8::blended.
+        template <typename factor_function>
+        void blendPacked(std::span<ColorRGBA8 const> colors, std::span<ColorRGBA8 const> others, std::span<ColorRGBA8> result, size_t size, bool blendAlpha, bool commonFactor, factor_function factor)
+        {
+            uint8_t const * colorBytes{ reinterpret_cast<uint8_t const *>(colors.data()) };
+            uint8_t const * otherBytes{ reinterpret_cast<uint8_t const *>(others.data()) };
+            uint8_t * resultBytes{ reinterpret_cast<uint8_t *>(result.data()) };
+            float factors[smChunkSize * 4];
+            auto prepareFactors = [&](size_t first, size_t count) {
+                for (size_t i{}; i < count; ++i) {
+                    float const colorFactor{ clampUnit(factor(first + i)) };
+                    factors[i * 4 + 0] = colorFactor;
+                    factors[i * 4 + 1] = colorFactor;
+                    factors[i * 4 + 2] = colorFactor;
+                    factors[i * 4 + 3] = blendAlpha ? colorFactor : 1.0f;
+                }
+            };
+
+            size_t const blockEnd{ size - size % smBlockSize };
+            if (commonFactor) {
+                prepareFactors(0, smBlockSize);
+            }
+            for (size_t begin{}; begin < blockEnd; begin += smChunkSize) {
+                size_t const count{ blockEnd - begin < smChunkSize ? blockEnd - begin : smChunkSize };
+                if (!commonFactor) {
+                    prepareFactors(begin, count);
+                }
+                for (size_t block{}; block < count; block += smBlockSize) {
+                    blendBlock(colorBytes + (begin + block) * 4, otherBytes + (begin + block) * 4, commonFactor ? factors : factors + block * 4, resultBytes + (begin + block) * 4);
+                }
+            }
+            for (size_t i{ blockEnd }; i < size; ++i) {
+                result[i] = colors[i].blended(others[i], factor(i), blendAlpha);
+            }
+        }
+
+    } // namespace
+
+    void ColorBatch::convert(std::span<Color const> colors, std::span<ColorRGBA8> result)
+    {
+        size_t const size{ commonSize(colors, result) };
+        for (size_t i{}; i < size; ++i) {
+            result[i] = ColorRGBA8(colors[i]);
+        }
+    }
+
+    void ColorBatch::convert(std::span<ColorRGBA8 const> colors, std::span<Color> result)
+    {
+        size_t const size{ commonSize(colors, result) };
+        for (size_t i{}; i < size; ++i) {
+            result[i] = colors[i].toColor();
+        }
+    }
+
+    void ColorBatch::rgbToHsl(std::span<ColorRGBA8 const> colors, std::span<float> hues, std::span<float> saturations, std::span<float> lightnesses)
+    {
+        fromRgb(colors, hues, saturations, lightnesses, rgbToHslBlock);
+    }
+
+    void ColorBatch::rgbToHsl(std::span<Color const> colors, std::span<float> hues, std::span<float> saturations, std::span<float> lightnesses)
+    {
+        fromRgb(colors, hues, saturations, lightnesses, rgbToHslBlock);
+    }
+
+    void ColorBatch::rgbToHsv(std::span<ColorRGBA8 const> colors, std::span<float> hues, std::span<float> saturations, std::span<float> values)
+    {
+        fromRgb(colors, hues, saturations, values, rgbToHsvBlock);
+    }
+
+    void ColorBatch::rgbToHsv(std::span<Color const> colors, std::span<float> hues, std::span<float> saturations, std::span<float> values)
+    {
+        fromRgb(colors, hues, saturations, values, rgbToHsvBlock);
+    }
+
+    void ColorBatch::hslToRgb(std::span<float const> hues, std::span<float const> saturations, std::span<float const> lightnesses, std::span<ColorRGBA8> colors)
+    {
+        toRgb(hues, saturations, lightnesses, colors, hslToRgbBlock);
+    }
+
+    void ColorBatch::hslToRgb(std::span<float const> hues, std::span<float const> saturations, std::span<float const> lightnesses, std::span<Color> colors)
+    {
+        toRgb(hues, saturations, lightnesses, colors, hslToRgbBlock);
+    }
+
+    void ColorBatch::hsvToRgb(std::span<float const> hues, std::span<float const> saturations, std::span<float const> values, std::span<ColorRGBA8> colors)
+    {
+        toRgb(hues, saturations, values, colors, hsvToRgbBlock);
+    }
+
+    void ColorBatch::hsvToRgb(std::span<float const> hues, std::span<float const> saturations, std::span<float const> values, std::span<Color> colors)
+    {
+        toRgb(hues, saturations, values, colors, hsvToRgbBlock);
+    }
+
+    void ColorBatch::blend(std::span<ColorRGBA8 const> colors, std::span<ColorRGBA8 const> others, float blendFactor, std::span<ColorRGBA8> result, bool blendAlpha)
+    {
+        blendPacked(colors, others, result, commonSize(colors, others, result), blendAlpha, true, [blendFactor](size_t) { return blendFactor; });
+    }
+
+    void ColorBatch::blend(std::span<Color const> colors, std::span<Color const> others, float blendFactor, std::span<Color> result, bool blendAlpha)
+    {
+        size_t const size{ commonSize(colors, others, result) };
+        for (size_t i{}; i < size; ++i) {
+            result[i] = colors[i].blended(others[i], blendFactor, blendAlpha);
+        }
+    }
+
+    void ColorBatch::blend(std::span<ColorRGBA8 const> colors, std::span<ColorRGBA8 const> others, std::span<float const> blendFactors, std::span<ColorRGBA8> result, bool blendAlpha)
+    {
+        blendPacked(colors, others, result, commonSize(colors, others, blendFactors, result), blendAlpha, false, [blendFactors](size_t i) { return blendFactors[i]; });
+    }
+
+    void ColorBatch::blend(std::span<Color const> colors, std::span<Color const> others, std::span<float const> blendFactors, std::span<Color> result, bool blendAlpha)
+    {
+        size_t const size{ commonSize(colors, others, blendFactors, result) };
+        for (size_t i{}; i < size; ++i) {
+            result[i] = colors[i].blended(others[i], blendFactors[i], blendAlpha);
+        }
+    }
+
+} // namespace ezgame
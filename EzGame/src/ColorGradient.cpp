@@ -0,0 +1,117 @@
+// Tables de couleurs précalculées.
+//
+// Les tables sont calculées une seule fois, à la création : les dégradés
+// RGB utilisent Color::blended et les dégradés HSL, ColorBatch::hslToRgb.
+// La table ColorRGBA8 est dérivée de la table Color par ColorBatch::convert.
+
+
+// Inclusion des bibliothèques
+#include "ColorGradient.h"
+#include "ColorBatch.h"
+
+#include <algorithm>
+#include <utility>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    ColorGradient::ColorGradient()
+        : ColorGradient(std::vector<Color>{ Color::White })
+    {
+    }
+
+    ColorGradient::ColorGradient(std::vector<Color> && colors)
+        : mColors{ std::move(colors) }
+    {
+        if (mColors.empty()) {
+            mColors.push_back(Color::White);
+        }
+        mPackedColors.resize(mColors.size());
+        ColorBatch::convert(mColors, mPackedColors);
+        mScale = static_cast<float>(mColors.size() - 1);
+    }
+
+    ColorGradient ColorGradient::fromStops(std::span<Stop const> stops, size_t size)
+    {
+        std::vector<Stop> sorted(stops.begin(), stops.end());
+        std::stable_sort(sorted.begin(), sorted.end(), [](Stop const& a, Stop const& b) { return a.position < b.position; });
+
+        size = std::max(size, size_t{ 1 });
+        std::vector<Color> colors(size, sorted.empty() ? Color::White : sorted.front().color);
+        if (sorted.empty()) {
+            return ColorGradient(std::move(colors));
+        }
+
+        float const scale{ size > 1 ? 1.0f / static_cast<float>(size - 1) : 0.0f };
+        size_t next{};
+        for (size_t i{}; i < size; ++i) {
+            float const position{ static_cast<float>(i) * scale };
+            while (next < sorted.size() && sorted[next].position <= position) {
+                ++next;
+            }
+            if (next == 0) {
+                colors[i] = sorted.front().color;
+            } else if (next == sorted.size()) {
+                colors[i] = sorted.back().color;
+            } else {
+                Stop const& from{ sorted[next - 1] };
+                Stop const& to{ sorted[next] };
+                float const progress{ (position - from.position) / (to.position - from.position) };
+                colors[i] = from.color.blended(to.color, 1.0f - progress, true);
+            }
+        }
+        return ColorGradient(std::move(colors));
+    }
+
+    ColorGradient ColorGradient::fromStops(std::initializer_list<Stop> stops, size_t size)
+    {
+        return fromStops(std::span<Stop const>(stops.begin(), stops.size()), size);
+    }
+
+    ColorGradient ColorGradient::fromHslRange(float hueFrom, float hueTo, float saturationFrom, float saturationTo, float lightnessFrom, float lightnessTo, float alpha, size_t size)
+    {
+        size = std::max(size, size_t{ 1 });
+        std::vector<float> hues(size);
+        std::vector<float> saturations(size);
+        std::vector<float> lightnesses(size);
+        float const scale{ size > 1 ? 1.0f / static_cast<float>(size - 1) : 0.0f };
+        for (size_t i{}; i < size; ++i) {
+            float const progress{ static_cast<float>(i) * scale };
+            hues[i] = hueFrom + (hueTo - hueFrom) * progress;
+            saturations[i] = saturationFrom + (saturationTo - saturationFrom) * progress;
+            lightnesses[i] = lightnessFrom + (lightnessTo - lightnessFrom) * progress;
+        }
+
+        std::vector<Color> colors(size, Color(0.0f, 0.0f, 0.0f, alpha));
+        ColorBatch::hslToRgb(hues, saturations, lightnesses, std::span<Color>(colors));
+        return ColorGradient(std::move(colors));
+    }
+
+    ColorGradient ColorGradient::fromColors(std::span<Color const> colors)
+    {
+        return ColorGradient(std::vector<Color>(colors.begin(), colors.end()));
+    }
+
+    ColorGradient ColorGradient::fromColors(std::initializer_list<Color> colors)
+    {
+        return ColorGradient(std::vector<Color>(colors));
+    }
+
+    void ColorGradient::sample(std::span<float const> parameters, std::span<Color> colors) const
+    {
+        size_t const count{ std::min(parameters.size(), colors.size()) };
+        for (size_t i{}; i < count; ++i) {
+            colors[i] = mColors[indexOf(parameters[i])];
+        }
+    }
+
+    void ColorGradient::sample(std::span<float const> parameters, std::span<ColorRGBA8> colors) const
+    {
+        size_t const count{ std::min(parameters.size(), colors.size()) };
+        for (size_t i{}; i < count; ++i) {
+            colors[i] = mPackedColors[indexOf(parameters[i])];
+        }
+    }
+
+} // namespace ezgame
@@ -0,0 +1,82 @@
+// Liste de commandes de dessin.
+//
+// Des cercles enregistrés l'un après l'autre avec le même alignement sont
+// réunis dans une seule commande : dessiner un cercle à la fois dans une
+// boucle produit autant de commandes qu'un seul CircleBatch.
+
+
+// Inclusion des bibliothèques
+#include "DrawList.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    void DrawList::addClear(Color const& color)
+    {
+        mCommands.push_back(Command{ Kind::Clear, Alignment::CenterCenter, mClearColors.size(), 1 });
+        mClearColors.push_back(color);
+    }
+
+    void DrawList::add(Circle const& circle)
+    {
+        Vect2d const position{ circle.position() };
+        addCircles(circle.alignment(), 1);
+        mX.push_back(position.x());
+        mY.push_back(position.y());
+        mRadius.push_back(circle.radius());
+        mFillColor.push_back(circle.fillColor());
+        mEdgeColor.push_back(circle.edgeColor());
+        mEdgeSize.push_back(circle.edgeSize());
+    }
+
+    void DrawList::add(CircleBatch const& circles)
+    {
+        size_t const count{ circles.size() };
+        if (count == 0) {
+            return;
+        }
+
+        addCircles(circles.alignment(), count);
+        mX.insert(mX.end(), circles.xs(), circles.xs() + count);
+        mY.insert(mY.end(), circles.ys(), circles.ys() + count);
+        mRadius.insert(mRadius.end(), circles.radii(), circles.radii() + count);
+        mFillColor.insert(mFillColor.end(), circles.fillColors(), circles.fillColors() + count);
+        mEdgeColor.insert(mEdgeColor.end(), circles.edgeColors(), circles.edgeColors() + count);
+        mEdgeSize.insert(mEdgeSize.end(), circles.edgeSizes(), circles.edgeSizes() + count);
+    }
+
+    void DrawList::add(Text const& text)
+    {
+        mCommands.push_back(Command{ Kind::Text, text.alignment(), mTextCount, 1 });
+        if (mTextCount < mTexts.size()) {
+            mTexts[mTextCount] = text;
+        } else {
+            mTexts.push_back(text);
+        }
+        ++mTextCount;
+    }
+
+    void DrawList::addCircles(Alignment alignment, size_t count)
+    {
+        if (!mCommands.empty() && mCommands.back().kind == Kind::Circles && mCommands.back().alignment == alignment) {
+            mCommands.back().count += count;
+        } else {
+            mCommands.push_back(Command{ Kind::Circles, alignment, mX.size(), count });
+        }
+    }
+
+    void DrawList::clear()
+    {
+        mCommands.clear();
+        mClearColors.clear();
+        mX.clear();
+        mY.clear();
+        mRadius.clear();
+        mFillColor.clear();
+        mEdgeColor.clear();
+        mEdgeSize.clear();
+        mTextCount = 0;
+    }
+
+} // namespace ezgame
@@ -0,0 +1,75 @@
+// Définitions de la classe FixedTimestep.
+
+
+// Inclusion des bibliothèques
+#include "FixedTimestep.h"
+
+#include <algorithm>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    FixedTimestep::FixedTimestep(int64_t stepMicroseconds, size_t maxStepsPerFrame)
+        : mStep{ std::max(stepMicroseconds, int64_t{}) }
+        , mMaxStepsPerFrame{ std::max(maxStepsPerFrame, size_t{ 1 }) }
+    {
+        reset();
+    }
+
+    int64_t FixedTimestep::step() const
+    {
+        return mStep;
+    }
+
+    size_t FixedTimestep::maxStepsPerFrame() const
+    {
+        return mMaxStepsPerFrame;
+    }
+
+    bool FixedTimestep::isEnabled() const
+    {
+        return mStep > 0;
+    }
+
+    void FixedTimestep::reset()
+    {
+        mAccumulated = std::chrono::microseconds(mStep);
+        mDroppedSteps = 0;
+    }
+
+    size_t FixedTimestep::advance(Duration elapsed)
+    {
+        if (!isEnabled()) {
+            return 1;
+        }
+
+        // Rattrape le temps écoulé par pas fixes, en abandonnant le retard
+        // au-delà du nombre maximum de pas.
+        Duration const step{ std::chrono::microseconds(mStep) };
+        mAccumulated += std::max(elapsed, Duration{});
+        size_t steps{ static_cast<size_t>(mAccumulated / step) };
+        if (steps > mMaxStepsPerFrame) {
+            mDroppedSteps += steps - mMaxStepsPerFrame;
+            steps = mMaxStepsPerFrame;
+            mAccumulated %= step;
+        } else {
+            mAccumulated -= step * static_cast<int64_t>(steps);
+        }
+        return steps;
+    }
+
+    float FixedTimestep::interpolation() const
+    {
+        if (!isEnabled()) {
+            return 0.0f;
+        }
+        return static_cast<float>(std::chrono::duration<double, std::micro>(mAccumulated).count() / static_cast<double>(mStep));
+    }
+
+    size_t FixedTimestep::droppedSteps() const
+    {
+        return mDroppedSteps;
+    }
+
+} // namespace ezgame
@@ -0,0 +1,536 @@
+// Lecture minimale d'une police TrueType et dessin des glyphes.
+//
+// Les contours quadratiques d'un glyphe sont aplatis en segments (le
+// nombre de segments d'une courbe dépend de sa courbure à la taille
+// demandée), puis chaque ligne de pixels est balayée quatre fois : pour
+// chaque ligne de balayage, les intersections avec les segments sont
+// triées et les intervalles de nombre d'enroulement non nul sont
+// accumulés avec leur couverture horizontale exacte.
+
+
+// Inclusion des bibliothèques
+#include "Font.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    namespace {
+
+        // Nombre de lignes de balayage par ligne de pixels.
+        size_t const smSubScanlineCount{ 4 };
+        // Écart maximal (en pixels) entre une courbe et ses segments.
+        float const smFlatnessTolerance{ 0.1f };
+        // Profondeur maximale des glyphes composés.
+        int const smMaximumCompoundDepth{ 8 };
+
+        // Les tables TrueType sont en gros-boutiste.
+        uint16_t u16(std::vector<uint8_t> const & data, size_t offset)
+        {
+            return offset + 2 <= data.size() ? static_cast<uint16_t>(data[offset] << 8 | data[offset + 1]) : 0;
+        }
+
+        int16_t i16(std::vector<uint8_t> const & data, size_t offset)
+        {
+            return static_cast<int16_t>(u16(data, offset));
+        }
+
+        uint32_t u32(std::vector<uint8_t> const & data, size_t offset)
+        {
+            return static_cast<uint32_t>(u16(data, offset)) << 16 | u16(data, offset + 2);
+        }
+
+        // Lecture bornée des données d'un glyphe : une lecture au-delà de
+        // la fin du glyphe retourne 0 et marque la lecture comme échouée.
+        class GlyphReader
+        {
+        public:
+            GlyphReader(std::vector<uint8_t> const & data, size_t cursor, size_t end)
+                : mData{ data }, mCursor{ cursor }, mEnd{ end }
+            {
+            }
+
+            uint8_t u8()
+            {
+                return reserve(1) ? mData[mCursor++] : 0;
+            }
+
+            uint16_t u16()
+            {
+                if (!reserve(2)) {
+                    return 0;
+                }
+                mCursor += 2;
+                return static_cast<uint16_t>(mData[mCursor - 2] << 8 | mData[mCursor - 1]);
+            }
+
+            int16_t i16()
+            {
+                return static_cast<int16_t>(u16());
+            }
+
+            void skip(size_t count)
+            {
+                if (reserve(count)) {
+                    mCursor += count;
+                }
+            }
+
+            bool failed() const
+            {
+                return mFailed;
+            }
+
+        private:
+            std::vector<uint8_t> const & mData;
+            size_t mCursor;
+            size_t mEnd;
+            bool mFailed{};
+
+            bool reserve(size_t count)
+            {
+                mFailed = mFailed || mEnd - mCursor < count;
+                return !mFailed;
+            }
+        };
+
+        struct Segment
+        {
+            float x0;
+            float y0;
+            float x1;
+            float y1;
+        };
+
+        struct Crossing
+        {
+            float x;
+            int winding;
+        };
+
+        void addQuadratic(std::vector<Segment> & segments, float x0, float y0, float cx, float cy, float x1, float y1)
+        {
+            // Après n segments, l'écart est d'au plus |p0 - 2c + p1| / (8 n²).
+            float const deviation{ std::hypot(x0 - 2.0f * cx + x1, y0 - 2.0f * cy + y1) };
+            int const count{ std::clamp(static_cast<int>(std::ceil(std::sqrt(deviation / (8.0f * smFlatnessTolerance)))), 1, 32) };
+            float px{ x0 };
+            float py{ y0 };
+            for (int i{ 1 }; i <= count; ++i) {
+                float const t{ static_cast<float>(i) / static_cast<float>(count) };
+                float const u{ 1.0f - t };
+                float const x{ u * u * x0 + 2.0f * u * t * cx + t * t * x1 };
+                float const y{ u * u * y0 + 2.0f * u * t * cy + t * t * y1 };
+                segments.push_back(Segment{ px, py, x, y });
+                px = x;
+                py = y;
+            }
+        }
+
+    } // namespace
+
+    bool Font::load(std::string const& fileName)
+    {
+        *this = Font();
+
+        std::ifstream file(fileName, std::ios::binary);
+        if (!file) {
+            return false;
+        }
+        std::vector<uint8_t> data{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+
+        size_t head{};
+        size_t hhea{};
+        size_t maxp{};
+        size_t const tableCount{ u16(data, 4) };
+        for (size_t i{}; i < tableCount; ++i) {
+            size_t const record{ 12 + 16 * i };
+            if (record + 16 > data.size()) {
+                return false;
+            }
+            std::string const tag(reinterpret_cast<char const *>(data.data() + record), 4);
+            size_t const offset{ u32(data, record + 8) };
+            if (tag == "cmap") mCmap = offset;
+            else if (tag == "glyf") mGlyf = offset;
+            else if (tag == "loca") mLoca = offset;
+            else if (tag == "hmtx") mHmtx = offset;
+            else if (tag == "head") head = offset;
+            else if (tag == "hhea") hhea = offset;
+            else if (tag == "maxp") maxp = offset;
+        }
+        if (!mCmap || !mGlyf || !mLoca || !mHmtx || !head || !hhea || !maxp) {
+            *this = Font();
+            return false;
+        }
+
+        mUnitsPerEm = static_cast<float>(u16(data, head + 18));
+        mLongOffsets = i16(data, head + 50) != 0;
+        mGlyphCount = u16(data, maxp + 4);
+        mAscender = static_cast<float>(i16(data, hhea + 4));
+        mDescender = static_cast<float>(i16(data, hhea + 6));
+        mLineGap = static_cast<float>(i16(data, hhea + 8));
+        mMetricCount = u16(data, hhea + 34);
+
+        // Sous-table Unicode : format 12 (tous les plans) de préférence,
+        // sinon format 4 (plan multilingue de base).
+        size_t const cmap{ mCmap };
+        mCmap = 0;
+        size_t const encodingCount{ u16(data, cmap + 2) };
+        for (size_t i{}; i < encodingCount; ++i) {
+            size_t const record{ cmap + 4 + 8 * i };
+            uint16_t const platform{ u16(data, record) };
+            uint16_t const encoding{ u16(data, record + 2) };
+            size_t const subtable{ cmap + u32(data, record + 4) };
+            uint16_t const format{ u16(data, subtable) };
+            bool const unicode{ platform == 0 || (platform == 3 && (encoding == 1 || encoding == 10)) };
+            if (unicode && (format == 12 || (format == 4 && !mCmap))) {
+                mCmap = subtable;
+            }
+        }
+        if (!mCmap || mUnitsPerEm <= 0.0f || mMetricCount == 0) {
+            *this = Font();
+            return false;
+        }
+
+        mData = std::move(data);
+        return true;
+    }
+
+    uint32_t Font::glyphIndex(char32_t codePoint) const
+    {
+        if (!isLoaded()) {
+            return 0;
+        }
+
+        uint32_t const code{ static_cast<uint32_t>(codePoint) };
+        if (u16(mData, mCmap) == 12) {
+            size_t const groupCount{ u32(mData, mCmap + 12) };
+            size_t low{};
+            size_t high{ groupCount };
+            while (low < high) {
+                size_t const middle{ (low + high) / 2 };
+                size_t const group{ mCmap + 16 + 12 * middle };
+                if (code < u32(mData, group)) {
+                    high = middle;
+                } else if (code > u32(mData, group + 4)) {
+                    low = middle + 1;
+                } else {
+                    return u32(mData, group + 8) + code - u32(mData, group);
+                }
+            }
+            return 0;
+        }
+
+        if (code > 0xFFFF) {
+            return 0;
+        }
+        size_t const segmentCount{ u16(mData, mCmap + 6) / 2u };
+        size_t const endCodes{ mCmap + 14 };
+        size_t const startCodes{ endCodes + 2 * segmentCount + 2 };
+        size_t const deltas{ startCodes + 2 * segmentCount };
+        size_t const rangeOffsets{ deltas + 2 * segmentCount };
+        size_t low{};
+        size_t high{ segmentCount };
+        while (low < high) {
+            size_t const middle{ (low + high) / 2 };
+            if (code > u16(mData, endCodes + 2 * middle)) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        if (low == segmentCount || code < u16(mData, startCodes + 2 * low)) {
+            return 0;
+        }
+
+        uint16_t const delta{ u16(mData, deltas + 2 * low) };
+        uint16_t const rangeOffset{ u16(mData, rangeOffsets + 2 * low) };
+        if (rangeOffset == 0) {
+            return static_cast<uint16_t>(code + delta);
+        }
+        size_t const address{ rangeOffsets + 2 * low + rangeOffset + 2 * (code - u16(mData, startCodes + 2 * low)) };
+        uint16_t const glyph{ u16(mData, address) };
+        return glyph == 0 ? 0 : static_cast<uint16_t>(glyph + delta);
+    }
+
+    float Font::advance(uint32_t glyph, float size) const
+    {
+        if (!isLoaded()) {
+            return 0.0f;
+        }
+        size_t const metric{ std::min(static_cast<size_t>(glyph), mMetricCount - 1) };
+        return static_cast<float>(u16(mData, mHmtx + 4 * metric)) * size / mUnitsPerEm;
+    }
+
+    bool Font::glyphRange(uint32_t glyph, size_t & begin, size_t & end) const
+    {
+        if (glyph >= mGlyphCount) {
+            return false;
+        }
+        if (mLongOffsets) {
+            begin = mGlyf + u32(mData, mLoca + 4 * glyph);
+            end = mGlyf + u32(mData, mLoca + 4 * glyph + 4);
+        } else {
+            begin = mGlyf + 2 * static_cast<size_t>(u16(mData, mLoca + 2 * glyph));
+            end = mGlyf + 2 * static_cast<size_t>(u16(mData, mLoca + 2 * glyph + 2));
+        }
+        return begin < end && end <= mData.size();
+    }
+
+    bool Font::outline(uint32_t glyph, std::vector<Point> & points, std::vector<size_t> & contourEnds, int depth) const
+    {
+        size_t offset{};
+        size_t end{};
+        if (depth > smMaximumCompoundDepth) {
+            return false;
+        }
+        if (!glyphRange(glyph, offset, end)) {
+            // Un glyphe sans données (une espace) n'a aucun contour.
+            return glyph < mGlyphCount && offset == end;
+        }
+
+        // En-tête : nombre de contours et boîte englobante (ignorée).
+        GlyphReader reader(mData, offset, end);
+        int16_t const contourCount{ reader.i16() };
+        reader.skip(8);
+        if (contourCount >= 0) {
+            // Glyphe simple : fins des contours, instructions (ignorées),
+            // drapeaux (avec répétition), puis coordonnées relatives.
+            size_t const first{ points.size() };
+            size_t pointCount{};
+            for (int16_t i{}; i < contourCount; ++i) {
+                size_t const contourEnd{ reader.u16() + size_t{ 1 } };
+                if (contourEnd <= pointCount) {
+                    return false;
+                }
+                pointCount = contourEnd;
+                contourEnds.push_back(first + contourEnd);
+            }
+            reader.skip(reader.u16());
+
+            std::vector<uint8_t> flags;
+            flags.reserve(pointCount);
+            while (flags.size() < pointCount && !reader.failed()) {
+                uint8_t const flag{ reader.u8() };
+                size_t repeat{ 1 };
+                if (flag & 8) {
+                    repeat += reader.u8();
+                }
+                flags.insert(flags.end(), std::min(repeat, pointCount - flags.size()), flag);
+            }
+
+            points.resize(first + pointCount);
+            int value{};
+            for (size_t i{}; i < pointCount && !reader.failed(); ++i) {
+                if (flags[i] & 2) {
+                    value += flags[i] & 16 ? reader.u8() : -reader.u8();
+                } else if (!(flags[i] & 16)) {
+                    value += reader.i16();
+                }
+                points[first + i].x = static_cast<float>(value);
+                points[first + i].onCurve = flags[i] & 1;
+            }
+            value = 0;
+            for (size_t i{}; i < pointCount && !reader.failed(); ++i) {
+                if (flags[i] & 4) {
+                    value += flags[i] & 32 ? reader.u8() : -reader.u8();
+                } else if (!(flags[i] & 32)) {
+                    value += reader.i16();
+                }
+                points[first + i].y = static_cast<float>(value);
+            }
+            return !reader.failed();
+        }
+
+        // Glyphe composé : chaque composant est transformé puis ajouté.
+        uint16_t flags{};
+        do {
+            flags = reader.u16();
+            uint32_t const component{ reader.u16() };
+            float dx{};
+            float dy{};
+            if (flags & 1) {
+                dx = reader.i16();
+                dy = reader.i16();
+            } else {
+                dx = static_cast<int8_t>(reader.u8());
+                dy = static_cast<int8_t>(reader.u8());
+            }
+            if (!(flags & 2)) {
+                // Alignement par points : non pris en charge.
+                dx = 0.0f;
+                dy = 0.0f;
+            }
+            float a{ 1.0f };
+            float b{};
+            float c{};
+            float d{ 1.0f };
+            auto f2dot14 = [&reader]() { return static_cast<float>(reader.i16()) / 16384.0f; };
+            if (flags & 8) {
+                a = d = f2dot14();
+            } else if (flags & 0x40) {
+                a = f2dot14();
+                d = f2dot14();
+            } else if (flags & 0x80) {
+                a = f2dot14();
+                b = f2dot14();
+                c = f2dot14();
+                d = f2dot14();
+            }
+            if (reader.failed()) {
+                return false;
+            }
+
+            size_t const first{ points.size() };
+            if (!outline(component, points, contourEnds, depth + 1)) {
+                return false;
+            }
+            for (size_t i{ first }; i < points.size(); ++i) {
+                float const x{ points[i].x };
+                float const y{ points[i].y };
+                points[i].x = a * x + c * y + dx;
+                points[i].y = b * x + d * y + dy;
+            }
+        } while (flags & 0x20);
+        return true;
+    }
+
+    void Font::rasterize(uint32_t glyph, float size, Bitmap & bitmap) const
+    {
+        bitmap = Bitmap();
+        if (!isLoaded()) {
+            return;
+        }
+
+        // Un glyphe mal formé (lecture au-delà de ses données, contours
+        // incohérents) est rejeté en entier.
+        std::vector<Point> points;
+        std::vector<size_t> contourEnds;
+        if (!outline(glyph, points, contourEnds, 0)) {
+            return;
+        }
+
+        // Aplatissement des contours en pixels (axe y vers le bas). Entre
+        // deux points de contrôle consécutifs, un point sur la courbe est
+        // implicite au milieu.
+        float const scale{ size / mUnitsPerEm };
+        std::vector<Segment> segments;
+        size_t contourBegin{};
+        for (size_t contourEnd : contourEnds) {
+            size_t const count{ contourEnd - contourBegin };
+            if (contourEnd > points.size() || count < 2) {
+                contourBegin = contourEnd;
+                continue;
+            }
+            auto at = [&](size_t i) {
+                Point const & point{ points[contourBegin + i % count] };
+                return Point{ point.x * scale, -point.y * scale, point.onCurve };
+            };
+
+            // Départ sur un point de la courbe.
+            size_t start{};
+            while (start < count && !at(start).onCurve) {
+                ++start;
+            }
+            Point current{ at(start) };
+            if (start == count) {
+                Point const next{ at(1) };
+                current = Point{ (current.x + next.x) * 0.5f, (current.y + next.y) * 0.5f, true };
+                start = 0;
+            }
+            Point const origin{ current };
+            bool hasControl{};
+            Point control{};
+            for (size_t i{ 1 }; i <= count; ++i) {
+                Point const point{ i == count ? origin : at(start + i) };
+                if (point.onCurve) {
+                    if (hasControl) {
+                        addQuadratic(segments, current.x, current.y, control.x, control.y, point.x, point.y);
+                    } else {
+                        segments.push_back(Segment{ current.x, current.y, point.x, point.y });
+                    }
+                    current = point;
+                    hasControl = false;
+                } else if (hasControl) {
+                    Point const middle{ (control.x + point.x) * 0.5f, (control.y + point.y) * 0.5f, true };
+                    addQuadratic(segments, current.x, current.y, control.x, control.y, middle.x, middle.y);
+                    current = middle;
+                    control = point;
+                } else {
+                    control = point;
+                    hasControl = true;
+                }
+            }
+            if (hasControl) {
+                addQuadratic(segments, current.x, current.y, control.x, control.y, origin.x, origin.y);
+            }
+            contourBegin = contourEnd;
+        }
+        if (segments.empty()) {
+            return;
+        }
+
+        float left{ segments[0].x0 };
+        float top{ segments[0].y0 };
+        float right{ left };
+        float bottom{ top };
+        for (Segment const & segment : segments) {
+            left = std::min({ left, segment.x0, segment.x1 });
+            right = std::max({ right, segment.x0, segment.x1 });
+            top = std::min({ top, segment.y0, segment.y1 });
+            bottom = std::max({ bottom, segment.y0, segment.y1 });
+        }
+        bitmap.left = static_cast<int>(std::floor(left));
+        bitmap.top = static_cast<int>(std::floor(top));
+        bitmap.width = static_cast<size_t>(static_cast<int>(std::ceil(right)) - bitmap.left);
+        bitmap.height = static_cast<size_t>(static_cast<int>(std::ceil(bottom)) - bitmap.top);
+        if (bitmap.width == 0 || bitmap.height == 0) {
+            bitmap = Bitmap();
+            return;
+        }
+
+        // Balayage : couverture accumulée en réels, puis convertie.
+        std::vector<float> coverage(bitmap.width * bitmap.height);
+        std::vector<Crossing> crossings;
+        float const weight{ 1.0f / static_cast<float>(smSubScanlineCount) };
+        for (size_t row{}; row < bitmap.height; ++row) {
+            float * line{ coverage.data() + row * bitmap.width };
+            for (size_t sub{}; sub < smSubScanlineCount; ++sub) {
+                float const y{ static_cast<float>(bitmap.top) + static_cast<float>(row) + (static_cast<float>(sub) + 0.5f) * weight };
+                crossings.clear();
+                for (Segment const & segment : segments) {
+                    if ((segment.y0 <= y) != (segment.y1 <= y)) {
+                        float const x{ segment.x0 + (y - segment.y0) * (segment.x1 - segment.x0) / (segment.y1 - segment.y0) };
+                        crossings.push_back(Crossing{ x - static_cast<float>(bitmap.left), segment.y1 > segment.y0 ? 1 : -1 });
+                    }
+                }
+                std::sort(crossings.begin(), crossings.end(), [](Crossing const & a, Crossing const & b) { return a.x < b.x; });
+
+                int winding{};
+                for (size_t i{}; i + 1 < crossings.size(); ++i) {
+                    winding += crossings[i].winding;
+                    if (winding == 0) {
+                        continue;
+                    }
+                    float const from{ std::clamp(crossings[i].x, 0.0f, static_cast<float>(bitmap.width)) };
+                    float const to{ std::clamp(crossings[i + 1].x, 0.0f, static_cast<float>(bitmap.width)) };
+                    size_t const firstPixel{ static_cast<size_t>(from) };
+                    size_t const lastPixel{ std::min(static_cast<size_t>(to), bitmap.width - 1) };
+                    for (size_t x{ firstPixel }; x <= lastPixel && from < to; ++x) {
+                        float const covered{ std::min(to, static_cast<float>(x + 1)) - std::max(from, static_cast<float>(x)) };
+                        line[x] += std::max(covered, 0.0f) * weight;
+                    }
+                }
+            }
+        }
+
+        bitmap.coverage.resize(coverage.size());
+        std::transform(coverage.begin(), coverage.end(), bitmap.coverage.begin(),
+            [](float value) { return static_cast<uint8_t>(std::min(value, 1.0f) * 255.0f + 0.5f); });
+    }
+
+} // namespace ezgame
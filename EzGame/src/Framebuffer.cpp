@@ -0,0 +1,53 @@
+// Image RGBA produite par le rastériseur logiciel.
+
+
+// Inclusion des bibliothèques
+#include "Framebuffer.h"
+
+#include <algorithm>
+#include <fstream>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    Framebuffer::Framebuffer(size_t width, size_t height, ColorRGBA8 color)
+        : mWidth{ width }
+        , mHeight{ height }
+        , mPixels(width * height, color)
+    {
+    }
+
+    void Framebuffer::resize(size_t width, size_t height)
+    {
+        if (width == mWidth && height == mHeight) {
+            return;
+        }
+
+        mWidth = width;
+        mHeight = height;
+        mPixels.assign(width * height, ColorRGBA8());
+    }
+
+    void Framebuffer::fill(ColorRGBA8 color)
+    {
+        std::fill(mPixels.begin(), mPixels.end(), color);
+    }
+
+    bool Framebuffer::save(std::string const& fileName) const
+    {
+        std::string const header{ "P6\n" + std::to_string(mWidth) + ' ' + std::to_string(mHeight) + "\n255\n" };
+        std::vector<char> buffer(header.begin(), header.end());
+        buffer.reserve(header.size() + mPixels.size() * 3);
+        for (ColorRGBA8 const& pixel : mPixels) {
+            buffer.push_back(static_cast<char>(pixel.red()));
+            buffer.push_back(static_cast<char>(pixel.green()));
+            buffer.push_back(static_cast<char>(pixel.blue()));
+        }
+
+        std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        return static_cast<bool>(file);
+    }
+
+} // namespace ezgame
@@ -0,0 +1,73 @@
+// Atlas de glyphes rangés sur des étagères.
+
+
+// Inclusion des bibliothèques
+#include "GlyphAtlas.h"
+
+#include <algorithm>
+#include <cstring>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    namespace {
+
+        // Pixels vides entre deux glyphes.
+        size_t const smPadding{ 1 };
+        // Hauteur initiale de l'atlas.
+        size_t const smInitialHeight{ 64 };
+
+    } // namespace
+
+    GlyphAtlas::GlyphAtlas(Font const & font, float size)
+        : mFont{ font }
+        , mSize{ size }
+        , mHeight{ smInitialHeight }
+        , mPixels(smWidth * smInitialHeight)
+    {
+        mAscii.fill(smMissing);
+    }
+
+    uint32_t GlyphAtlas::add(char32_t codePoint)
+    {
+        uint32_t const glyphIndex{ mFont.glyphIndex(codePoint) };
+        mFont.rasterize(glyphIndex, mSize, mBitmap);
+
+        // Un glyphe plus large que l'atlas est rogné.
+        size_t const width{ std::min(mBitmap.width, smWidth - smPadding) };
+        size_t const height{ mBitmap.height };
+        if (mShelfX + width + smPadding > smWidth) {
+            mShelfY += mShelfHeight + smPadding;
+            mShelfX = 0;
+            mShelfHeight = 0;
+        }
+        while (mShelfY + height + smPadding > mHeight) {
+            mHeight *= 2;
+        }
+        mPixels.resize(smWidth * mHeight);
+
+        Glyph const glyph{
+            static_cast<uint16_t>(mShelfX), static_cast<uint16_t>(mShelfY),
+            static_cast<uint16_t>(width), static_cast<uint16_t>(height),
+            static_cast<int16_t>(mBitmap.left), static_cast<int16_t>(mBitmap.top),
+            mFont.advance(glyphIndex, mSize) };
+        for (size_t y{}; y < height; ++y) {
+            std::memcpy(mPixels.data() + (mShelfY + y) * smWidth + mShelfX, mBitmap.coverage.data() + y * mBitmap.width, width);
+        }
+        if (width > 0) {
+            mShelfX += width + smPadding;
+            mShelfHeight = std::max(mShelfHeight, height);
+        }
+
+        uint32_t const index{ static_cast<uint32_t>(mGlyphs.size()) };
+        mGlyphs.push_back(glyph);
+        if (codePoint < mAscii.size()) {
+            mAscii[codePoint] = index;
+        } else {
+            mOthers.emplace(codePoint, index);
+        }
+        return index;
+    }
+
+} // namespace ezgame
@@ -0,0 +1,164 @@
+// Enregistrement des entrées d'une session et format de fichier associé.
+//
+// Voir InputRecording pour la description du format. Les états du clavier
+// ne sont pas écrits en entier : seules les touches qui changent d'état
+// d'un pas de simulation à l'autre le sont.
+
+
+// Inclusion des bibliothèques
+#include "InputRecording.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <utility>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    namespace {
+
+        char const smMagic[4]{ 'E', 'Z', 'I', 'R' };
+        uint8_t const smVersion{ 1 };
+        size_t const smKeyCount{ static_cast<size_t>(Keyboard::Key::__count__) };
+
+        void writeVarint(std::vector<char> & buffer, uint64_t value)
+        {
+            while (value >= 0x80) {
+                buffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            buffer.push_back(static_cast<char>(value));
+        }
+
+        // Lit un entier à partir de `position`. Retourne faux si le tampon
+        // se termine avant la fin de l'entier.
+        bool readVarint(std::vector<char> const & buffer, size_t & position, uint64_t & value)
+        {
+            value = 0;
+            for (int shift{}; shift < 64; shift += 7) {
+                if (position >= buffer.size()) {
+                    return false;
+                }
+                uint8_t const byte{ static_cast<uint8_t>(buffer[position++]) };
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    } // namespace
+
+    size_t InputRecording::size() const
+    {
+        return mFrames.size();
+    }
+
+    bool InputRecording::empty() const
+    {
+        return mFrames.empty();
+    }
+
+    InputRecording::Frame const& InputRecording::operator[](size_t index) const
+    {
+        return mFrames[index];
+    }
+
+    std::vector<InputRecording::Frame> const& InputRecording::frames() const
+    {
+        return mFrames;
+    }
+
+    void InputRecording::add(Keyboard::KeySet const& keys, int64_t sinceLastTic)
+    {
+        mFrames.push_back(Frame{ keys, sinceLastTic > 0 ? sinceLastTic : 0 });
+    }
+
+    void InputRecording::reserve(size_t frameCount)
+    {
+        mFrames.reserve(frameCount);
+    }
+
+    void InputRecording::clear()
+    {
+        mFrames.clear();
+    }
+
+    bool InputRecording::save(std::string const& fileName) const
+    {
+        std::vector<char> buffer(std::begin(smMagic), std::end(smMagic));
+        buffer.reserve(16 + mFrames.size() * 2);
+        buffer.push_back(static_cast<char>(smVersion));
+        buffer.push_back(static_cast<char>(smKeyCount));
+        writeVarint(buffer, mFrames.size());
+
+        Keyboard::KeySet previous;
+        for (Frame const& frame : mFrames) {
+            Keyboard::KeySet const changed{ frame.keys ^ previous };
+            writeVarint(buffer, static_cast<uint64_t>(frame.sinceLastTic));
+            writeVarint(buffer, changed.count());
+            for (size_t key{}; key < smKeyCount; ++key) {
+                if (changed.test(key)) {
+                    writeVarint(buffer, key);
+                }
+            }
+            previous = frame.keys;
+        }
+
+        std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+        file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        return static_cast<bool>(file);
+    }
+
+    bool InputRecording::load(std::string const& fileName)
+    {
+        mFrames.clear();
+
+        std::ifstream file(fileName, std::ios::binary);
+        if (!file) {
+            return false;
+        }
+        std::vector<char> const buffer{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+
+        size_t position{ sizeof(smMagic) + 2 };
+        if (buffer.size() < position
+            || !std::equal(std::begin(smMagic), std::end(smMagic), buffer.begin())
+            || static_cast<uint8_t>(buffer[4]) != smVersion
+            || static_cast<uint8_t>(buffer[5]) != smKeyCount) {
+            return false;
+        }
+
+        uint64_t frameCount{};
+        if (!readVarint(buffer, position, frameCount) || frameCount > buffer.size()) {
+            return false;
+        }
+
+        std::vector<Frame> frames;
+        frames.reserve(static_cast<size_t>(frameCount));
+        Keyboard::KeySet keys;
+        for (uint64_t frame{}; frame < frameCount; ++frame) {
+            uint64_t sinceLastTic{};
+            uint64_t changedCount{};
+            if (!readVarint(buffer, position, sinceLastTic) || sinceLastTic > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())
+                || !readVarint(buffer, position, changedCount) || changedCount > smKeyCount) {
+                return false;
+            }
+            for (uint64_t change{}; change < changedCount; ++change) {
+                uint64_t key{};
+                if (!readVarint(buffer, position, key) || key >= smKeyCount) {
+                    return false;
+                }
+                keys.flip(static_cast<size_t>(key));
+            }
+            frames.push_back(Frame{ keys, static_cast<int64_t>(sinceLastTic) });
+        }
+
+        mFrames = std::move(frames);
+        return true;
+    }
+
+} // namespace ezgame
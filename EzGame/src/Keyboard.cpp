@@ -0,0 +1,57 @@
+// Définitions de la classe Keyboard.
+//
+// Les requêtes lisent l'instantané capturé par Application à chaque pas de 
+// simulation. La capture elle-même (Keyboard::poll) est l'implémentation 
+// sans fenêtre (headless) : aucune touche ne peut être appuyée, 
+// l'instantané capturé est vide.
+
+
+// Inclusion des bibliothèques
+#include "Keyboard.h"
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    bool Keyboard::isKeyPressed(Key key) const
+    {
+        return isValid(key) && mPressed.test(static_cast<size_t>(key));
+    }
+
+    bool Keyboard::wasKeyPressed(Key key) const
+    {
+        return isValid(key) && mPressed.test(static_cast<size_t>(key)) && !mPreviouslyPressed.test(static_cast<size_t>(key));
+    }
+
+    bool Keyboard::wasKeyReleased(Key key) const
+    {
+        return isValid(key) && !mPressed.test(static_cast<size_t>(key)) && mPreviouslyPressed.test(static_cast<size_t>(key));
+    }
+
+    Keyboard::KeyRange Keyboard::pressedKeys() const
+    {
+        return KeyRange(mPressed);
+    }
+
+    Keyboard::KeySet const& Keyboard::state() const
+    {
+        return mPressed;
+    }
+
+    Keyboard::KeySet Keyboard::poll()
+    {
+        return KeySet{};
+    }
+
+    void Keyboard::update(KeySet const& pressed)
+    {
+        mPreviouslyPressed = mPressed;
+        mPressed = pressed;
+    }
+
+    bool Keyboard::isValid(Key key)
+    {
+        return key >= Key::A && key < Key::__count__;
+    }
+
+} // namespace ezgame
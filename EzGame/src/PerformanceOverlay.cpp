@@ -0,0 +1,122 @@
+// Définitions de la classe PerformanceOverlay.
+//
+// La surcouche occupe le coin supérieur gauche : une colonne d'étiquettes,
+// une colonne de valeurs alignées à droite, puis la courbe des derniers
+// temps par image. La courbe défile : le point le plus récent est à droite.
+// Sa hauteur correspond à deux fois le budget par image; un temps plus long
+// est dessiné en haut.
+
+
+// Inclusion des bibliothèques
+#include "PerformanceOverlay.h"
+#include "AllocationCounter.h"
+#include "Screen.h"
+#include "Timer.h"
+
+#include <algorithm>
+#include <string>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    namespace {
+
+        float const smLeft{ 10.0f };
+        float const smTop{ 10.0f };
+        float const smValueRight{ 190.0f };
+        float const smLineHeight{ 16.0f };
+        float const smTextSize{ 14.0f };
+        float const smCurveHeight{ 40.0f };
+        float const smCurveStep{ 2.8f };
+        float const smPointRadius{ 1.5f };
+
+        char const * const smLabelTexts[]{ "images/s", "p50 (ms)", "p99 (ms)", "max (ms)", "appels de rendu", "objets", "allocations/image" };
+
+    } // namespace
+
+    PerformanceOverlay::PerformanceOverlay()
+        : mCurve(smSampleCount)
+    {
+        for (size_t line{}; line < LineCount; ++line) {
+            Vect2d const position(smLeft, smTop + smLineHeight * static_cast<float>(line));
+            mLabels[line] = Text(smLabelTexts[line], smTextSize, position, Color::LightGray, Color::Black, 0.0f, Alignment::TopLeft);
+            mValues[line] = Text(std::string(), smTextSize, Vect2d(smValueRight, position.y()), Color::White, Color::Black, 0.0f, Alignment::TopRight);
+        }
+        if (!AllocationCounter::isEnabled()) {
+            mValues[Allocations].setText("n/d");
+        }
+
+        float const bottom{ smTop + smLineHeight * static_cast<float>(LineCount) + smCurveHeight };
+        for (size_t sample{}; sample < smSampleCount; ++sample) {
+            mCurve.add(smPointRadius, Vect2d(smLeft + smCurveStep * static_cast<float>(sample), bottom), Color::Lime);
+        }
+    }
+
+    void PerformanceOverlay::update(Timer const & frameTimer, size_t drawCallCount, size_t entityCount, size_t allocationCount)
+    {
+        if (!mStarted) {
+            // Référence du nombre d'allocations.
+            mStarted = true;
+            mAllocationsAtRefresh = allocationCount;
+            return;
+        }
+
+        int64_t const frameTime{ frameTimer.sinceLastTic() };
+        mSamples[mSampleIndex] = frameTime;
+        mSampleIndex = (mSampleIndex + 1) % smSampleCount;
+        mSinceRefresh += frameTime;
+        ++mFramesSinceRefresh;
+
+        // Courbe : le point i est l'image (mSampleIndex + i), de la plus
+        // ancienne à la plus récente.
+        int64_t const budget{ std::max(frameTimer.frameBudget(), int64_t{ 1 }) };
+        float const bottom{ smTop + smLineHeight * static_cast<float>(LineCount) + smCurveHeight };
+        float * const ys{ mCurve.ys() };
+        Color * const colors{ mCurve.fillColors() };
+        for (size_t sample{}; sample < smSampleCount; ++sample) {
+            int64_t const time{ mSamples[(mSampleIndex + sample) % smSampleCount] };
+            float const height{ std::min(static_cast<float>(time) / static_cast<float>(2 * budget), 1.0f) };
+            ys[sample] = bottom - height * smCurveHeight;
+            colors[sample] = time <= budget ? Color::Lime : (time <= 2 * budget ? Color::Yellow : Color::Red);
+        }
+
+        if (mSinceRefresh < smRefreshInterval) {
+            return;
+        }
+
+        mValues[FramesPerSecond].setText(static_cast<float>(mFramesSinceRefresh) * 1.0e6f / static_cast<float>(mSinceRefresh), 1);
+        mValues[Percentile50].setText(static_cast<float>(frameTimer.percentile(0.50)) * 1.0e-3f, 2);
+        mValues[Percentile99].setText(static_cast<float>(frameTimer.percentile(0.99)) * 1.0e-3f, 2);
+        mValues[Maximum].setText(static_cast<float>(frameTimer.max()) * 1.0e-3f, 2);
+        mValues[DrawCalls].setText(drawCallCount);
+        mValues[Entities].setText(entityCount);
+        if (AllocationCounter::isEnabled()) {
+            mValues[Allocations].setText(static_cast<float>(allocationCount - mAllocationsAtRefresh) / static_cast<float>(mFramesSinceRefresh), 1);
+        }
+
+        mSinceRefresh = 0;
+        mFramesSinceRefresh = 0;
+        mAllocationsAtRefresh = allocationCount;
+        mRefreshed = true;
+    }
+
+    void PerformanceOverlay::reset()
+    {
+        mSinceRefresh = 0;
+        mFramesSinceRefresh = 0;
+        mStarted = false;
+    }
+
+    void PerformanceOverlay::draw(Screen & screen) const
+    {
+        for (size_t line{}; line < LineCount; ++line) {
+            screen.draw(mLabels[line]);
+            if (mRefreshed) {
+                screen.draw(mValues[line]);
+            }
+        }
+        screen.draw(mCurve);
+    }
+
+} // namespace ezgame
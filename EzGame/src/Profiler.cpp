@@ -0,0 +1,215 @@
+// Registre des tampons de zones et exportation au format Chrome Trace
+// Event.
+//
+// Les tampons ne sont jamais libérés : lorsqu'un fil se termine, son
+// tampon (et les zones qu'il contient) est repris par le prochain fil
+// inscrit. L'exportation copie chaque tampon sans bloquer son fil, puis
+// écarte les zones qu'il a pu écraser pendant la copie.
+//
+// Le compteur d'horloge est converti en microsecondes en le comparant à
+// std::chrono::steady_clock depuis la création du registre.
+
+
+// Inclusion des bibliothèques
+#include "Profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    namespace {
+
+        // Durée minimale de l'étalonnage du compteur d'horloge.
+        std::chrono::milliseconds const smCalibrationTime{ 10 };
+
+        struct Event
+        {
+            char const * name;
+            uint64_t begin;
+            uint64_t end;
+            size_t thread;
+        };
+
+        void appendEscaped(std::string & output, char const * text)
+        {
+            for (; *text; ++text) {
+                if (*text == '"' || *text == '\\') {
+                    output += '\\';
+                }
+                output += static_cast<unsigned char>(*text) < 0x20 ? ' ' : *text;
+            }
+        }
+
+    } // namespace
+
+    //! \cond PRIVATE
+    struct Profiler::Registry
+    {
+        struct Thread
+        {
+            std::unique_ptr<ThreadEvents> events;
+            std::string name;
+            bool active;
+        };
+
+        // Libère le tampon du fil à sa fin.
+        struct Release
+        {
+            ThreadEvents * events{};
+
+            ~Release()
+            {
+                if (events) {
+                    Registry & registry{ instance() };
+                    std::lock_guard const lock{ registry.mutex };
+                    for (Thread & thread : registry.threads) {
+                        thread.active = thread.active && thread.events.get() != events;
+                    }
+                }
+            }
+        };
+
+        std::mutex mutex;
+        std::vector<Thread> threads;
+        std::unique_ptr<std::atomic<uint64_t>[]> frames{ std::make_unique<std::atomic<uint64_t>[]>(smFrameCapacity) };
+        std::atomic<uint64_t> frameHead{};
+        std::chrono::steady_clock::time_point const startTime{ std::chrono::steady_clock::now() };
+        uint64_t const startTicks{ ticks() };
+
+        static Registry & instance()
+        {
+            static Registry registry;
+            return registry;
+        }
+    };
+    //! \endcond
+
+    Profiler::ThreadEvents & Profiler::registerThread()
+    {
+        Registry & registry{ Registry::instance() };
+        static thread_local Registry::Release release;
+
+        std::lock_guard const lock{ registry.mutex };
+        auto thread{ std::find_if(registry.threads.begin(), registry.threads.end(), [](Registry::Thread const & thread) { return !thread.active; }) };
+        if (thread == registry.threads.end()) {
+            std::unique_ptr<ThreadEvents> events{ std::make_unique<ThreadEvents>() };
+            events->slots = std::make_unique<Slot[]>(smEventCapacity);
+            registry.threads.push_back(Registry::Thread{ std::move(events), std::string(), true });
+            thread = registry.threads.end() - 1;
+        }
+        thread->active = true;
+        thread->name = "fil " + std::to_string(thread - registry.threads.begin() + 1);
+        release.events = thread->events.get();
+        stEvents = thread->events.get();
+        return *stEvents;
+    }
+
+    void Profiler::markFrame() noexcept
+    {
+        Registry & registry{ Registry::instance() };
+        uint64_t const head{ registry.frameHead.load(std::memory_order_relaxed) };
+        registry.frames[head % smFrameCapacity].store(ticks(), std::memory_order_relaxed);
+        registry.frameHead.store(head + 1, std::memory_order_release);
+    }
+
+    size_t Profiler::frameCount() noexcept
+    {
+        return static_cast<size_t>(Registry::instance().frameHead.load(std::memory_order_acquire));
+    }
+
+    void Profiler::setThreadName(std::string const & name)
+    {
+        ThreadEvents * events{ stEvents ? stEvents : &registerThread() };
+        Registry & registry{ Registry::instance() };
+        std::lock_guard const lock{ registry.mutex };
+        for (Registry::Thread & thread : registry.threads) {
+            if (thread.events.get() == events) {
+                thread.name = name;
+            }
+        }
+    }
+
+    bool Profiler::save(std::string const & fileName, size_t frameCount)
+    {
+        Registry & registry{ Registry::instance() };
+
+        // Début de la plus ancienne image exportée.
+        uint64_t start{};
+        uint64_t const frameHead{ registry.frameHead.load(std::memory_order_acquire) };
+        if (frameHead > 0 && frameCount > 0) {
+            uint64_t const exported{ std::min<uint64_t>({ frameCount, frameHead, smFrameCapacity }) };
+            start = registry.frames[(frameHead - exported) % smFrameCapacity].load(std::memory_order_relaxed);
+        }
+
+        // Copie des tampons.
+        std::vector<Event> events;
+        std::vector<std::string> threadNames;
+        {
+            std::lock_guard const lock{ registry.mutex };
+            for (size_t index{}; index < registry.threads.size(); ++index) {
+                ThreadEvents const & thread{ *registry.threads[index].events };
+                threadNames.push_back(registry.threads[index].name);
+
+                uint64_t const head{ thread.head.load(std::memory_order_acquire) };
+                uint64_t const first{ head > smEventCapacity ? head - smEventCapacity : 0 };
+                size_t const copied{ events.size() };
+                for (uint64_t i{ first }; i < head; ++i) {
+                    Slot const & slot{ thread.slots[i & (smEventCapacity - 1)] };
+                    events.push_back(Event{ slot.name.load(std::memory_order_relaxed), slot.begin.load(std::memory_order_relaxed), slot.end.load(std::memory_order_relaxed), index });
+                }
+
+                // Zones écrasées (ou en cours d'écriture) pendant la copie.
+                std::atomic_thread_fence(std::memory_order_acquire);
+                uint64_t const overwritten{ thread.head.load(std::memory_order_relaxed) + 1 };
+                size_t const discarded{ static_cast<size_t>(std::min(overwritten > smEventCapacity ? overwritten - smEventCapacity - first : 0, head - first)) };
+                events.erase(events.begin() + static_cast<std::ptrdiff_t>(copied), events.begin() + static_cast<std::ptrdiff_t>(copied + discarded));
+            }
+        }
+        std::erase_if(events, [start](Event const & event) { return event.begin < start; });
+        std::sort(events.begin(), events.end(), [](Event const & a, Event const & b) { return a.begin < b.begin; });
+
+        // Étalonnage du compteur d'horloge.
+        std::chrono::steady_clock::duration const elapsed{ std::chrono::steady_clock::now() - registry.startTime };
+        if (elapsed < smCalibrationTime) {
+            std::this_thread::sleep_for(smCalibrationTime - elapsed);
+        }
+        double const microseconds{ std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - registry.startTime).count() };
+        double const ticksPerMicrosecond{ static_cast<double>(ticks() - registry.startTicks) / microseconds };
+        uint64_t const origin{ start > 0 || events.empty() ? start : events.front().begin };
+
+        std::string output{ "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n" };
+        char buffer[128];
+        for (size_t thread{}; thread < threadNames.size(); ++thread) {
+            std::snprintf(buffer, sizeof(buffer), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%zu,\"args\":{\"name\":\"", thread + 1);
+            output += buffer;
+            appendEscaped(output, threadNames[thread].c_str());
+            output += "\"}},\n";
+        }
+        for (Event const & event : events) {
+            output += "{\"name\":\"";
+            appendEscaped(output, event.name ? event.name : "?");
+            std::snprintf(buffer, sizeof(buffer), "\",\"ph\":\"X\",\"pid\":1,\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f},\n",
+                event.thread + 1, static_cast<double>(event.begin - origin) / ticksPerMicrosecond, static_cast<double>(event.end - event.begin) / ticksPerMicrosecond);
+            output += buffer;
+        }
+        // Retire le séparateur ",\n" de la dernière entrée, s'il y en a une.
+        if (!threadNames.empty() || !events.empty()) {
+            output.resize(output.size() - 2);
+            output += '\n';
+        }
+        output += "]}\n";
+
+        std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+        file.write(output.data(), static_cast<std::streamsize>(output.size()));
+        return static_cast<bool>(file);
+    }
+
+} // namespace ezgame
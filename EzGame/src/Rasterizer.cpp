@@ -0,0 +1,419 @@
+// Rastériseur logiciel par tuiles.
+//
+// Le mélange d'une couleur à un pixel se fait en entiers :
+//     (destination * (255 - alpha) + source * alpha) / 255
+// arrondi au plus proche, pour chacune des composantes. La composante
+// alpha du résultat utilise la même formule avec une source de 255
+// (opération « par-dessus »). La version SSE2 traite 4 pixels à la fois et
+// donne exactement le même résultat que la version scalaire.
+//
+// Les fils d'exécution sont créés une seule fois. Pour chaque image, le
+// fil appelant publie le travail (compteur de génération), puis tous les
+// fils, y compris l'appelant, se partagent les tuiles par un compteur
+// atomique. L'appelant attend enfin que chaque fil ait terminé.
+
+
+// Inclusion des bibliothèques
+#include "Rasterizer.h"
+#include "Profiler.h"
+#include "SimdFloat.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    namespace {
+
+        // Arrondi au plus proche de value / 255, pour value dans [0, 65025].
+        inline uint32_t divide255(uint32_t value)
+        {
+            value += 128;
+            return (value + (value >> 8)) >> 8;
+        }
+
+        inline ColorRGBA8 blendPixel(ColorRGBA8 destination, ColorRGBA8 source)
+        {
+            uint32_t const alpha{ source.alpha() };
+            uint32_t const inverse{ 255 - alpha };
+            return ColorRGBA8(
+                static_cast<uint8_t>(divide255(destination.red() * inverse + source.red() * alpha)),
+                static_cast<uint8_t>(divide255(destination.green() * inverse + source.green() * alpha)),
+                static_cast<uint8_t>(divide255(destination.blue() * inverse + source.blue() * alpha)),
+                static_cast<uint8_t>(divide255(destination.alpha() * inverse + 255 * alpha)));
+        }
+
+        // Premier et dernier (exclu) pixels dont le centre est dans
+        // [center - half, center + half], limités à [low, high]. Les bornes
+        // étant entières et positives, la limitation se fait avant
+        // l'arrondi, qui se résume alors à une conversion en entier.
+        inline void pixelRange(float center, float half, int low, int high, int & first, int & last)
+        {
+            float const from{ std::clamp(center - half - 0.5f, static_cast<float>(low), static_cast<float>(high)) };
+            float const to{ std::clamp(center + half + 0.5f, static_cast<float>(low), static_cast<float>(high)) };
+            first = static_cast<int>(from);
+            first += static_cast<float>(first) < from ? 1 : 0;
+            last = std::max(static_cast<int>(to), first);
+        }
+
+        // Couleur de remplissage et constantes de mélange, calculées une
+        // seule fois par cercle plutôt que pour chaque segment.
+        struct SpanColor
+        {
+            explicit SpanColor(ColorRGBA8 source)
+                : color{ source }
+                , alpha{ source.alpha() }
+            {
+#if defined(EZGAME_SIMD_SSE)
+                // Terme source (source * alpha + 128) et facteur
+                // (255 - alpha) de chaque composante, pour deux pixels en
+                // entiers de 16 bits. La source de la composante alpha est
+                // 255.
+                ColorRGBA8 const opaque(source.red(), source.green(), source.blue(), 255);
+                packed = _mm_set1_epi32(static_cast<int>(source.packed()));
+                term = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(opaque.packed())), _mm_setzero_si128()), _mm_set1_epi16(static_cast<short>(alpha))), _mm_set1_epi16(128));
+                inverse = _mm_set1_epi16(static_cast<short>(255 - alpha));
+#endif
+            }
+
+            ColorRGBA8 color;
+            uint32_t alpha;
+#if defined(EZGAME_SIMD_SSE)
+            __m128i packed;
+            __m128i term;
+            __m128i inverse;
+#endif
+        };
+
+#if defined(EZGAME_SIMD_SSE)
+        inline __m128i blend(__m128i destination, SpanColor const& color)
+        {
+            __m128i const value{ _mm_add_epi16(_mm_mullo_epi16(destination, color.inverse), color.term) };
+            return _mm_srli_epi16(_mm_add_epi16(value, _mm_srli_epi16(value, 8)), 8);
+        }
+#endif
+
+        inline void fill(ColorRGBA8 * pixels, size_t count, SpanColor const& color)
+        {
+            if (color.alpha == 0) {
+                return;
+            }
+
+            size_t i{};
+            if (color.alpha == 255) {
+#if defined(EZGAME_SIMD_SSE)
+                for (; i + 4 <= count; i += 4) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels + i), color.packed);
+                }
+#endif
+                for (; i < count; ++i) {
+                    pixels[i] = color.color;
+                }
+                return;
+            }
+
+#if defined(EZGAME_SIMD_SSE)
+            __m128i const zero{ _mm_setzero_si128() };
+            for (; i + 4 <= count; i += 4) {
+                __m128i const destination{ _mm_loadu_si128(reinterpret_cast<__m128i const *>(pixels + i)) };
+                __m128i const low{ blend(_mm_unpacklo_epi8(destination, zero), color) };
+                __m128i const high{ blend(_mm_unpackhi_epi8(destination, zero), color) };
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels + i), _mm_packus_epi16(low, high));
+            }
+#endif
+            for (; i < count; ++i) {
+                pixels[i] = blendPixel(pixels[i], color.color);
+            }
+        }
+
+    } // namespace
+
+    void Rasterizer::fillSpan(ColorRGBA8 * pixels, size_t count, ColorRGBA8 color)
+    {
+        fill(pixels, count, SpanColor(color));
+    }
+
+    void Rasterizer::blendMask(ColorRGBA8 * pixels, uint8_t const * coverage, size_t count, ColorRGBA8 color)
+    {
+        uint32_t const alpha{ color.alpha() };
+        if (alpha == 0) {
+            return;
+        }
+
+        size_t i{};
+#if defined(EZGAME_SIMD_SSE)
+        // Comme fill, mais le facteur de mélange varie d'un pixel à
+        // l'autre : il est formé pour deux pixels à la fois.
+        ColorRGBA8 const opaque(color.red(), color.green(), color.blue(), 255);
+        __m128i const zero{ _mm_setzero_si128() };
+        __m128i const source{ _mm_unpacklo_epi8(_mm_set1_epi32(static_cast<int>(opaque.packed())), zero) };
+        __m128i const rounding{ _mm_set1_epi16(128) };
+        __m128i const full{ _mm_set1_epi16(255) };
+        auto blendPair = [&](__m128i destination, uint32_t first, uint32_t second) {
+            short const a{ static_cast<short>(divide255(first * alpha)) };
+            short const b{ static_cast<short>(divide255(second * alpha)) };
+            __m128i const factor{ _mm_set_epi16(b, b, b, b, a, a, a, a) };
+            __m128i const value{ _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(destination, _mm_sub_epi16(full, factor)), _mm_mullo_epi16(source, factor)), rounding) };
+            return _mm_srli_epi16(_mm_add_epi16(value, _mm_srli_epi16(value, 8)), 8);
+        };
+        for (; i + 4 <= count; i += 4) {
+            if ((coverage[i] | coverage[i + 1] | coverage[i + 2] | coverage[i + 3]) == 0) {
+                continue;
+            }
+            __m128i const destination{ _mm_loadu_si128(reinterpret_cast<__m128i const *>(pixels + i)) };
+            __m128i const low{ blendPair(_mm_unpacklo_epi8(destination, zero), coverage[i], coverage[i + 1]) };
+            __m128i const high{ blendPair(_mm_unpackhi_epi8(destination, zero), coverage[i + 2], coverage[i + 3]) };
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels + i), _mm_packus_epi16(low, high));
+        }
+#endif
+        for (; i < count; ++i) {
+            if (coverage[i] != 0) {
+                pixels[i] = blendPixel(pixels[i], ColorRGBA8(color.red(), color.green(), color.blue(), static_cast<uint8_t>(divide255(coverage[i] * alpha))));
+            }
+        }
+    }
+
+    //! \cond PRIVATE
+    class Rasterizer::Impl
+    {
+    public:
+        // Travail de l'image en cours.
+        Framebuffer * target{};
+        Circles circles;
+        bool clear{};
+        ColorRGBA8 clearColor;
+        size_t tileColumns{};
+        size_t tileRows{};
+
+        // Répartition des cercles : les indices des cercles de la tuile t
+        // sont binned[binStart[t], binStart[t + 1][.
+        std::vector<uint32_t> binStart;
+        std::vector<uint32_t> binned;
+        std::vector<uint32_t> binCursor;
+
+        // Fils d'exécution.
+        std::vector<std::thread> workers;
+        std::atomic<uint32_t> generation{};
+        std::atomic<size_t> nextTile{};
+        std::atomic<uint32_t> busy{};
+        std::atomic<bool> stopping{};
+
+        void render(Framebuffer & framebuffer, Circles const& data);
+        void bin();
+        void renderTiles();
+        void renderTile(size_t tile);
+        void work();
+    };
+    //! \endcond
+
+    void Rasterizer::Impl::render(Framebuffer & framebuffer, Circles const& data)
+    {
+        EZ_PROFILE_SCOPE("Rasterizer::render");
+        target = &framebuffer;
+        circles = data;
+        tileColumns = (framebuffer.width() + smTileSize - 1) / smTileSize;
+        tileRows = (framebuffer.height() + smTileSize - 1) / smTileSize;
+        if (tileColumns == 0 || tileRows == 0) {
+            return;
+        }
+
+        bin();
+        nextTile.store(0, std::memory_order_relaxed);
+        if (!workers.empty()) {
+            busy.store(static_cast<uint32_t>(workers.size()), std::memory_order_relaxed);
+            generation.fetch_add(1, std::memory_order_release);
+            generation.notify_all();
+        }
+
+        renderTiles();
+
+        uint32_t remaining{ busy.load(std::memory_order_acquire) };
+        while (remaining != 0) {
+            busy.wait(remaining, std::memory_order_acquire);
+            remaining = busy.load(std::memory_order_acquire);
+        }
+    }
+
+    void Rasterizer::Impl::bin()
+    {
+        size_t const tileCount{ tileColumns * tileRows };
+        binStart.assign(tileCount + 1, 0);
+
+        float const tileSize{ static_cast<float>(smTileSize) };
+        float const width{ static_cast<float>(target->width()) };
+        float const height{ static_cast<float>(target->height()) };
+        size_t const count{ circles.xs.size() };
+        // Tuiles touchées par la boîte englobante de chaque cercle (les
+        // cercles hors de l'image n'en touchent aucune).
+        auto tilesOf = [&](size_t index, size_t & left, size_t & top, size_t & right, size_t & bottom) {
+            float const extent{ circles.radii[index] + std::max(circles.edgeSizes[index], 0.0f) };
+            float const x{ circles.xs[index] };
+            float const y{ circles.ys[index] };
+            if (!(extent > 0.0f) || x + extent < 0.0f || y + extent < 0.0f || x - extent >= width || y - extent >= height) {
+                return false;
+            }
+            left = static_cast<size_t>(std::max(x - extent, 0.0f) / tileSize);
+            top = static_cast<size_t>(std::max(y - extent, 0.0f) / tileSize);
+            right = std::min(static_cast<size_t>(std::min(x + extent, width - 1.0f) / tileSize), tileColumns - 1);
+            bottom = std::min(static_cast<size_t>(std::min(y + extent, height - 1.0f) / tileSize), tileRows - 1);
+            return true;
+        };
+
+        size_t left{}, top{}, right{}, bottom{};
+        for (size_t index{}; index < count; ++index) {
+            if (tilesOf(index, left, top, right, bottom)) {
+                for (size_t row{ top }; row <= bottom; ++row) {
+                    for (size_t column{ left }; column <= right; ++column) {
+                        ++binStart[row * tileColumns + column + 1];
+                    }
+                }
+            }
+        }
+        for (size_t tile{}; tile < tileCount; ++tile) {
+            binStart[tile + 1] += binStart[tile];
+        }
+
+        binned.resize(binStart[tileCount]);
+        binCursor.assign(binStart.begin(), binStart.end() - 1);
+        for (size_t index{}; index < count; ++index) {
+            if (tilesOf(index, left, top, right, bottom)) {
+                for (size_t row{ top }; row <= bottom; ++row) {
+                    for (size_t column{ left }; column <= right; ++column) {
+                        binned[binCursor[row * tileColumns + column]++] = static_cast<uint32_t>(index);
+                    }
+                }
+            }
+        }
+    }
+
+    void Rasterizer::Impl::renderTiles()
+    {
+        EZ_PROFILE_SCOPE("Rasterizer::renderTiles");
+        size_t const tileCount{ tileColumns * tileRows };
+        for (size_t tile{ nextTile.fetch_add(1, std::memory_order_relaxed) }; tile < tileCount; tile = nextTile.fetch_add(1, std::memory_order_relaxed)) {
+            renderTile(tile);
+        }
+    }
+
+    void Rasterizer::Impl::renderTile(size_t tile)
+    {
+        int const left{ static_cast<int>((tile % tileColumns) * smTileSize) };
+        int const top{ static_cast<int>((tile / tileColumns) * smTileSize) };
+        int const right{ std::min(left + static_cast<int>(smTileSize), static_cast<int>(target->width())) };
+        int const bottom{ std::min(top + static_cast<int>(smTileSize), static_cast<int>(target->height())) };
+
+        if (clear) {
+            SpanColor const background{ clearColor };
+            for (int y{ top }; y < bottom; ++y) {
+                fill(target->row(static_cast<size_t>(y)) + left, static_cast<size_t>(right - left), background);
+            }
+        }
+
+        for (uint32_t b{ binStart[tile] }; b < binStart[tile + 1]; ++b) {
+            uint32_t const index{ binned[b] };
+            float const cx{ circles.xs[index] };
+            float const cy{ circles.ys[index] };
+            float const radius{ std::max(circles.radii[index], 0.0f) };
+            float const outer{ radius + std::max(circles.edgeSizes[index], 0.0f) };
+            float const radius2{ radius * radius };
+            float const outer2{ outer * outer };
+            SpanColor const fillColor{ circles.fillColors[index] };
+            SpanColor const edgeColor{ circles.edgeColors[index] };
+
+            int firstRow{};
+            int lastRow{};
+            pixelRange(cy, outer, top, bottom, firstRow, lastRow);
+            for (int y{ firstRow }; y < lastRow; ++y) {
+                float const dy{ static_cast<float>(y) + 0.5f - cy };
+                float const dy2{ dy * dy };
+                if (dy2 > outer2) {
+                    continue;
+                }
+
+                ColorRGBA8 * row{ target->row(static_cast<size_t>(y)) };
+                int outerFirst{};
+                int outerLast{};
+                pixelRange(cx, std::sqrt(outer2 - dy2), left, right, outerFirst, outerLast);
+                int innerFirst{ outerLast };
+                int innerLast{ outerLast };
+                if (outer2 == radius2) {
+                    innerFirst = outerFirst;
+                } else if (dy2 <= radius2) {
+                    pixelRange(cx, std::sqrt(radius2 - dy2), outerFirst, outerLast, innerFirst, innerLast);
+                }
+
+                fill(row + outerFirst, static_cast<size_t>(innerFirst - outerFirst), edgeColor);
+                fill(row + innerFirst, static_cast<size_t>(innerLast - innerFirst), fillColor);
+                fill(row + innerLast, static_cast<size_t>(outerLast - innerLast), edgeColor);
+            }
+        }
+    }
+
+    void Rasterizer::Impl::work()
+    {
+#if defined(EZGAME_PROFILER)
+        Profiler::setThreadName("rasterisation");
+#endif
+        uint32_t seen{};
+        while (true) {
+            generation.wait(seen, std::memory_order_acquire);
+            seen = generation.load(std::memory_order_acquire);
+            if (stopping.load(std::memory_order_acquire)) {
+                break;
+            }
+
+            renderTiles();
+            if (busy.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                busy.notify_one();
+            }
+        }
+    }
+
+    Rasterizer::Rasterizer(size_t threadCount)
+        : mImpl{ std::make_unique<Impl>() }
+    {
+        if (threadCount == 0) {
+            threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+        }
+        for (size_t i{ 1 }; i < threadCount; ++i) {
+            mImpl->workers.emplace_back([this]() { mImpl->work(); });
+        }
+    }
+
+    Rasterizer::~Rasterizer()
+    {
+        mImpl->stopping.store(true, std::memory_order_release);
+        mImpl->generation.fetch_add(1, std::memory_order_release);
+        mImpl->generation.notify_all();
+        for (std::thread & worker : mImpl->workers) {
+            worker.join();
+        }
+    }
+
+    size_t Rasterizer::threadCount() const
+    {
+        return mImpl->workers.size() + 1;
+    }
+
+    void Rasterizer::render(Framebuffer & target, Circles const& circles)
+    {
+        mImpl->clear = false;
+        mImpl->render(target, circles);
+    }
+
+    void Rasterizer::render(Framebuffer & target, ColorRGBA8 clearColor, Circles const& circles)
+    {
+        // Le mélange de la couleur d'effacement se fait tuile par tuile,
+        // juste avant les cercles de la tuile.
+        mImpl->clear = true;
+        mImpl->clearColor = clearColor;
+        mImpl->render(target, circles);
+    }
+
+} // namespace ezgame
@@ -0,0 +1,688 @@
+// Implémentation sans fenêtre (headless) de la classe Screen.
+//
+// Aucun pixel n'est produit. Les primitives sont comptées afin que le
+// rapport de performance de l'application puisse en faire état, puis
+// enregistrées dans une liste de commandes (DrawList). À la fin de chaque
+// image, la liste est exécutée : elle est traduite en tampon d'instances
+// (centre, rayon, épaisseur du contour et couleurs ColorRGBA8 de chaque
+// cercle), la forme sous laquelle un moteur de rendu transmet les cercles
+// au processeur graphique.
+//
+// L'exécution regroupe les commandes en lots, chaque lot correspondant à
+// un seul appel au moteur de rendu : tous les cercles d'un lot sont
+// dessinés par un seul appel instancié (les couleurs font partie des
+// instances) et les textes d'un lot partagent la même taille et les mêmes
+// couleurs. Une commande rejoint un lot antérieur compatible seulement si
+// aucun des lots intermédiaires ne la chevauche (boîtes englobantes) :
+// l'ordre du peintre est préservé partout où il est visible. Les
+// commandes précédant le dernier effacement sont recouvertes et ignorées.
+//
+// Lorsque le rendu logiciel est activé, le tampon d'instances est ensuite
+// dessiné dans une image (Framebuffer) par Rasterizer, lot par lot. Les
+// textes sont mis en page par TextCache (police arial.ttf du dossier
+// resources) : un texte déjà vu se résume à copier ses glyphes depuis
+// l'atlas de sa taille. Le contour d'un texte est approché par huit
+// copies décalées des glyphes dans la couleur du contour.
+//
+// En mode pipeline, deux listes sont utilisées en alternance : le fil
+// principal enregistre l'image N + 1 pendant que le fil de rendu exécute
+// l'image N. La passation se fait par deux compteurs atomiques (listes
+// soumises et listes exécutées), sans verrou; chaque fil attend l'autre
+// avec std::atomic::wait.
+
+
+// Inclusion des bibliothèques
+#include "Screen.h"
+#include "Application.h"
+#include "ColorBatch.h"
+#include "ColorRGBA8.h"
+#include "Rasterizer.h"
+#include "Profiler.h"
+#include "TextCache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <span>
+#include <string>
+#include <thread>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    namespace {
+
+        using Clock = std::chrono::steady_clock;
+
+        // Nombre de lots précédents examinés pour placer une commande.
+        size_t const smBatchLookback{ 16 };
+
+        struct Bounds
+        {
+            float left;
+            float top;
+            float right;
+            float bottom;
+
+            bool overlaps(Bounds const& other) const
+            {
+                return left <= other.right && other.left <= right && top <= other.bottom && other.top <= bottom;
+            }
+
+            void merge(Bounds const& other)
+            {
+                left = std::min(left, other.left);
+                top = std::min(top, other.top);
+                right = std::max(right, other.right);
+                bottom = std::max(bottom, other.bottom);
+            }
+        };
+
+        // Un effacement couvre tout l'écran.
+        float const smInfinity{ std::numeric_limits<float>::infinity() };
+        Bounds const smScreenBounds{ -smInfinity, -smInfinity, smInfinity, smInfinity };
+
+        // État du moteur de rendu pour un texte : les textes ne sont réunis
+        // dans un même appel que si leur état est identique.
+        struct TextState
+        {
+            float size;
+            uint32_t fill;
+            uint32_t edge;
+            float edgeSize;
+
+            bool operator==(TextState const& other) const = default;
+        };
+
+        struct Batch
+        {
+            DrawList::Kind kind;
+            TextState state;
+            Bounds bounds;
+            size_t count;
+            // Position du lot dans le tampon d'instances (ou parmi les
+            // textes), puis position d'écriture pendant le remplissage : le
+            // lot commence ensuite à first - count.
+            size_t first;
+        };
+
+        Bounds circleBounds(DrawList const & list, DrawList::Command const & command)
+        {
+            Vect2d const offset{ Circle::centerOffset(command.alignment) };
+            float const dx{ offset.x() };
+            float const dy{ offset.y() };
+            float const * xs{ list.xs() + command.first };
+            float const * ys{ list.ys() + command.first };
+            float const * radii{ list.radii() + command.first };
+            float const * edgeSizes{ list.edgeSizes() + command.first };
+            float left{ xs[0] };
+            float top{ ys[0] };
+            float right{ xs[0] };
+            float bottom{ ys[0] };
+            for (size_t i{}; i < command.count; ++i) {
+                float const extent{ radii[i] + edgeSizes[i] };
+                float const x{ xs[i] + dx * radii[i] };
+                float const y{ ys[i] + dy * radii[i] };
+                left = std::min(left, x - extent);
+                top = std::min(top, y - extent);
+                right = std::max(right, x + extent);
+                bottom = std::max(bottom, y + extent);
+            }
+            return Bounds{ left, top, right, bottom };
+        }
+
+        // Un effacement opaque remplace tout le contenu précédent; un
+        // effacement translucide s'y mélange.
+        bool isOpaqueClear(DrawList const & list, DrawList::Command const & command)
+        {
+            return command.kind == DrawList::Kind::Clear && ColorRGBA8(list.clearColors()[command.first]).alpha() == 255;
+        }
+
+        // Boîte englobante prudente d'un texte : sans la police, chaque
+        // caractère est supposé aussi large que la taille du texte, dans
+        // n'importe quelle direction à partir de la position.
+        Bounds textBounds(Text const & text)
+        {
+            Vect2d const position{ text.position() };
+            float const size{ text.textSize() + text.edgeSize() };
+            float const width{ size * static_cast<float>(text.textView().size()) };
+            float const height{ size * 1.5f };
+            return Bounds{ position.x() - width, position.y() - height, position.x() + width, position.y() + height };
+        }
+
+        // Boîte englobante exacte d'un texte mis en page, contour compris.
+        Bounds textBounds(Text const & text, TextCache::Run const & run)
+        {
+            Vect2d const position{ text.position() };
+            float const edge{ std::ceil(text.edgeSize()) + 1.0f };
+            return Bounds{ position.x() + run.left - edge, position.y() + run.top - edge, position.x() + run.right + edge, position.y() + run.bottom + edge };
+        }
+
+        // Police des textes : EZGAME_FONT, sinon arial.ttf cherchée dans
+        // le dossier resources à partir du dossier courant ou de son parent.
+        std::string fontFile()
+        {
+            char const * value{ std::getenv("EZGAME_FONT") };
+            if (value && *value) {
+                return value;
+            }
+            for (char const * candidate : { "resources/arial.ttf", "EzGame/resources/arial.ttf", "../EzGame/resources/arial.ttf" }) {
+                if (std::ifstream(candidate)) {
+                    return candidate;
+                }
+            }
+            return std::string();
+        }
+
+        // Directions des copies formant le contour d'un texte.
+        float const smEdgeDirections[8][2]{
+            { 1.0f, 0.0f }, { -1.0f, 0.0f }, { 0.0f, 1.0f }, { 0.0f, -1.0f },
+            { 0.7071f, 0.7071f }, { 0.7071f, -0.7071f }, { -0.7071f, 0.7071f }, { -0.7071f, -0.7071f } };
+
+    } // namespace
+
+    //! \cond PRIVATE
+    class Screen::Impl
+    {
+    public:
+        explicit Impl(Application & app)
+            : app{ app }
+        {
+        }
+
+        Application & app;
+        size_t clearCount{};
+        size_t circleCount{};
+        size_t textCount{};
+
+        // Listes de commandes : celle en cours d'enregistrement et, en mode
+        // pipeline, celle en cours d'exécution par le fil de rendu.
+        DrawList lists[2];
+        size_t recording{};
+
+        // Passation vers le fil de rendu. Les compteurs peuvent déborder :
+        // ils ne sont comparés que par égalité.
+        std::thread renderer;
+        std::atomic<uint32_t> submitted{};
+        std::atomic<uint32_t> completed{};
+        std::atomic<bool> stopping{};
+
+        // Tampon d'instances produit par l'exécution d'une liste.
+        ColorRGBA8 background;
+        size_t instanceCount{};
+        std::vector<float> instanceX;
+        std::vector<float> instanceY;
+        std::vector<float> instanceRadius;
+        std::vector<float> instanceEdgeSize;
+        std::vector<ColorRGBA8> instanceFill;
+        std::vector<ColorRGBA8> instanceEdge;
+        size_t renderedTextCount{};
+        std::vector<size_t> textOrder;
+
+        // Regroupement des commandes en appels au moteur de rendu.
+        std::vector<Batch> batches;
+        std::vector<size_t> commandBatch;
+        std::atomic<size_t> lastDrawCallCount{};
+        std::atomic<size_t> lastCommandCount{};
+        size_t totalDrawCallCount{};
+        size_t totalCommandCount{};
+
+        // Rendu logiciel (optionnel).
+        std::unique_ptr<Rasterizer> rasterizer;
+        Framebuffer framebuffer;
+
+        // Mise en page des textes (rendu logiciel seulement), utilisée par
+        // le fil qui exécute les listes.
+        std::string fontFileName;
+        TextCache textCache;
+        std::vector<TextCache::Run const *> textRuns;
+        std::atomic<size_t> textCacheHitCount{};
+        std::atomic<size_t> textCacheMissCount{};
+
+        std::vector<Clock::duration> renderTimes;
+
+        void render(DrawList const & list);
+        void drawText(Text const & text, TextCache::Run const & run);
+        void drawRun(TextCache::Run const & run, int x, int y, ColorRGBA8 color);
+        void renderLoop();
+        void waitCompleted(uint32_t target);
+    };
+    //! \endcond
+
+    void Screen::Impl::render(DrawList const & list)
+    {
+        EZ_PROFILE_SCOPE("Screen::render");
+        Clock::time_point const start{ Clock::now() };
+        std::span<DrawList::Command const> const commands{ list.commands() };
+
+        // Seules les commandes suivant le dernier effacement opaque sont
+        // visibles. Les effacements translucides qui suivent sont exécutés
+        // à leur place, par-dessus les commandes qui les précèdent.
+        size_t firstVisible{ commands.size() };
+        while (firstVisible > 0 && !isOpaqueClear(list, commands[firstVisible - 1])) {
+            --firstVisible;
+        }
+        bool const cleared{ firstVisible > 0 };
+        if (cleared) {
+            background = ColorRGBA8(list.clearColors()[commands[firstVisible - 1].first]);
+        }
+
+        // Regroupement en lots.
+        batches.clear();
+        commandBatch.clear();
+        textCache.trim();
+        textRuns.assign(list.texts().size(), nullptr);
+        for (size_t index{ firstVisible }; index < commands.size(); ++index) {
+            DrawList::Command const & command{ commands[index] };
+            if (command.kind == DrawList::Kind::Clear) {
+                // Lot à part, qu'aucune commande ne peut franchir; first
+                // désigne sa couleur.
+                batches.push_back(Batch{ command.kind, TextState{}, smScreenBounds, command.count, command.first });
+                commandBatch.push_back(batches.size() - 1);
+                continue;
+            }
+            Batch candidate{ command.kind, TextState{}, Bounds{}, command.count, 0 };
+            if (command.kind == DrawList::Kind::Circles) {
+                candidate.bounds = circleBounds(list, command);
+            } else {
+                Text const & text{ list.texts()[command.first] };
+                candidate.state = TextState{ text.textSize(), ColorRGBA8(text.fillColor()).packed(), ColorRGBA8(text.edgeColor()).packed(), text.edgeSize() };
+                if (rasterizer && textCache.isLoaded()) {
+                    TextCache::Run const & run{ textCache.run(text.textView(), text.textSize(), text.alignment()) };
+                    textRuns[command.first] = &run;
+                    candidate.bounds = textBounds(text, run);
+                } else {
+                    candidate.bounds = textBounds(text);
+                }
+            }
+
+            size_t target{ batches.size() };
+            for (size_t j{ batches.size() }; j > 0 && batches.size() - j < smBatchLookback; --j) {
+                Batch const & batch{ batches[j - 1] };
+                if (batch.kind == candidate.kind && (candidate.kind == DrawList::Kind::Circles || batch.state == candidate.state)) {
+                    target = j - 1;
+                    break;
+                }
+                if (batch.bounds.overlaps(candidate.bounds)) {
+                    break;
+                }
+            }
+
+            if (target == batches.size()) {
+                batches.push_back(candidate);
+            } else {
+                batches[target].bounds.merge(candidate.bounds);
+                batches[target].count += candidate.count;
+            }
+            commandBatch.push_back(target);
+        }
+
+        // Position de chaque lot, dans l'ordre des lots.
+        instanceCount = 0;
+        renderedTextCount = 0;
+        for (Batch & batch : batches) {
+            if (batch.kind == DrawList::Kind::Circles) {
+                batch.first = instanceCount;
+                instanceCount += batch.count;
+            } else if (batch.kind == DrawList::Kind::Text) {
+                batch.first = renderedTextCount;
+                renderedTextCount += batch.count;
+            }
+        }
+
+        if (instanceX.size() < instanceCount) {
+            instanceX.resize(instanceCount);
+            instanceY.resize(instanceCount);
+            instanceRadius.resize(instanceCount);
+            instanceEdgeSize.resize(instanceCount);
+            instanceFill.resize(instanceCount);
+            instanceEdge.resize(instanceCount);
+        }
+        textOrder.resize(renderedTextCount);
+
+        // Remplissage du tampon d'instances : chaque commande est écrite à
+        // la suite des commandes précédentes de son lot.
+        for (size_t index{ firstVisible }; index < commands.size(); ++index) {
+            DrawList::Command const & command{ commands[index] };
+            Batch & batch{ batches[commandBatch[index - firstVisible]] };
+            if (command.kind == DrawList::Kind::Clear) {
+                continue;
+            }
+            if (command.kind == DrawList::Kind::Text) {
+                textOrder[batch.first++] = command.first;
+                continue;
+            }
+
+            Vect2d const offset{ Circle::centerOffset(command.alignment) };
+            float const dx{ offset.x() };
+            float const dy{ offset.y() };
+            float const * xs{ list.xs() + command.first };
+            float const * ys{ list.ys() + command.first };
+            float const * radii{ list.radii() + command.first };
+            float const * edgeSizes{ list.edgeSizes() + command.first };
+            float * x{ instanceX.data() + batch.first };
+            float * y{ instanceY.data() + batch.first };
+            float * radius{ instanceRadius.data() + batch.first };
+            float * edgeSize{ instanceEdgeSize.data() + batch.first };
+            for (size_t i{}; i < command.count; ++i) {
+                x[i] = xs[i] + dx * radii[i];
+                y[i] = ys[i] + dy * radii[i];
+                radius[i] = radii[i];
+                edgeSize[i] = edgeSizes[i];
+            }
+            ColorBatch::convert(std::span<Color const>(list.fillColors() + command.first, command.count), std::span<ColorRGBA8>(instanceFill.data() + batch.first, command.count));
+            ColorBatch::convert(std::span<Color const>(list.edgeColors() + command.first, command.count), std::span<ColorRGBA8>(instanceEdge.data() + batch.first, command.count));
+            batch.first += command.count;
+        }
+
+        // Rendu logiciel, lot par lot pour respecter l'ordre du peintre.
+        if (rasterizer) {
+            bool clearPending{ cleared };
+            for (Batch const & batch : batches) {
+                if (batch.kind == DrawList::Kind::Clear) {
+                    // Mélangé au prochain lot de cercles, comme le premier
+                    // effacement.
+                    if (clearPending) {
+                        rasterizer->render(framebuffer, background, Rasterizer::Circles{});
+                    }
+                    background = ColorRGBA8(list.clearColors()[batch.first]);
+                    clearPending = true;
+                    continue;
+                }
+
+                size_t const start{ batch.first - batch.count };
+                if (batch.kind == DrawList::Kind::Circles) {
+                    Rasterizer::Circles const circles{
+                        std::span<float const>(instanceX.data() + start, batch.count),
+                        std::span<float const>(instanceY.data() + start, batch.count),
+                        std::span<float const>(instanceRadius.data() + start, batch.count),
+                        std::span<float const>(instanceEdgeSize.data() + start, batch.count),
+                        std::span<ColorRGBA8 const>(instanceFill.data() + start, batch.count),
+                        std::span<ColorRGBA8 const>(instanceEdge.data() + start, batch.count) };
+                    if (clearPending) {
+                        rasterizer->render(framebuffer, background, circles);
+                    } else {
+                        rasterizer->render(framebuffer, circles);
+                    }
+                    clearPending = false;
+                    continue;
+                }
+
+                if (clearPending) {
+                    rasterizer->render(framebuffer, background, Rasterizer::Circles{});
+                    clearPending = false;
+                }
+                for (size_t i{ start }; i < batch.first; ++i) {
+                    if (textRuns[textOrder[i]]) {
+                        drawText(list.texts()[textOrder[i]], *textRuns[textOrder[i]]);
+                    }
+                }
+            }
+            if (clearPending) {
+                rasterizer->render(framebuffer, background, Rasterizer::Circles{});
+            }
+            textCacheHitCount.store(textCache.hitCount(), std::memory_order_relaxed);
+            textCacheMissCount.store(textCache.missCount(), std::memory_order_relaxed);
+        }
+
+        size_t const drawCalls{ batches.size() + (cleared ? 1 : 0) };
+        totalDrawCallCount += drawCalls;
+        totalCommandCount += commands.size();
+        lastDrawCallCount.store(drawCalls, std::memory_order_relaxed);
+        lastCommandCount.store(commands.size(), std::memory_order_relaxed);
+
+        renderTimes.push_back(Clock::now() - start);
+    }
+
+    void Screen::Impl::drawText(Text const & text, TextCache::Run const & run)
+    {
+        Vect2d const position{ text.position() };
+        int const x{ static_cast<int>(std::lround(position.x())) };
+        int const y{ static_cast<int>(std::lround(position.y())) };
+
+        float const edgeSize{ text.edgeSize() };
+        ColorRGBA8 const edge{ text.edgeColor() };
+        if (edgeSize > 0.0f && edge.alpha() > 0) {
+            for (float const (&direction)[2] : smEdgeDirections) {
+                drawRun(run, x + static_cast<int>(std::lround(direction[0] * edgeSize)), y + static_cast<int>(std::lround(direction[1] * edgeSize)), edge);
+            }
+        }
+        drawRun(run, x, y, ColorRGBA8(text.fillColor()));
+    }
+
+    void Screen::Impl::drawRun(TextCache::Run const & run, int x, int y, ColorRGBA8 color)
+    {
+        int const width{ static_cast<int>(framebuffer.width()) };
+        int const height{ static_cast<int>(framebuffer.height()) };
+        for (TextCache::Quad const & quad : run.quads) {
+            int const left{ std::max(x + quad.x, 0) };
+            int const top{ std::max(y + quad.y, 0) };
+            int const right{ std::min(x + quad.x + quad.width, width) };
+            int const bottom{ std::min(y + quad.y + quad.height, height) };
+            for (int row{ top }; row < bottom; ++row) {
+                uint8_t const * coverage{ run.atlas->row(static_cast<size_t>(quad.atlasY + row - (y + quad.y))) + quad.atlasX + (left - (x + quad.x)) };
+                if (left < right) {
+                    Rasterizer::blendMask(framebuffer.row(static_cast<size_t>(row)) + left, coverage, static_cast<size_t>(right - left), color);
+                }
+            }
+        }
+    }
+
+    void Screen::Impl::renderLoop()
+    {
+#if defined(EZGAME_PROFILER)
+        Profiler::setThreadName("fil de rendu");
+#endif
+        uint32_t executed{};
+        while (true) {
+            submitted.wait(executed, std::memory_order_acquire);
+            if (stopping.load(std::memory_order_acquire)) {
+                break;
+            }
+
+            // Au plus une liste est en attente : le fil principal attend la
+            // fin de la précédente avant d'en soumettre une autre.
+            render(lists[executed % 2]);
+            ++executed;
+            completed.store(executed, std::memory_order_release);
+            completed.notify_one();
+        }
+    }
+
+    void Screen::Impl::waitCompleted(uint32_t target)
+    {
+        uint32_t current{ completed.load(std::memory_order_acquire) };
+        while (current != target) {
+            completed.wait(current, std::memory_order_acquire);
+            current = completed.load(std::memory_order_acquire);
+        }
+    }
+
+    Screen::Screen(Application & app)
+        : mImpl{ std::make_unique<Impl>(app) }
+    {
+    }
+
+    Screen::~Screen()
+    {
+        end();
+    }
+
+    size_t Screen::width() const
+    {
+        return mImpl->app.width();
+    }
+
+    size_t Screen::height() const
+    {
+        return mImpl->app.height();
+    }
+
+    void Screen::clear()
+    {
+        clear(Color::Black);
+    }
+
+    void Screen::clear(Color const& color)
+    {
+        ++mImpl->clearCount;
+        mImpl->lists[mImpl->recording].addClear(color);
+    }
+
+    void Screen::draw(Circle const& circle)
+    {
+        ++mImpl->circleCount;
+        mImpl->lists[mImpl->recording].add(circle);
+    }
+
+    void Screen::draw(CircleBatch const& circles)
+    {
+        mImpl->circleCount += circles.size();
+        mImpl->lists[mImpl->recording].add(circles);
+    }
+
+    void Screen::draw(Text const& text)
+    {
+        ++mImpl->textCount;
+        mImpl->lists[mImpl->recording].add(text);
+    }
+
+    size_t Screen::drawCallCount() const
+    {
+        return mImpl->lastDrawCallCount.load(std::memory_order_relaxed);
+    }
+
+    size_t Screen::commandCount() const
+    {
+        return mImpl->lastCommandCount.load(std::memory_order_relaxed);
+    }
+
+    size_t Screen::textCacheHitCount() const
+    {
+        return mImpl->textCacheHitCount.load(std::memory_order_relaxed);
+    }
+
+    size_t Screen::textCacheMissCount() const
+    {
+        return mImpl->textCacheMissCount.load(std::memory_order_relaxed);
+    }
+
+    size_t Screen::circleCount() const
+    {
+        return mImpl->circleCount;
+    }
+
+    size_t Screen::textCount() const
+    {
+        return mImpl->textCount;
+    }
+
+    Framebuffer const & Screen::framebuffer() const
+    {
+        // En mode pipeline, l'image peut être en cours d'exécution.
+        Impl & impl{ *mImpl };
+        if (impl.renderer.joinable()) {
+            impl.waitCompleted(impl.submitted.load(std::memory_order_relaxed));
+        }
+        return impl.framebuffer;
+    }
+
+    void Screen::begin(bool pipelined, bool rasterized)
+    {
+        Impl & impl{ *mImpl };
+        end();
+        if (rasterized) {
+            if (!impl.rasterizer) {
+                impl.rasterizer = std::make_unique<Rasterizer>();
+            }
+            impl.framebuffer.resize(width(), height());
+            if (!impl.textCache.isLoaded()) {
+                impl.fontFileName = fontFile();
+                if (!impl.textCache.load(impl.fontFileName)) {
+                    impl.fontFileName.clear();
+                }
+            }
+        } else {
+            impl.rasterizer.reset();
+            impl.framebuffer.resize(0, 0);
+        }
+        impl.textCache.resetCounters();
+        impl.textCacheHitCount.store(0, std::memory_order_relaxed);
+        impl.textCacheMissCount.store(0, std::memory_order_relaxed);
+        impl.lists[0].clear();
+        impl.lists[1].clear();
+        impl.recording = 0;
+        impl.renderTimes.clear();
+        impl.totalDrawCallCount = 0;
+        impl.totalCommandCount = 0;
+        impl.lastDrawCallCount.store(0, std::memory_order_relaxed);
+        impl.lastCommandCount.store(0, std::memory_order_relaxed);
+        impl.submitted.store(0, std::memory_order_relaxed);
+        impl.completed.store(0, std::memory_order_relaxed);
+        impl.stopping.store(false, std::memory_order_relaxed);
+        if (pipelined) {
+            impl.renderer = std::thread([&impl]() { impl.renderLoop(); });
+        }
+    }
+
+    void Screen::present()
+    {
+        EZ_PROFILE_SCOPE("Screen::present");
+        Impl & impl{ *mImpl };
+        if (!impl.renderer.joinable()) {
+            impl.render(impl.lists[impl.recording]);
+            impl.lists[impl.recording].clear();
+            return;
+        }
+
+        // La liste précédente doit être exécutée avant de soumettre la
+        // liste courante : elle devient la prochaine liste enregistrée.
+        uint32_t const submitted{ impl.submitted.load(std::memory_order_relaxed) };
+        impl.waitCompleted(submitted);
+        impl.submitted.store(submitted + 1, std::memory_order_release);
+        impl.submitted.notify_one();
+
+        impl.recording ^= 1;
+        impl.lists[impl.recording].clear();
+    }
+
+    void Screen::end()
+    {
+        Impl & impl{ *mImpl };
+        if (!impl.renderer.joinable()) {
+            return;
+        }
+
+        impl.waitCompleted(impl.submitted.load(std::memory_order_relaxed));
+        impl.stopping.store(true, std::memory_order_release);
+        impl.submitted.fetch_add(1, std::memory_order_release);
+        impl.submitted.notify_one();
+        impl.renderer.join();
+    }
+
+    size_t Screen::totalDrawCallCount() const
+    {
+        return mImpl->totalDrawCallCount;
+    }
+
+    size_t Screen::totalCommandCount() const
+    {
+        return mImpl->totalCommandCount;
+    }
+
+    std::string const & Screen::fontFileName() const
+    {
+        return mImpl->fontFileName;
+    }
+
+    std::vector<std::chrono::steady_clock::duration> const & Screen::renderTimes() const
+    {
+        return mImpl->renderTimes;
+    }
+
+} // namespace ezgame
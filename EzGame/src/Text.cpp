@@ -0,0 +1,183 @@
+// Définitions de la classe Text.
+//
+// Les nombres sont convertis avec std::to_chars dans un tampon local, puis
+// comparés au texte courant : un affichage tête haute qui redonne chaque
+// image le même pointage ne modifie pas l'objet. Aucune conversion ne
+// passe par une chaîne temporaire.
+
+
+// Inclusion des bibliothèques
+#include "Text.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    namespace {
+
+        // Taille des tampons de conversion : suffisante pour tout entier
+        // et pour un réel fini (au plus 39 chiffres avant le point) avec
+        // la précision maximale.
+        size_t const smMaximumPrecision{ 64 };
+        size_t const smNumberBufferSize{ 128 };
+
+    } // namespace
+
+    float const Text::smMinimumTextSize{ 0.0f };
+
+    Text::Text()
+        : Text(std::string(), smMinimumTextSize, Vect2d(), Color())
+    {
+    }
+
+    Text::Text(std::string const & text, float textSize, Vect2d const& position, Color const color, Alignment alignment)
+        : Text(text, textSize, position, color, color, 0.0f, alignment)
+    {
+    }
+
+    Text::Text(std::string const & text, float textSize, Vect2d const& position, Color const fillColor, Color const edgeColor, float edgeSize, Alignment alignment)
+        : mTextSize{ std::max(textSize, smMinimumTextSize) }
+        , mPosition{ position }
+        , mAlignment{ alignment }
+        , mFillColor{ fillColor }
+        , mEdgeColor{ edgeColor }
+        , mEdgeSize{ std::max(edgeSize, 0.0f) }
+    {
+        assign(text);
+    }
+
+    std::string Text::text() const
+    {
+        return std::string(textView());
+    }
+
+    float Text::textSize() const
+    {
+        return mTextSize;
+    }
+
+    Vect2d Text::position() const
+    {
+        return mPosition;
+    }
+
+    Alignment Text::alignment() const
+    {
+        return mAlignment;
+    }
+
+    Color Text::fillColor() const
+    {
+        return mFillColor;
+    }
+
+    Color Text::edgeColor() const
+    {
+        return mEdgeColor;
+    }
+
+    float Text::edgeSize() const
+    {
+        return mEdgeSize;
+    }
+
+    void Text::assign(std::string_view text)
+    {
+        if (text == textView()) {
+            return;
+        }
+
+        if (text.size() <= smInlineCapacity) {
+            std::memcpy(mInlineText.data(), text.data(), text.size());
+            mLongText.clear();
+        } else {
+            mLongText.assign(text);
+        }
+        mLength = text.size();
+    }
+
+    void Text::setText(std::string const& text)
+    {
+        assign(text);
+    }
+
+    void Text::setText(size_t number)
+    {
+        char buffer[smNumberBufferSize];
+        std::to_chars_result const result{ std::to_chars(buffer, buffer + smNumberBufferSize, number) };
+        assign(std::string_view(buffer, static_cast<size_t>(result.ptr - buffer)));
+    }
+
+    void Text::setText(int number)
+    {
+        char buffer[smNumberBufferSize];
+        std::to_chars_result const result{ std::to_chars(buffer, buffer + smNumberBufferSize, number) };
+        assign(std::string_view(buffer, static_cast<size_t>(result.ptr - buffer)));
+    }
+
+    void Text::setText(float number, size_t precision)
+    {
+        char buffer[smNumberBufferSize];
+        std::to_chars_result const result{ std::to_chars(buffer, buffer + smNumberBufferSize, number, std::chars_format::fixed, static_cast<int>(std::min(precision, smMaximumPrecision))) };
+        assign(std::string_view(buffer, result.ec == std::errc() ? static_cast<size_t>(result.ptr - buffer) : 0));
+    }
+
+    void Text::setText(std::string const& text, float textSize)
+    {
+        setText(text);
+        setTextSize(textSize);
+    }
+
+    void Text::setTextSize(float textSize)
+    {
+        mTextSize = std::max(textSize, smMinimumTextSize);
+    }
+
+    void Text::setPosition(Vect2d const& position)
+    {
+        mPosition = position;
+    }
+
+    void Text::setAlignment(Alignment alignment)
+    {
+        mAlignment = alignment;
+    }
+
+    void Text::setFill(Color const& color)
+    {
+        mFillColor = color;
+    }
+
+    void Text::setEdge(Color const& color)
+    {
+        mEdgeColor = color;
+    }
+
+    void Text::setEdge(float size)
+    {
+        mEdgeSize = std::max(size, 0.0f);
+    }
+
+    void Text::setEdge(Color const& color, float size)
+    {
+        setEdge(color);
+        setEdge(size);
+    }
+
+    void Text::setColors(Color const& fillColor, Color const& edgeColor)
+    {
+        setFill(fillColor);
+        setEdge(edgeColor);
+    }
+
+    void Text::setColors(Color const& fillColor, Color const& edgeColor, float edgeSize)
+    {
+        setColors(fillColor, edgeColor);
+        setEdge(edgeSize);
+    }
+
+} // namespace ezgame
@@ -0,0 +1,319 @@
+// Cache des textes mis en page.
+//
+// La clé d'un texte est son contenu, sa taille et son alignement. La
+// recherche se fait sans copier le contenu (recherche hétérogène sur une
+// vue); seul un échec copie la chaîne dans la clé.
+
+
+// Inclusion des bibliothèques
+#include "TextCache.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <functional>
+#include <unordered_map>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    namespace {
+
+        struct KeyView
+        {
+            std::string_view text;
+            float size;
+            Alignment alignment;
+        };
+
+        struct Key
+        {
+            std::string text;
+            float size;
+            Alignment alignment;
+
+            operator KeyView() const
+            {
+                return KeyView{ text, size, alignment };
+            }
+        };
+
+        struct KeyHash
+        {
+            using is_transparent = void;
+
+            size_t operator()(KeyView const & key) const
+            {
+                size_t hash{ std::hash<std::string_view>()(key.text) };
+                hash ^= (std::bit_cast<uint32_t>(key.size) + 0x9E3779B9u + (hash << 6) + (hash >> 2));
+                hash ^= (static_cast<size_t>(key.alignment) + 0x9E3779B9u + (hash << 6) + (hash >> 2));
+                return hash;
+            }
+
+            size_t operator()(Key const & key) const
+            {
+                return (*this)(static_cast<KeyView>(key));
+            }
+        };
+
+        struct KeyEqual
+        {
+            using is_transparent = void;
+
+            bool operator()(KeyView const & a, KeyView const & b) const
+            {
+                return a.size == b.size && a.alignment == b.alignment && a.text == b.text;
+            }
+        };
+
+        // Décode le caractère UTF-8 commençant à la position donnée et
+        // avance la position. Une séquence invalide donne l'octet seul,
+        // lu en Latin-1.
+        char32_t decode(std::string_view text, size_t & index)
+        {
+            uint8_t const lead{ static_cast<uint8_t>(text[index++]) };
+            size_t const length{ lead >= 0xF0 && lead < 0xF8 ? 3u : lead >= 0xE0 ? 2u : lead >= 0xC2 && lead < 0xE0 ? 1u : 0u };
+            if (length == 0 || lead >= 0xF8 || index + length > text.size()) {
+                return lead;
+            }
+
+            char32_t codePoint{ static_cast<char32_t>(lead & (0x3F >> length)) };
+            for (size_t i{}; i < length; ++i) {
+                uint8_t const next{ static_cast<uint8_t>(text[index + i]) };
+                if ((next & 0xC0) != 0x80) {
+                    return lead;
+                }
+                codePoint = codePoint << 6 | (next & 0x3F);
+            }
+            index += length;
+            return codePoint;
+        }
+
+        // Fraction de la boîte englobante servant d'origine à
+        // l'alignement, dans chaque dimension.
+        float horizontalAnchor(Alignment alignment)
+        {
+            switch (alignment) {
+                case Alignment::TopCenter:
+                case Alignment::CenterCenter:
+                case Alignment::BottomCenter:
+                    return 0.5f;
+                case Alignment::TopRight:
+                case Alignment::CenterRight:
+                case Alignment::BottomRight:
+                    return 1.0f;
+                default:
+                    return 0.0f;
+            }
+        }
+
+        float verticalAnchor(Alignment alignment)
+        {
+            switch (alignment) {
+                case Alignment::CenterLeft:
+                case Alignment::CenterCenter:
+                case Alignment::CenterRight:
+                    return 0.5f;
+                case Alignment::BottomLeft:
+                case Alignment::BottomCenter:
+                case Alignment::BottomRight:
+                    return 1.0f;
+                default:
+                    return 0.0f;
+            }
+        }
+
+    } // namespace
+
+    //! \cond PRIVATE
+    class TextCache::Impl
+    {
+    public:
+        explicit Impl(size_t capacity)
+            : capacity{ capacity }
+        {
+        }
+
+        size_t capacity;
+        Font font;
+        std::vector<std::unique_ptr<GlyphAtlas>> atlases;
+        std::unordered_map<Key, Run, KeyHash, KeyEqual> runs;
+        Run empty{};
+        size_t hitCount{};
+        size_t missCount{};
+
+        GlyphAtlas & atlas(float size);
+        void layout(std::string_view text, GlyphAtlas & atlas, Alignment alignment, Run & run);
+    };
+    //! \endcond
+
+    GlyphAtlas & TextCache::Impl::atlas(float size)
+    {
+        for (std::unique_ptr<GlyphAtlas> const & atlas : atlases) {
+            if (atlas->size() == size) {
+                return *atlas;
+            }
+        }
+        return *atlases.emplace_back(std::make_unique<GlyphAtlas>(font, size));
+    }
+
+    void TextCache::Impl::layout(std::string_view text, GlyphAtlas & atlas, Alignment alignment, Run & run)
+    {
+        float const lineHeight{ font.lineHeight(atlas.size()) };
+
+        // Glyphes placés sur la ligne de base, à partir de l'origine.
+        struct Placed
+        {
+            float x;
+            float y;
+            GlyphAtlas::Glyph glyph;
+        };
+        std::vector<Placed> placed;
+        placed.reserve(text.size());
+        float penX{};
+        float penY{};
+        bool empty{ true };
+        float left{};
+        float top{};
+        float right{};
+        float bottom{};
+        for (size_t index{}; index < text.size();) {
+            char32_t const codePoint{ decode(text, index) };
+            if (codePoint == U'\n') {
+                penX = 0.0f;
+                penY += lineHeight;
+                continue;
+            }
+
+            // Copie : l'ajout d'un glyphe peut déplacer les précédents.
+            GlyphAtlas::Glyph const glyph{ atlas.glyph(codePoint) };
+            if (glyph.width > 0) {
+                float const x{ penX + glyph.left };
+                float const y{ penY + glyph.top };
+                left = empty ? x : std::min(left, x);
+                top = empty ? y : std::min(top, y);
+                right = empty ? x + glyph.width : std::max(right, x + glyph.width);
+                bottom = empty ? y + glyph.height : std::max(bottom, y + glyph.height);
+                empty = false;
+                placed.push_back(Placed{ penX, penY, glyph });
+            }
+            penX += glyph.advance;
+        }
+
+        // Alignement sur la boîte englobante (BaseLeft : sur l'origine).
+        float offsetX{};
+        float offsetY{};
+        if (alignment != Alignment::BaseLeft) {
+            offsetX = -(left + (right - left) * horizontalAnchor(alignment));
+            offsetY = -(top + (bottom - top) * verticalAnchor(alignment));
+        }
+
+        run.atlas = &atlas;
+        run.quads.clear();
+        run.quads.reserve(placed.size());
+        for (Placed const & placedGlyph : placed) {
+            GlyphAtlas::Glyph const & glyph{ placedGlyph.glyph };
+            run.quads.push_back(Quad{
+                static_cast<int>(std::lround(placedGlyph.x + offsetX)) + glyph.left,
+                static_cast<int>(std::lround(placedGlyph.y + offsetY)) + glyph.top,
+                glyph.x, glyph.y, glyph.width, glyph.height });
+        }
+        run.left = left + offsetX;
+        run.top = top + offsetY;
+        run.right = right + offsetX;
+        run.bottom = bottom + offsetY;
+    }
+
+    TextCache::TextCache(size_t capacity)
+        : mImpl{ std::make_unique<Impl>(capacity) }
+    {
+    }
+
+    TextCache::~TextCache() = default;
+
+    bool TextCache::load(std::string const& fontFileName)
+    {
+        Impl & impl{ *mImpl };
+        impl.runs.clear();
+        impl.atlases.clear();
+        return impl.font.load(fontFileName);
+    }
+
+    bool TextCache::isLoaded() const
+    {
+        return mImpl->font.isLoaded();
+    }
+
+    Font const & TextCache::font() const
+    {
+        return mImpl->font;
+    }
+
+    size_t TextCache::capacity() const
+    {
+        return mImpl->capacity;
+    }
+
+    size_t TextCache::size() const
+    {
+        return mImpl->runs.size();
+    }
+
+    size_t TextCache::atlasCount() const
+    {
+        return mImpl->atlases.size();
+    }
+
+    size_t TextCache::glyphCount() const
+    {
+        size_t count{};
+        for (std::unique_ptr<GlyphAtlas> const & atlas : mImpl->atlases) {
+            count += atlas->glyphCount();
+        }
+        return count;
+    }
+
+    size_t TextCache::hitCount() const
+    {
+        return mImpl->hitCount;
+    }
+
+    size_t TextCache::missCount() const
+    {
+        return mImpl->missCount;
+    }
+
+    TextCache::Run const & TextCache::run(std::string_view text, float size, Alignment alignment)
+    {
+        Impl & impl{ *mImpl };
+        if (!impl.font.isLoaded()) {
+            return impl.empty;
+        }
+
+        KeyView const key{ text, size, alignment };
+        if (auto found{ impl.runs.find(key) }; found != impl.runs.end()) {
+            ++impl.hitCount;
+            return found->second;
+        }
+
+        ++impl.missCount;
+        Run & run{ impl.runs.emplace(Key{ std::string(text), size, alignment }, Run{}).first->second };
+        impl.layout(text, impl.atlas(size), alignment, run);
+        return run;
+    }
+
+    void TextCache::trim()
+    {
+        if (mImpl->runs.size() > mImpl->capacity) {
+            mImpl->runs.clear();
+        }
+    }
+
+    void TextCache::resetCounters()
+    {
+        mImpl->hitCount = 0;
+        mImpl->missCount = 0;
+    }
+
+} // namespace ezgame
@@ -0,0 +1,293 @@
+// Implémentation sans fenêtre (headless) de la classe Timer.
+//
+// L'histogramme des temps écoulés est logarithmique-linéaire : les temps 
+// inférieurs à 128 us ont chacun leur classe, puis chaque puissance de 2 
+// est divisée en 64 classes égales. Le maximum de la fenêtre est suivi par 
+// une file monotone (décroissante) des tics pouvant encore le devenir : 
+// chaque tic y entre et en sort au plus une fois.
+
+
+// Inclusion des bibliothèques
+#include "Timer.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+    namespace {
+
+        size_t const smDefaultWindowSize{ 1000 };
+        int64_t const smDefaultFrameBudget{ 16'667 };
+
+        // Classes de l'histogramme : 128 classes exactes, puis 64 classes 
+        // par puissance de 2 jusqu'à Timer::smMaximumTicTime.
+        int const smSubBucketBits{ 7 };
+        uint64_t const smSubBucketCount{ uint64_t{ 1 } << smSubBucketBits };
+        uint64_t const smSubBucketHalfCount{ smSubBucketCount / 2 };
+        size_t const smBucketCount{ static_cast<size_t>(smSubBucketHalfCount * (std::bit_width(static_cast<uint64_t>(Timer::smMaximumTicTime)) - smSubBucketBits + 2)) };
+
+        size_t bucketOf(uint64_t value)
+        {
+            if (value < smSubBucketCount) {
+                return static_cast<size_t>(value);
+            }
+            int const shift{ static_cast<int>(std::bit_width(value)) - smSubBucketBits };
+            return static_cast<size_t>(smSubBucketHalfCount * static_cast<uint64_t>(shift + 1) + (value >> shift) - smSubBucketHalfCount);
+        }
+
+        // Plus grande valeur de la classe donnée.
+        uint64_t highestValueOf(size_t bucket)
+        {
+            if (bucket < smSubBucketCount) {
+                return bucket;
+            }
+            uint64_t const shift{ bucket / smSubBucketHalfCount - 1 };
+            uint64_t const subBucket{ bucket % smSubBucketHalfCount + smSubBucketHalfCount };
+            return ((subBucket + 1) << shift) - 1;
+        }
+
+    } // namespace
+
+    //! \cond PRIVATE
+    struct Timer::Impl
+    {
+        using Clock = std::chrono::steady_clock;
+
+        Clock::time_point startup{ Clock::now() };
+        Clock::time_point lastTic{ startup };
+        int64_t sinceLastTic{};
+
+        // Pas fixe ou relecture d'une session : le temps n'est plus mesuré 
+        // mais imposé.
+        bool imposed{};
+        int64_t imposedSinceStartup{};
+
+        // Fenêtre circulaire des derniers temps écoulés (bornés à 
+        // [0, smMaximumTicTime]) servant à l'estimation du nombre de tics 
+        // par seconde et aux statistiques.
+        std::vector<int64_t> window;
+        size_t windowIndex{};
+        size_t windowCount{};
+        int64_t windowSum{};
+        uint64_t windowSquareSum{};
+        std::vector<uint32_t> histogram;
+
+        // File monotone des numéros de tic (ticCount au moment du tic) 
+        // dont le temps est plus grand que celui de tous les tics suivants. 
+        // Le temps du tic t est window[t % window.size()] : windowIndex 
+        // reste égal à ticCount % window.size().
+        std::vector<uint64_t> maxQueue;
+        size_t maxQueueFirst{};
+        size_t maxQueueSize{};
+        uint64_t ticCount{};
+
+        int64_t frameBudget{ smDefaultFrameBudget };
+        size_t overBudgetCount{};
+
+        explicit Impl(size_t framesUsedForFPS)
+        {
+            reset(framesUsedForFPS);
+        }
+
+        void reset(size_t windowSize)
+        {
+            windowSize = std::clamp(windowSize, size_t{ 1 }, smMaximumWindowSize);
+            window.assign(windowSize, 0);
+            windowIndex = 0;
+            windowCount = 0;
+            windowSum = 0;
+            windowSquareSum = 0;
+            histogram.assign(smBucketCount, 0);
+            maxQueue.assign(windowSize, 0);
+            maxQueueFirst = 0;
+            maxQueueSize = 0;
+            overBudgetCount = 0;
+            ticCount = 0;
+        }
+
+        int64_t const & timeOf(uint64_t tic) const
+        {
+            return window[static_cast<size_t>(tic % window.size())];
+        }
+    };
+    //! \endcond
+
+    Timer::Timer(size_t framesUsedForFPS)
+        : mImpl{ std::make_unique<Impl>(framesUsedForFPS) }
+    {
+    }
+
+    Timer::~Timer() = default;
+
+    int64_t Timer::sinceLastTic() const
+    {
+        return mImpl->sinceLastTic;
+    }
+
+    int64_t Timer::sinceStartup() const
+    {
+        if (mImpl->imposed) {
+            return mImpl->imposedSinceStartup;
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(Impl::Clock::now() - mImpl->startup).count();
+    }
+
+    float Timer::secondSinceLastTic() const
+    {
+        return static_cast<float>(sinceLastTic()) * 1.0e-6f;
+    }
+
+    float Timer::secondSinceStartup() const
+    {
+        return static_cast<float>(sinceStartup()) * 1.0e-6f;
+    }
+
+    float Timer::fpsEstimation() const
+    {
+        if (mImpl->windowSum <= 0) {
+            return 0.0f;
+        }
+
+        return static_cast<float>(mImpl->window.size()) * 1.0e6f / static_cast<float>(mImpl->windowSum);
+    }
+
+    int64_t Timer::percentile(double p) const
+    {
+        Impl const & impl{ *mImpl };
+        if (impl.windowCount == 0) {
+            return 0;
+        }
+
+        // Les centiles élevés sont cherchés à partir de la classe du 
+        // maximum, les autres à partir de la première classe.
+        uint64_t const count{ impl.windowCount };
+        uint64_t const rank{ std::max(static_cast<uint64_t>(std::ceil(std::clamp(p, 0.0, 1.0) * static_cast<double>(count))), uint64_t{ 1 }) };
+        int64_t const maximum{ max() };
+        uint64_t cumulated{};
+        size_t bucket{};
+        if (rank > count / 2) {
+            bucket = bucketOf(static_cast<uint64_t>(maximum));
+            while ((cumulated += impl.histogram[bucket]) < count - rank + 1) {
+                --bucket;
+            }
+        } else {
+            while ((cumulated += impl.histogram[bucket]) < rank) {
+                ++bucket;
+            }
+        }
+        return std::min(static_cast<int64_t>(highestValueOf(bucket)), maximum);
+    }
+
+    int64_t Timer::max() const
+    {
+        Impl const & impl{ *mImpl };
+        return impl.maxQueueSize > 0 ? impl.timeOf(impl.maxQueue[impl.maxQueueFirst]) : 0;
+    }
+
+    float Timer::jitter() const
+    {
+        Impl const & impl{ *mImpl };
+        if (impl.windowCount == 0) {
+            return 0.0f;
+        }
+
+        double const count{ static_cast<double>(impl.windowCount) };
+        double const mean{ static_cast<double>(impl.windowSum) / count };
+        double const variance{ static_cast<double>(impl.windowSquareSum) / count - mean * mean };
+        return static_cast<float>(std::sqrt(std::max(variance, 0.0)));
+    }
+
+    size_t Timer::overBudgetCount() const
+    {
+        return mImpl->overBudgetCount;
+    }
+
+    int64_t Timer::frameBudget() const
+    {
+        return mImpl->frameBudget;
+    }
+
+    size_t Timer::windowSize() const
+    {
+        return mImpl->window.size();
+    }
+
+    size_t Timer::windowTicCount() const
+    {
+        return mImpl->windowCount;
+    }
+
+    void Timer::tic()
+    {
+        Impl::Clock::time_point now{ Impl::Clock::now() };
+        mImpl->sinceLastTic = std::chrono::duration_cast<std::chrono::microseconds>(now - mImpl->lastTic).count();
+        mImpl->lastTic = now;
+        updateWindow();
+    }
+
+    void Timer::tic(int64_t sinceLastTic)
+    {
+        mImpl->imposed = true;
+        mImpl->sinceLastTic = sinceLastTic;
+        mImpl->imposedSinceStartup += sinceLastTic;
+        mImpl->lastTic = Impl::Clock::now();
+        updateWindow();
+    }
+
+    void Timer::updateWindow()
+    {
+        Impl & impl{ *mImpl };
+        size_t const size{ impl.window.size() };
+        uint64_t const tic{ impl.ticCount++ };
+
+        // Retrait du tic sorti de la fenêtre.
+        int64_t & oldest{ impl.window[impl.windowIndex] };
+        if (impl.windowCount == size) {
+            --impl.histogram[bucketOf(static_cast<uint64_t>(oldest))];
+            impl.windowSum -= oldest;
+            impl.windowSquareSum -= static_cast<uint64_t>(oldest) * static_cast<uint64_t>(oldest);
+            impl.overBudgetCount -= oldest > impl.frameBudget ? 1 : 0;
+            if (impl.maxQueue[impl.maxQueueFirst] == tic - size) {
+                impl.maxQueueFirst = (impl.maxQueueFirst + 1) % size;
+                --impl.maxQueueSize;
+            }
+        } else {
+            ++impl.windowCount;
+        }
+
+        // Ajout du nouveau tic.
+        int64_t const time{ std::clamp(impl.sinceLastTic, int64_t{}, smMaximumTicTime) };
+        oldest = time;
+        ++impl.histogram[bucketOf(static_cast<uint64_t>(time))];
+        impl.windowSum += time;
+        impl.windowSquareSum += static_cast<uint64_t>(time) * static_cast<uint64_t>(time);
+        impl.overBudgetCount += time > impl.frameBudget ? 1 : 0;
+        while (impl.maxQueueSize > 0 && impl.timeOf(impl.maxQueue[(impl.maxQueueFirst + impl.maxQueueSize - 1) % size]) <= time) {
+            --impl.maxQueueSize;
+        }
+        impl.maxQueue[(impl.maxQueueFirst + impl.maxQueueSize) % size] = tic;
+        ++impl.maxQueueSize;
+
+        impl.windowIndex = (impl.windowIndex + 1) % size;
+    }
+
+    void Timer::setWindowSize(size_t ticCount)
+    {
+        mImpl->reset(ticCount);
+    }
+
+    void Timer::setFrameBudget(int64_t microseconds)
+    {
+        Impl & impl{ *mImpl };
+        impl.frameBudget = std::max(microseconds, int64_t{});
+        impl.overBudgetCount = static_cast<size_t>(std::count_if(impl.window.begin(), impl.window.begin() + static_cast<std::ptrdiff_t>(impl.windowCount),
+            [&impl](int64_t time) { return time > impl.frameBudget; }));
+    }
+
+} // namespace ezgame
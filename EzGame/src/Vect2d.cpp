@@ -0,0 +1,207 @@
+// Définitions hors ligne de la classe Vect2d.
+//
+// Les opérations arithmétiques sont définies en ligne dans Vect2d.h. Ce 
+// fichier ne contient que ce qui n'a pas à être intégré dans les boucles 
+// de calcul : la génération aléatoire, la mise en forme textuelle et les 
+// paramètres statiques de la classe.
+//
+// La mise en forme écrit directement dans un tampon avec std::to_chars : 
+// elle ne passe ni par les flux ni par des chaînes temporaires.
+
+
+// Inclusion des bibliothèques
+#include "Vect2d.h"
+#include "Random.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <numbers>
+
+
+// Déclaration du namespace ezgame
+namespace ezgame {
+
+	float Vect2d::smEpsilon{ 1.0e-5f };
+	thread_local size_t Vect2d::smPrecision{ 3 };
+	thread_local std::string Vect2d::smPrefix{ "(" };
+	thread_local std::string Vect2d::smSeparator{ ", " };
+	thread_local std::string Vect2d::smSuffix{ ")" };
+
+	namespace {
+
+		// Nombre maximal de caractères d'un float fini écrit en notation 
+		// fixe sans décimale : signe et 39 chiffres.
+		size_t const smMaximumIntegerLength{ 40 };
+
+		static_assert(2 * (smMaximumIntegerLength + 1 + Vect2d::smMaximumPrecision) + 4 < Vect2d::smFormatBufferSize,
+			"smFormatBufferSize doit contenir deux valeurs a la precision maximale et les reglages par defaut");
+
+		// Ajoute le texte à la position courante. Retourne nullptr si le 
+		// tampon est trop petit.
+		char * append(char * first, char * last, std::string_view text)
+		{
+			if (first == nullptr || static_cast<size_t>(last - first) < text.size()) {
+				return nullptr;
+			}
+			std::memcpy(first, text.data(), text.size());
+			return first + text.size();
+		}
+
+		char * append(char * first, char * last, float value, int precision)
+		{
+			if (first == nullptr) {
+				return nullptr;
+			}
+			std::to_chars_result const result{ std::to_chars(first, last, value, std::chars_format::fixed, precision) };
+			return result.ec == std::errc{} ? result.ptr : nullptr;
+		}
+
+	} // namespace
+
+	Vect2d Vect2d::fromRandomized()
+	{
+		return fromRandomized(-1.0f, 1.0f, -1.0f, 1.0f);
+	}
+
+	Vect2d Vect2d::fromRandomized(float xMin, float xMax, float yMin, float yMax)
+	{
+		return Vect2d(Random::real(xMin, xMax), Random::real(yMin, yMax));
+	}
+
+	Vect2d Vect2d::fromPolarRandomized(float lengthMin, float lengthMax)
+	{
+		return fromPolarRandomized(lengthMin, lengthMax, 0.0f, 2.0f * std::numbers::pi_v<float>);
+	}
+
+	Vect2d Vect2d::fromPolarRandomized(float lengthMin, float lengthMax, float oriMin, float oriMax)
+	{
+		return fromPolar(Random::real(lengthMin, lengthMax), Random::real(oriMin, oriMax));
+	}
+
+	void Vect2d::randomize()
+	{
+		*this = fromRandomized();
+	}
+
+	void Vect2d::randomize(float xMin, float xMax, float yMin, float yMax)
+	{
+		*this = fromRandomized(xMin, xMax, yMin, yMax);
+	}
+
+	void Vect2d::randomizePolar(float lengthMin, float lengthMax)
+	{
+		*this = fromPolarRandomized(lengthMin, lengthMax);
+	}
+
+	void Vect2d::randomizePolar(float lengthMin, float lengthMax, float oriMin, float oriMax)
+	{
+		*this = fromPolarRandomized(lengthMin, lengthMax, oriMin, oriMax);
+	}
+
+	std::string Vect2d::toString() const
+	{
+		char buffer[smFormatBufferSize];
+		size_t const length{ formatTo(buffer, sizeof(buffer)) };
+		if (length > 0) {
+			return std::string(buffer, length);
+		}
+
+		// Préfixe, séparateur ou suffixe trop longs pour le tampon local : 
+		// smFormatBufferSize suffit toujours pour les deux valeurs.
+		std::string text(smPrefix.size() + smSeparator.size() + smSuffix.size() + smFormatBufferSize, '\0');
+		text.resize(formatTo(text.data(), text.size()));
+		return text;
+	}
+
+	size_t Vect2d::formatTo(char * buffer, size_t size) const
+	{
+		return formatTo(buffer, size, format());
+	}
+
+	size_t Vect2d::formatTo(char * buffer, size_t size, Format const& format) const
+	{
+		if (buffer == nullptr || size == 0) {
+			return 0;
+		}
+
+		// Le dernier caractère est réservé au caractère nul.
+		char * const last{ buffer + size - 1 };
+		int const precision{ std::clamp(format.precision, 0, static_cast<int>(smMaximumPrecision)) };
+		char * end{ append(buffer, last, format.prefix) };
+		end = append(end, last, mX, precision);
+		end = append(end, last, format.separator);
+		end = append(end, last, mY, precision);
+		end = append(end, last, format.suffix);
+
+		if (end == nullptr) {
+			buffer[0] = '\0';
+			return 0;
+		}
+		*end = '\0';
+		return static_cast<size_t>(end - buffer);
+	}
+
+	std::ostream& operator<<(std::ostream& stream, Vect2d const& vector)
+	{
+		char buffer[Vect2d::smFormatBufferSize];
+		size_t const length{ vector.formatTo(buffer, sizeof(buffer)) };
+		if (length > 0) {
+			return stream.write(buffer, static_cast<std::streamsize>(length));
+		}
+		return stream << vector.toString();
+	}
+
+	std::string Vect2d::prefix()
+	{
+		return smPrefix;
+	}
+
+	std::string Vect2d::separator()
+	{
+		return smSeparator;
+	}
+
+	std::string Vect2d::suffix()
+	{
+		return smSuffix;
+	}
+
+	void Vect2d::setPrefix(std::string const& prefix)
+	{
+		smPrefix = prefix;
+	}
+
+	void Vect2d::setSeparator(std::string const& separator)
+	{
+		smSeparator = separator;
+	}
+
+	void Vect2d::setSuffix(std::string const& suffix)
+	{
+		smSuffix = suffix;
+	}
+
+	void Vect2d::setFormat(std::string const& prefix, std::string const& separator, std::string const& suffix)
+	{
+		smPrefix = prefix;
+		smSeparator = separator;
+		smSuffix = suffix;
+	}
+
+	size_t Vect2d::precision()
+	{
+		return smPrecision;
+	}
+
+	void Vect2d::setPrecision(size_t precision)
+	{
+		smPrecision = std::min(precision, smMaximumPrecision);
+	}
+
+	Vect2d::Format Vect2d::format()
+	{
+		return Format{ smPrefix, smSeparator, smSuffix, static_cast<int>(smPrecision) };
+	}
+
+} // namespace ezgame
@@ -0,0 +1,40 @@
+#pragma once
+#ifndef _EZGAME_CHECK_H_
+#define _EZGAME_CHECK_H_
+
+
+// Vérifications communes aux programmes de test.
+//
+// Chaque test est un programme indépendant. CHECK affiche la ligne et le
+// texte de chaque condition fausse; checkReport affiche « ok » ou « ECHEC »
+// et retourne le code de sortie du programme.
+
+
+// Inclusion des bibliothèques
+#include <cstdio>
+
+
+namespace {
+
+    int failureCount{};
+
+    void check(bool condition, char const * description, int line)
+    {
+        if (!condition) {
+            std::printf("echec (ligne %d) : %s\n", line, description);
+            ++failureCount;
+        }
+    }
+
+    int checkReport()
+    {
+        std::printf("%s\n", failureCount == 0 ? "ok" : "ECHEC");
+        return failureCount == 0 ? 0 : 1;
+    }
+
+} // namespace
+
+#define CHECK(condition) check((condition), #condition, __LINE__)
+
+
+#endif // _EZGAME_CHECK_H_
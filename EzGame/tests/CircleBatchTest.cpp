@@ -0,0 +1,98 @@
+// Test : alignement des cercles de CircleBatch.
+//
+// Vérifie que CircleBatch::add convertit un cercle d'un autre alignement
+// en conservant son centre et que les tests de collision
+// (firstColliding, collidingPairs) comparent les centres des cercles,
+// comme Circle::isColliding. Le rayon minimal et le changement
+// d'alignement suivent aussi les règles de Circle.
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include "Check.h"
+
+#include <cmath>
+#include <vector>
+
+
+namespace {
+
+    bool near(ezgame::Vect2d const& a, ezgame::Vect2d const& b)
+    {
+        return std::abs(a.x() - b.x()) <= 1.0e-4f && std::abs(a.y() - b.y()) <= 1.0e-4f;
+    }
+
+} // namespace
+
+
+int main()
+{
+    using ezgame::Alignment;
+    using ezgame::Circle;
+    using ezgame::CircleBatch;
+    using ezgame::Color;
+    using ezgame::Vect2d;
+
+    // Conversion à l'ajout : le centre est conservé.
+    CircleBatch batch(4, Alignment::TopLeft);
+    Circle const centered(10.0f, Vect2d(100.0f, 100.0f), Color::Red);
+    size_t const index{ batch.add(centered) };
+    CHECK(near(batch.position(index), Vect2d(90.0f, 90.0f)));
+    CHECK(near(batch.circle(index).center(), centered.center()));
+    Circle const bottomRight(5.0f, Vect2d(50.0f, 50.0f), Color::Red, Alignment::BottomRight);
+    CHECK(near(batch.circle(batch.add(bottomRight)).center(), Vect2d(45.0f, 45.0f)));
+    Circle const topLeft(5.0f, Vect2d(20.0f, 20.0f), Color::Red, Alignment::TopLeft);
+    CHECK(near(batch.position(batch.add(topLeft)), Vect2d(20.0f, 20.0f)));
+
+    // firstColliding compare les centres.
+    CircleBatch aligned(4, Alignment::TopLeft);
+    aligned.add(10.0f, Vect2d(0.0f, 0.0f), Color::Red);
+    CHECK(aligned.firstColliding(Vect2d(10.0f, 10.0f), 1.0f) == 0);
+    CHECK(aligned.firstColliding(Vect2d(-5.0f, -5.0f), 1.0f) == CircleBatch::npos);
+    CHECK(aligned.isColliding(Circle(1.0f, Vect2d(21.0f, 10.0f), Color::Red)));
+    CHECK(!aligned.isColliding(Circle(1.0f, Vect2d(21.0f, 10.0f), Color::Red, Alignment::CenterLeft)));
+
+    // Le parcours par blocs applique aussi le décalage.
+    CircleBatch many(64, Alignment::BottomCenter);
+    for (size_t i{}; i < 40; ++i) {
+        many.add(2.0f, Vect2d(static_cast<float>(i) * 10.0f, 0.0f), Color::Red);
+    }
+    CHECK(many.firstColliding(Vect2d(200.0f, -2.0f), 0.5f) == 20);
+    CHECK(many.firstColliding(Vect2d(350.0f, -2.0f), 0.5f) == 35);
+    CHECK(many.firstColliding(Vect2d(350.0f, 2.0f), 0.5f) == CircleBatch::npos);
+
+    // collidingPairs : rayons différents, même alignement.
+    CircleBatch pairsBatch(4, Alignment::CenterLeft);
+    pairsBatch.add(10.0f, Vect2d(0.0f, 0.0f), Color::Red);
+    pairsBatch.add(1.0f, Vect2d(20.0f, 0.0f), Color::Red);
+    pairsBatch.add(2.0f, Vect2d(35.0f, 0.0f), Color::Red);
+    std::vector<CircleBatch::IndexPair> pairs;
+    CHECK(pairsBatch.collidingPairs(pairs) == 1 && pairs.back() == CircleBatch::IndexPair(0, 1));
+
+    // collidingPairs entre ensembles d'alignements différents.
+    CircleBatch left(2, Alignment::CenterLeft);
+    CircleBatch right(2, Alignment::CenterRight);
+    left.add(5.0f, Vect2d(0.0f, 0.0f), Color::Red);
+    right.add(5.0f, Vect2d(20.0f, 0.0f), Color::Red);
+    pairs.clear();
+    CHECK(left.collidingPairs(right, pairs) == 1);
+    right.setPosition(0, Vect2d(21.0f, 0.0f));
+    CHECK(left.collidingPairs(right, pairs) == 0);
+    CHECK(!left.circle(0).isColliding(right.circle(0)));
+
+    // Rayon minimal de Circle, à l'ajout comme à la modification.
+    CircleBatch small(2);
+    size_t const tiny{ small.add(0.25f, Vect2d(), Color::Red) };
+    CHECK(small.radius(tiny) == Circle(0.25f, Vect2d(), Color::Red).radius());
+    small.setRadius(tiny, -3.0f);
+    CHECK(small.radius(tiny) == Circle::smMinimumRadius);
+
+    // setAlignment conserve les positions, comme Circle::setAlignment.
+    CircleBatch realigned(1, Alignment::CenterCenter);
+    realigned.add(5.0f, Vect2d(50.0f, 50.0f), Color::Red);
+    realigned.setAlignment(Alignment::TopLeft);
+    CHECK(near(realigned.position(0), Vect2d(50.0f, 50.0f)));
+    CHECK(near(realigned.circle(0).center(), Vect2d(55.0f, 55.0f)));
+
+    return checkReport();
+}
@@ -0,0 +1,159 @@
+// Test : tables de ColorGradient comparées aux calculs scalaires.
+//
+// Chaque entrée d'un dégradé doit correspondre, à l'arrondi près, à la
+// couleur calculée directement : Color::blended entre les couleurs clés
+// encadrant la position de l'entrée (ColorGradient::fromStops, couleurs
+// clés dans le désordre) et Color::fromHsl (ColorGradient::fromHslRange,
+// teinte faisant le tour du cercle). La table ColorRGBA8 doit être la
+// conversion exacte de la table Color, et les lectures par paramètre
+// (at, packedAt, sample) doivent donner l'entrée la plus proche, le
+// paramètre étant limité à [0, 1].
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include "Check.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+namespace {
+
+    float const smTolerance{ 1.0e-4f };
+
+    bool near(float a, float b)
+    {
+        return std::abs(a - b) <= smTolerance;
+    }
+
+    bool near(ezgame::Color const& a, ezgame::Color const& b)
+    {
+        return near(a.red(), b.red()) && near(a.green(), b.green()) && near(a.blue(), b.blue()) && near(a.alpha(), b.alpha());
+    }
+
+    bool same(ezgame::Color const& a, ezgame::Color const& b)
+    {
+        return a.red() == b.red() && a.green() == b.green() && a.blue() == b.blue() && a.alpha() == b.alpha();
+    }
+
+    // Couleur du dégradé à la position donnée, calculée directement à
+    // partir des couleurs clés triées.
+    ezgame::Color referenceStop(std::vector<ezgame::ColorGradient::Stop> const& sorted, float position)
+    {
+        if (position < sorted.front().position) {
+            return sorted.front().color;
+        }
+        for (size_t i{ 1 }; i < sorted.size(); ++i) {
+            if (position < sorted[i].position) {
+                float const progress{ (position - sorted[i - 1].position) / (sorted[i].position - sorted[i - 1].position) };
+                return sorted[i - 1].color.blended(sorted[i].color, 1.0f - progress, true);
+            }
+        }
+        return sorted.back().color;
+    }
+
+    // La table ColorRGBA8 est la conversion de la table Color.
+    bool packedMatches(ezgame::ColorGradient const& gradient)
+    {
+        bool equal{ gradient.packedColors().size() == gradient.size() && gradient.colors().size() == gradient.size() };
+        for (size_t i{}; equal && i < gradient.size(); ++i) {
+            equal = gradient.packedColors()[i] == ezgame::ColorRGBA8(gradient[i]);
+        }
+        return equal;
+    }
+
+} // namespace
+
+
+int main()
+{
+    using ezgame::Color;
+    using ezgame::ColorGradient;
+    using ezgame::ColorRGBA8;
+
+    // Table par défaut : une seule couleur, blanche.
+    ColorGradient const defaultGradient;
+    CHECK(defaultGradient.size() == 1 && same(defaultGradient[0], Color::White));
+    CHECK(same(defaultGradient.at(0.7f), Color::White));
+
+    // Dégradé RGB : couleurs clés dans le désordre, constantes avant la
+    // première et après la dernière.
+    std::vector<ColorGradient::Stop> const stops{
+        { 0.8f, Color(0.0f, 0.0f, 1.0f, 0.0f) },
+        { 0.1f, Color::Yellow },
+        { 0.45f, Color(1.0f, 0.0f, 0.0f, 0.5f) },
+        { 0.6f, Color::Gray } };
+    std::vector<ColorGradient::Stop> sorted{ stops };
+    std::stable_sort(sorted.begin(), sorted.end(), [](ColorGradient::Stop const& a, ColorGradient::Stop const& b) { return a.position < b.position; });
+
+    for (size_t size : { size_t{ 1 }, size_t{ 2 }, size_t{ 7 }, size_t{ 101 }, ColorGradient::smDefaultSize }) {
+        ColorGradient const gradient{ ColorGradient::fromStops(stops, size) };
+        bool stopsMatch{ gradient.size() == size };
+        for (size_t i{}; stopsMatch && i < size; ++i) {
+            float const position{ size > 1 ? static_cast<float>(i) / static_cast<float>(size - 1) : 0.0f };
+            stopsMatch = near(gradient[i], referenceStop(sorted, position));
+        }
+        CHECK(stopsMatch);
+        CHECK(packedMatches(gradient));
+    }
+    ColorGradient const rgb{ ColorGradient::fromStops(stops) };
+    CHECK(same(rgb.at(0.0f), Color::Yellow));
+    CHECK(same(rgb.at(1.0f), sorted.back().color));
+    CHECK(ColorGradient::fromStops({}, 4).size() == 4 && same(ColorGradient::fromStops({}, 4)[3], Color::White));
+
+    // Dégradé HSL : la teinte passe de 0.8 à 1.2.
+    float const alpha{ 0.75f };
+    ColorGradient const hsl{ ColorGradient::fromHslRange(0.8f, 1.2f, 1.0f, 0.5f, 0.3f, 0.6f, alpha, 64) };
+    bool hslMatches{ hsl.size() == 64 };
+    for (size_t i{}; hslMatches && i < hsl.size(); ++i) {
+        float const progress{ static_cast<float>(i) / 63.0f };
+        hslMatches = near(hsl[i], Color::fromHsl(0.8f + 0.4f * progress, 1.0f - 0.5f * progress, 0.3f + 0.3f * progress, alpha));
+    }
+    CHECK(hslMatches);
+    CHECK(packedMatches(hsl));
+
+    // Palette : les couleurs telles quelles.
+    std::vector<Color> const palette{ Color::Red, Color(0.2f, 0.4f, 0.6f, 0.8f), Color::Transparent };
+    ColorGradient const colors{ ColorGradient::fromColors(palette) };
+    CHECK(colors.size() == palette.size());
+    CHECK(same(colors[0], palette[0]) && same(colors[1], palette[1]) && same(colors[2], palette[2]));
+    CHECK(packedMatches(colors));
+    CHECK(ColorGradient::fromColors({}).size() == 1);
+
+    // Lectures par paramètre : entrée la plus proche, paramètre limité à
+    // [0, 1] (NaN compris), mêmes valeurs par lot.
+    std::mt19937 generator(434);
+    std::uniform_real_distribution<float> distribution(-0.5f, 1.5f);
+    std::vector<float> parameters{ 0.0f, 1.0f, -0.0f, -1.0f, 2.0f, 0.5f, std::numeric_limits<float>::quiet_NaN(),
+        -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity() };
+    while (parameters.size() < 1000) {
+        parameters.push_back(distribution(generator));
+    }
+    std::vector<Color> sampled(parameters.size());
+    std::vector<ColorRGBA8> packedSampled(parameters.size());
+    rgb.sample(parameters, sampled);
+    rgb.sample(parameters, packedSampled);
+    bool lookupsMatch{ true };
+    for (size_t i{}; i < parameters.size(); ++i) {
+        float const parameter{ parameters[i] };
+        float const clamped{ parameter > 0.0f ? std::min(parameter, 1.0f) : 0.0f };
+        size_t const index{ static_cast<size_t>(clamped * static_cast<float>(rgb.size() - 1) + 0.5f) };
+        lookupsMatch = lookupsMatch && same(rgb.at(parameter), rgb[index]) && rgb.packedAt(parameter) == rgb.packedColors()[index];
+        lookupsMatch = lookupsMatch && same(sampled[i], rgb[index]) && packedSampled[i] == rgb.packedColors()[index];
+    }
+    CHECK(lookupsMatch);
+
+    // Couleur aléatoire : toujours une couleur de la palette.
+    bool randomInPalette{ true };
+    for (size_t i{}; i < 100; ++i) {
+        Color const& color{ colors.random() };
+        randomInPalette = randomInPalette && &color >= colors.colors().data() && &color < colors.colors().data() + colors.size();
+    }
+    CHECK(randomInPalette);
+
+    return checkReport();
+}
@@ -0,0 +1,106 @@
+// Test : définitions de la classe Color.
+//
+// Vérifie les valeurs documentées dans Color.h (couleurs prédéfinies,
+// limitation des composantes, convention de Color::blended) et la
+// cohérence des conversions HSL et HSV de Color avec celles de
+// ColorBatch.
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include "Check.h"
+
+#include <array>
+#include <cmath>
+
+
+namespace {
+
+    float const smTolerance{ 1.0e-4f };
+
+    bool near(float a, float b)
+    {
+        return std::abs(a - b) <= smTolerance;
+    }
+
+    bool equal(ezgame::Color const& color, float red, float green, float blue, float alpha)
+    {
+        return near(color.red(), red) && near(color.green(), green) && near(color.blue(), blue) && near(color.alpha(), alpha);
+    }
+
+    bool equal(ezgame::Color const& a, ezgame::Color const& b)
+    {
+        return equal(a, b.red(), b.green(), b.blue(), b.alpha());
+    }
+
+} // namespace
+
+
+int main()
+{
+    using ezgame::Color;
+
+    // Valeurs documentées
+    CHECK(equal(Color(), 0.0f, 0.0f, 0.0f, 1.0f));
+    CHECK(equal(Color(0.1f, 0.2f, 0.3f), 0.1f, 0.2f, 0.3f, 1.0f));
+    CHECK(equal(Color::Transparent, 0.0f, 0.0f, 0.0f, 0.0f));
+    CHECK(equal(Color::Orange, 1.0f, 0.5f, 0.0f, 1.0f));
+    CHECK(equal(Color::Sky, 0.0f, 0.5f, 1.0f, 1.0f));
+    CHECK(equal(Color::DarkGray, 0.25f, 0.25f, 0.25f, 1.0f));
+    CHECK(equal(Color::gray(0.6f), 0.6f, 0.6f, 0.6f, 1.0f));
+
+    // Les composantes sont limitées à [0, 1].
+    Color color(0.5f, 0.5f, 0.5f, 0.5f);
+    color.set(2.0f, -1.0f, 0.25f);
+    CHECK(equal(color, 1.0f, 0.0f, 0.25f, 0.5f));
+    color.setAlpha(3.0f);
+    CHECK(near(color.alpha(), 1.0f));
+
+    // blended : blendFactor est la proportion de la couleur courante.
+    Color const translucentRed(1.0f, 0.0f, 0.0f, 0.2f);
+    CHECK(equal(translucentRed.blended(Color::Blue, 0.25f), 0.25f, 0.0f, 0.75f, 0.2f));
+    CHECK(equal(translucentRed.blended(Color::Blue, 0.25f, true), 0.25f, 0.0f, 0.75f, 0.8f));
+    CHECK(equal(translucentRed.blended(Color::Blue, 2.0f), translucentRed));
+    CHECK(equal(Color::White.darker(0.25f), 0.75f, 0.75f, 0.75f, 1.0f));
+    CHECK(equal(Color::Black.lighter(0.25f), 0.25f, 0.25f, 0.25f, 1.0f));
+
+    // HSL et HSV
+    float hue, saturation, lightness, value;
+    Color::Orange.getHsl(hue, saturation, lightness);
+    CHECK(near(hue, 30.0f / 360.0f) && near(saturation, 1.0f) && near(lightness, 0.5f));
+    Color::Gray.getHsv(hue, saturation, value);
+    CHECK(near(hue, 0.0f) && near(saturation, 0.0f) && near(value, 0.5f));
+    CHECK(equal(Color::fromHsl(1.0f / 3.0f, 1.0f, 0.5f), Color::Green));
+    CHECK(equal(Color::fromHsv(2.0f / 3.0f, 1.0f, 1.0f, 0.5f), 0.0f, 0.0f, 1.0f, 0.5f));
+    CHECK(equal(Color::fromHsl(1.25f, 0.8f, 0.4f), Color::fromHsl(0.25f, 0.8f, 0.4f)));
+    color = Color::Sky;
+    color.setHslLightness(0.25f);
+    CHECK(equal(color, 0.0f, 0.25f, 0.5f, 1.0f));
+
+    // Allers-retours et cohérence avec ColorBatch
+    size_t const steps{ 12 };
+    std::array<float, steps * steps * steps> hues, saturations, lightnesses;
+    std::array<Color, steps * steps * steps> hslColors, hsvColors;
+    for (size_t i{}; i < hues.size(); ++i) {
+        hues[i] = static_cast<float>(i % steps) / steps;
+        saturations[i] = static_cast<float>(i / steps % steps + 1) / (steps + 1);
+        lightnesses[i] = static_cast<float>(i / (steps * steps) + 1) / (steps + 1);
+    }
+    ezgame::ColorBatch::hslToRgb(hues, saturations, lightnesses, hslColors);
+    ezgame::ColorBatch::hsvToRgb(hues, saturations, lightnesses, hsvColors);
+    bool hslMatches{ true };
+    bool hsvMatches{ true };
+    bool roundTrips{ true };
+    for (size_t i{}; i < hues.size(); ++i) {
+        Color const fromHsl{ Color::fromHsl(hues[i], saturations[i], lightnesses[i]) };
+        hslMatches = hslMatches && equal(fromHsl, hslColors[i]);
+        hsvMatches = hsvMatches && equal(Color::fromHsv(hues[i], saturations[i], lightnesses[i]), hsvColors[i]);
+        fromHsl.getHsl(hue, saturation, lightness);
+        roundTrips = roundTrips && equal(Color::fromHsl(hue, saturation, lightness), fromHsl);
+    }
+    CHECK(hslMatches);
+    CHECK(hsvMatches);
+    CHECK(roundTrips);
+
+    return checkReport();
+}
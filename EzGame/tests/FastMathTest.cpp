@@ -0,0 +1,145 @@
+// Test : erreurs de FastMath comparées aux fonctions de la bibliothèque
+// standard.
+//
+// Les erreurs maximales documentées dans FastMath.h sont vérifiées par
+// rapport aux fonctions calculées en double précision : inverseSqrt sur
+// toute l'étendue des réels normalisés, atan2 sur tous les octants (et
+// les axes), sin, cos et sincos sur [-1000, 1000] radians. La version par
+// lot de sincos doit donner exactement les valeurs de la version
+// scalaire, et les variantes `...Fast` de Vect2d doivent respecter les
+// mêmes bornes.
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include "Check.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+namespace {
+
+    size_t const smSampleCount{ 200'000 };
+    double const smPi{ 3.14159265358979323846 };
+
+#if defined(EZGAME_SIMD_SSE)
+    double const smInverseSqrtError{ 3.0e-7 };
+#else
+    double const smInverseSqrtError{ 5.0e-6 };
+#endif
+    double const smAtan2Error{ 2.0e-6 };
+    double const smSinCosError{ 2.0e-7 };
+    double const smMaximumAngle{ 1000.0 };
+
+    std::mt19937 generator(434);
+
+    // Écart entre deux angles, ramené dans [0, pi].
+    double angleError(double a, double b)
+    {
+        double const error{ std::abs(std::remainder(a - b, 2.0 * smPi)) };
+        return error;
+    }
+
+} // namespace
+
+
+int main()
+{
+    using ezgame::FastMath;
+
+    // inverseSqrt : erreur relative, du plus petit au plus grand réel
+    // normalisé.
+    double inverseSqrtError{};
+    std::uniform_real_distribution<float> exponent(-125.0f, 127.0f);
+    for (size_t i{}; i < smSampleCount; ++i) {
+        float const value{ i == 0 ? std::numeric_limits<float>::min() : i == 1 ? std::numeric_limits<float>::max() : std::exp2(exponent(generator)) };
+        double const exact{ 1.0 / std::sqrt(static_cast<double>(value)) };
+        inverseSqrtError = std::max(inverseSqrtError, std::abs(static_cast<double>(FastMath::inverseSqrt(value)) - exact) / exact);
+    }
+    CHECK(inverseSqrtError < smInverseSqrtError);
+
+    // atan2 : erreur absolue sur tous les octants, les axes et des
+    // rapports extrêmes.
+    double atan2Error{};
+    std::uniform_real_distribution<float> coordinate(-1000.0f, 1000.0f);
+    std::vector<float> const special{ 0.0f, -0.0f, 1.0f, -1.0f, 1.0e-30f, -1.0e-30f, 1.0e30f, -1.0e30f };
+    for (float y : special) {
+        for (float x : special) {
+            if (x != 0.0f || y != 0.0f) {
+                atan2Error = std::max(atan2Error, angleError(FastMath::atan2(y, x), std::atan2(static_cast<double>(y), static_cast<double>(x))));
+            }
+        }
+    }
+    for (size_t i{}; i < smSampleCount; ++i) {
+        float const y{ coordinate(generator) };
+        float const x{ coordinate(generator) };
+        atan2Error = std::max(atan2Error, angleError(FastMath::atan2(y, x), std::atan2(static_cast<double>(y), static_cast<double>(x))));
+    }
+    CHECK(atan2Error < smAtan2Error);
+    CHECK(FastMath::atan2(0.0f, 0.0f) == 0.0f);
+
+    // sin, cos et sincos : erreur absolue sur [-1000, 1000] radians, avec
+    // les multiples de pi/4 (bornes de la réduction d'argument).
+    std::vector<float> angles;
+    for (int multiple{ -40 }; multiple <= 40; ++multiple) {
+        angles.push_back(static_cast<float>(multiple * smPi / 4.0));
+    }
+    std::uniform_real_distribution<float> angle(static_cast<float>(-smMaximumAngle), static_cast<float>(smMaximumAngle));
+    std::uniform_real_distribution<float> smallAngle(-10.0f, 10.0f);
+    while (angles.size() < smSampleCount) {
+        angles.push_back(angles.size() % 2 ? angle(generator) : smallAngle(generator));
+    }
+    angles.push_back(static_cast<float>(smMaximumAngle));
+    angles.push_back(static_cast<float>(-smMaximumAngle));
+
+    double sinCosError{};
+    bool sincosConsistent{ true };
+    for (float value : angles) {
+        double const exactSine{ std::sin(static_cast<double>(value)) };
+        double const exactCosine{ std::cos(static_cast<double>(value)) };
+        float sine;
+        float cosine;
+        FastMath::sincos(value, sine, cosine);
+        sinCosError = std::max({ sinCosError, std::abs(sine - exactSine), std::abs(cosine - exactCosine) });
+        sinCosError = std::max({ sinCosError, std::abs(FastMath::sin(value) - exactSine), std::abs(FastMath::cos(value) - exactCosine) });
+        sincosConsistent = sincosConsistent && FastMath::sin(value) == sine && FastMath::cos(value) == cosine;
+    }
+    CHECK(sinCosError < smSinCosError);
+    CHECK(sincosConsistent);
+
+    // Version par lot : mêmes valeurs que la version scalaire, pour une
+    // taille qui n'est pas un multiple des blocs.
+    std::vector<float> sines(angles.size() - 3);
+    std::vector<float> cosines(angles.size());
+    FastMath::sincos(angles, sines, cosines);
+    bool batchEqual{ true };
+    for (size_t i{}; i < sines.size(); ++i) {
+        float sine;
+        float cosine;
+        FastMath::sincos(angles[i], sine, cosine);
+        batchEqual = batchEqual && sines[i] == sine && cosines[i] == cosine;
+    }
+    CHECK(batchEqual);
+    CHECK(cosines.back() == 0.0f);
+
+    // Variantes rapides de Vect2d.
+    double vectorError{};
+    for (size_t i{}; i < 10'000; ++i) {
+        ezgame::Vect2d const vector(coordinate(generator), coordinate(generator));
+        if (vector.squaredLength() > 0.0f) {
+            vectorError = std::max(vectorError, static_cast<double>(std::abs(vector.normalizedFast().length() - 1.0f)) - smInverseSqrtError);
+            vectorError = std::max(vectorError, angleError(vector.orientationFast(), vector.orientation()) - smAtan2Error);
+        }
+        float const orientation{ angle(generator) };
+        ezgame::Vect2d const polar{ ezgame::Vect2d::fromPolarFast(2.0f, orientation) };
+        vectorError = std::max(vectorError, std::abs(polar.x() - 2.0 * std::cos(static_cast<double>(orientation))) - 2.0 * smSinCosError);
+    }
+    // À l'arrondi des calculs de Vect2d près.
+    CHECK(vectorError < 1.0e-6);
+
+    return checkReport();
+}
@@ -0,0 +1,143 @@
+// Test : pas de simulation fixe (FixedTimestep, Application::setFixedTimestep).
+//
+// Des temps écoulés imposés sont découpés en pas de 10 ms : vérifie le
+// nombre de pas de rattrapage de chaque image, la limite de pas par image
+// (le retard est abandonné, seul le reste inférieur à un pas est conservé)
+// et le facteur d'interpolation. Sur une longue suite de temps
+// quelconques, le temps écoulé doit se retrouver en entier dans les pas
+// exécutés, les pas abandonnés et le reste. Enfin, Application doit
+// imposer la durée du pas au Timer du moteur de jeu.
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include <FixedTimestep.h>
+#include "Check.h"
+
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <string>
+
+
+namespace {
+
+    using std::chrono::microseconds;
+
+    int64_t const smStep{ 10'000 };
+    size_t const smMaxStepsPerFrame{ 4 };
+
+    bool near(float a, float b)
+    {
+        return std::abs(a - b) <= 1.0e-6f;
+    }
+
+    size_t stepCount{};
+    size_t wrongStepCount{};
+    size_t wrongInterpolationCount{};
+
+    class SteppedEngine
+    {
+    public:
+        float width() const { return 320.0f; }
+        float height() const { return 240.0f; }
+        std::string title() const { return "FixedTimestepTest"; }
+        std::string iconFileName() const { return ""; }
+
+        bool provessEvents(ezgame::Keyboard const&, ezgame::Timer const& timer)
+        {
+            ++stepCount;
+            wrongStepCount += timer.sinceLastTic() == smStep ? 0 : 1;
+            return true;
+        }
+
+        void processDisplay(ezgame::Screen &, float alpha)
+        {
+            wrongInterpolationCount += alpha >= 0.0f && alpha < 1.0f ? 0 : 1;
+        }
+    };
+
+} // namespace
+
+
+int main()
+{
+    using ezgame::FixedTimestep;
+
+    // Sans pas fixe : un pas par image.
+    FixedTimestep disabled;
+    CHECK(!disabled.isEnabled());
+    CHECK(disabled.advance(microseconds(123'456)) == 1);
+    CHECK(disabled.interpolation() == 0.0f);
+
+    FixedTimestep timestep(smStep, smMaxStepsPerFrame);
+    CHECK(timestep.isEnabled() && timestep.step() == smStep && timestep.maxStepsPerFrame() == smMaxStepsPerFrame);
+
+    // La première image exécute un pas.
+    CHECK(timestep.advance(microseconds(0)) == 1);
+    CHECK(near(timestep.interpolation(), 0.0f));
+
+    // Rattrapage : 25 ms donnent 2 pas et un reste d'un demi-pas.
+    CHECK(timestep.advance(microseconds(25'000)) == 2);
+    CHECK(near(timestep.interpolation(), 0.5f));
+    // Le reste s'ajoute à l'image suivante.
+    CHECK(timestep.advance(microseconds(5'000)) == 1);
+    CHECK(near(timestep.interpolation(), 0.0f));
+    CHECK(timestep.advance(microseconds(3'000)) == 0);
+    CHECK(near(timestep.interpolation(), 0.3f));
+    CHECK(timestep.droppedSteps() == 0);
+
+    // Limite de pas : 3 ms + 48 ms donnent 5 pas, dont 1 abandonné; seul
+    // le reste de 1 ms est conservé.
+    CHECK(timestep.advance(microseconds(48'000)) == smMaxStepsPerFrame);
+    CHECK(timestep.droppedSteps() == 1);
+    CHECK(near(timestep.interpolation(), 0.1f));
+    CHECK(timestep.advance(microseconds(9'000)) == 1);
+    CHECK(near(timestep.interpolation(), 0.0f));
+
+    // Long retard : tout ce qui dépasse la limite est abandonné.
+    CHECK(timestep.advance(microseconds(1'000'500)) == smMaxStepsPerFrame);
+    CHECK(timestep.droppedSteps() == 1 + 100 - smMaxStepsPerFrame);
+    CHECK(near(timestep.interpolation(), 0.05f));
+
+    // Un temps négatif ne retire rien.
+    CHECK(timestep.advance(microseconds(-50'000)) == 0);
+    CHECK(near(timestep.interpolation(), 0.05f));
+
+    // reset : un pas en attente, aucun pas abandonné.
+    timestep.reset();
+    CHECK(timestep.droppedSteps() == 0);
+    CHECK(timestep.advance(microseconds(0)) == 1);
+
+    // Suite quelconque : temps écoulé + premier pas = pas exécutés et
+    // abandonnés + reste.
+    std::mt19937 generator(434);
+    std::uniform_int_distribution<int64_t> elapsed(0, 60'000);
+    FixedTimestep sequence(smStep, smMaxStepsPerFrame);
+    int64_t total{ smStep };
+    size_t executed{};
+    bool bounded{ true };
+    for (size_t frame{}; frame < 10'000; ++frame) {
+        int64_t const time{ elapsed(generator) };
+        total += time;
+        size_t const steps{ sequence.advance(microseconds(time)) };
+        executed += steps;
+        bounded = bounded && steps <= smMaxStepsPerFrame && sequence.interpolation() >= 0.0f && sequence.interpolation() < 1.0f;
+    }
+    CHECK(bounded);
+    int64_t const remainder{ total - static_cast<int64_t>(executed + sequence.droppedSteps()) * smStep };
+    CHECK(remainder >= 0 && remainder < smStep);
+    CHECK(std::abs(sequence.interpolation() - static_cast<float>(remainder) / static_cast<float>(smStep)) <= 1.0e-4f);
+
+    // Application : chaque pas voit exactement la durée du pas.
+    ezgame::Application application;
+    application.setFixedTimestep(smStep, smMaxStepsPerFrame);
+    application.setFrameLimit(100);
+    CHECK(application.fixedTimestep() == smStep && application.maxStepsPerFrame() == smMaxStepsPerFrame);
+    application.run<SteppedEngine>();
+    CHECK(stepCount >= 1);
+    CHECK(wrongStepCount == 0);
+    CHECK(wrongInterpolationCount == 0);
+
+    return checkReport();
+}
@@ -0,0 +1,102 @@
+// Test : lecture bornée des glyphes de Font.
+//
+// Les glyphes de la police fournie sont dessinés normalement. Une copie
+// de la police dont un glyphe annonce plus de coordonnées qu'il n'en
+// contient doit donner une carte vide pour ce glyphe, sans lire au-delà
+// de ses données, et laisser les autres glyphes intacts.
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include "Check.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+    char const * const smFontFileName{ "EzGame/resources/arial.ttf" };
+
+    uint32_t read(std::vector<uint8_t> const & data, size_t offset, size_t size)
+    {
+        uint32_t value{};
+        for (size_t i{}; i < size && offset + i < data.size(); ++i) {
+            value = value << 8 | data[offset + i];
+        }
+        return value;
+    }
+
+    size_t table(std::vector<uint8_t> const & data, char const * tag)
+    {
+        size_t const count{ read(data, 4, 2) };
+        for (size_t i{}; i < count; ++i) {
+            size_t const record{ 12 + 16 * i };
+            if (record + 16 <= data.size() && std::memcmp(&data[record], tag, 4) == 0) {
+                return read(data, record + 8, 4);
+            }
+        }
+        return 0;
+    }
+
+    bool drawn(ezgame::Font const & font, char32_t codePoint)
+    {
+        ezgame::Font::Bitmap bitmap;
+        font.rasterize(font.glyphIndex(codePoint), 32.0f, bitmap);
+        return bitmap.width > 0 && bitmap.height > 0 && bitmap.coverage.size() == bitmap.width * bitmap.height;
+    }
+
+} // namespace
+
+
+int main()
+{
+    ezgame::Font font;
+    CHECK(font.load(smFontFileName));
+    CHECK(drawn(font, U'A'));
+    CHECK(drawn(font, U'B'));
+
+    // Données du glyphe 'A' (loca, glyf).
+    std::ifstream input(smFontFileName, std::ios::binary);
+    std::vector<uint8_t> data{ std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>() };
+    size_t const head{ table(data, "head") };
+    size_t const loca{ table(data, "loca") };
+    size_t const glyf{ table(data, "glyf") };
+    CHECK(head > 0 && loca > 0 && glyf > 0);
+    uint32_t const glyph{ font.glyphIndex(U'A') };
+    bool const longOffsets{ read(data, head + 50, 2) == 1 };
+    size_t const begin{ glyf + (longOffsets ? read(data, loca + 4 * glyph, 4) : 2 * read(data, loca + 2 * glyph, 2)) };
+    size_t const end{ glyf + (longOffsets ? read(data, loca + 4 * glyph + 4, 4) : 2 * read(data, loca + 2 * glyph + 2, 2)) };
+    size_t const contourCount{ read(data, begin, 2) };
+    CHECK(contourCount > 0 && contourCount < 0x8000);
+    size_t const pointCount{ read(data, begin + 8 + 2 * contourCount, 2) + size_t{ 1 } };
+    size_t const flags{ begin + 12 + 2 * contourCount + read(data, begin + 10 + 2 * contourCount, 2) };
+
+    // Tous les drapeaux sans répétition et à coordonnées sur 16 bits : les
+    // coordonnées débordent alors des données du glyphe.
+    CHECK(flags + pointCount <= end && flags + 5 * pointCount > end);
+    if (flags + pointCount <= end) {
+        std::fill(data.begin() + flags, data.begin() + flags + pointCount, uint8_t{ 0x01 });
+    }
+    std::string const fileName{ (std::filesystem::temp_directory_path() / "ezgame_font_test.ttf").string() };
+    {
+        std::ofstream output(fileName, std::ios::binary);
+        output.write(reinterpret_cast<char const *>(data.data()), static_cast<std::streamsize>(data.size()));
+    }
+
+    ezgame::Font malformed;
+    CHECK(malformed.load(fileName));
+    std::filesystem::remove(fileName);
+    ezgame::Font::Bitmap bitmap;
+    malformed.rasterize(glyph, 32.0f, bitmap);
+    CHECK(bitmap.width == 0 && bitmap.height == 0 && bitmap.coverage.empty());
+    CHECK(drawn(malformed, U'B'));
+
+    return checkReport();
+}
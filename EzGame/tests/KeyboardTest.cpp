@@ -0,0 +1,112 @@
+// Test : instantané du clavier vu par le moteur de jeu.
+//
+// Une session est enregistrée (InputRecording) puis relue par Application :
+// à chaque pas de simulation, le moteur de jeu doit voir exactement les
+// touches enregistrées, ainsi que les transitions (wasKeyPressed,
+// wasKeyReleased) par rapport au pas précédent.
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include "Check.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+    using Key = ezgame::Keyboard::Key;
+    using KeySet = ezgame::Keyboard::KeySet;
+
+    struct Observation
+    {
+        bool aPressed;
+        bool aWasPressed;
+        bool aWasReleased;
+        bool spacePressed;
+        size_t pressedCount;
+        KeySet state;
+    };
+
+    std::vector<Observation> observations;
+
+    class RecordingEngine
+    {
+    public:
+        float width() const { return 320.0f; }
+        float height() const { return 240.0f; }
+        std::string title() const { return "KeyboardTest"; }
+        std::string iconFileName() const { return ""; }
+
+        bool provessEvents(ezgame::Keyboard const& keyboard, ezgame::Timer const&)
+        {
+            size_t pressedCount{};
+            for (Key key : keyboard.pressedKeys()) {
+                pressedCount += keyboard.isKeyPressed(key) ? 1 : 0;
+            }
+            observations.push_back({
+                keyboard.isKeyPressed(Key::A),
+                keyboard.wasKeyPressed(Key::A),
+                keyboard.wasKeyReleased(Key::A),
+                keyboard.isKeyPressed(Key::Space),
+                pressedCount,
+                keyboard.state() });
+            return true;
+        }
+
+        void processDisplay(ezgame::Screen &) {}
+    };
+
+    KeySet keys(std::initializer_list<Key> pressed)
+    {
+        KeySet set;
+        for (Key key : pressed) {
+            set.set(static_cast<size_t>(key));
+        }
+        return set;
+    }
+
+} // namespace
+
+
+int main()
+{
+    std::vector<KeySet> const frames{
+        keys({}),
+        keys({ Key::A }),
+        keys({ Key::A, Key::Space }),
+        keys({ Key::Space }),
+        keys({}),
+        keys({ Key::A }) };
+
+    ezgame::InputRecording recording;
+    for (KeySet const& frame : frames) {
+        recording.add(frame, 16667);
+    }
+    std::string const fileName{ (std::filesystem::temp_directory_path() / "ezgame_keyboard_test.ezir").string() };
+    CHECK(recording.save(fileName));
+
+    ezgame::Application application;
+    application.setReplayFile(fileName);
+    application.run<RecordingEngine>();
+    std::filesystem::remove(fileName);
+
+    CHECK(observations.size() == frames.size());
+    if (observations.size() == frames.size()) {
+        for (size_t i{}; i < frames.size(); ++i) {
+            CHECK(observations[i].state == frames[i]);
+            CHECK(observations[i].pressedCount == frames[i].count());
+            CHECK(observations[i].spacePressed == frames[i].test(static_cast<size_t>(Key::Space)));
+        }
+        CHECK(!observations[0].aPressed && !observations[0].aWasPressed && !observations[0].aWasReleased);
+        CHECK(observations[1].aPressed && observations[1].aWasPressed && !observations[1].aWasReleased);
+        CHECK(observations[2].aPressed && !observations[2].aWasPressed && !observations[2].aWasReleased);
+        CHECK(!observations[3].aPressed && !observations[3].aWasPressed && observations[3].aWasReleased);
+        CHECK(!observations[4].aPressed && !observations[4].aWasPressed && !observations[4].aWasReleased);
+        CHECK(observations[5].aPressed && observations[5].aWasPressed);
+    }
+
+    return checkReport();
+}
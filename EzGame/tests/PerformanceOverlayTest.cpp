@@ -0,0 +1,113 @@
+// Test : surcouche de performance (Application::setOverlayVisible).
+//
+// Les allocations sont comptées par AllocationCounter. Afficher la
+// surcouche ne doit ajouter aucune allocation : le moteur de jeu relève le
+// compte après quelques images de réchauffement, puis à la dernière image
+// (ce qui écarte le démarrage et l'arrêt), et le compte avec la surcouche
+// affichée est comparé à celui de la même exécution surcouche cachée (les
+// durées conservées pour le rapport de Screen grandissent de la même
+// façon dans les deux cas). Vérifie aussi que la surcouche ajoute des
+// appels de rendu.
+//
+// Le jeu s'arrête quelques fois pendant PerformanceOverlay::smRefreshInterval
+// pour que les valeurs affichées soient mises à jour : une première fois
+// pendant le réchauffement (les valeurs commencent alors à être dessinées
+// et les tampons du rendu grandissent), puis pendant la mesure.
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include <PerformanceOverlay.h>
+#include "Check.h"
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+
+namespace {
+
+    size_t const smFrameCount{ 1000 };
+    size_t const smWarmUpFrameCount{ 300 };
+    size_t const smPauseInterval{ 250 };
+    size_t const smCircleCount{ 100 };
+
+    size_t frameCount{};
+    size_t lastDrawCallCount{};
+    size_t allocationsAtWarmUp{};
+    size_t allocationsAtEnd{};
+
+    class CirclesEngine
+    {
+    public:
+        CirclesEngine()
+            : mCircles(smCircleCount)
+            , mText("Proies : 100", 20.0f, ezgame::Vect2d(160.0f, 20.0f), ezgame::Color::White, ezgame::Alignment::TopCenter)
+        {
+            for (size_t i{}; i < smCircleCount; ++i) {
+                mCircles.add(5.0f, ezgame::Vect2d(static_cast<float>(i * 37 % 320), static_cast<float>(i * 91 % 240)), ezgame::Color::Blue);
+            }
+        }
+
+        float width() const { return 320.0f; }
+        float height() const { return 240.0f; }
+        std::string title() const { return "PerformanceOverlayTest"; }
+        std::string iconFileName() const { return ""; }
+
+        bool provessEvents(ezgame::Keyboard const&, ezgame::Timer const&)
+        {
+            if (frameCount % smPauseInterval == smPauseInterval - 1) {
+                std::this_thread::sleep_for(std::chrono::microseconds(ezgame::PerformanceOverlay::smRefreshInterval));
+            }
+            mCircles.moveAll(ezgame::Vect2d(0.01f, 0.0f));
+            return true;
+        }
+
+        void processDisplay(ezgame::Screen & screen)
+        {
+            ++frameCount;
+            lastDrawCallCount = screen.drawCallCount();
+            if (frameCount == smWarmUpFrameCount) {
+                allocationsAtWarmUp = ezgame::AllocationCounter::count();
+            }
+            allocationsAtEnd = ezgame::AllocationCounter::count();
+            screen.clear();
+            screen.draw(mCircles);
+            screen.draw(mText);
+        }
+
+    private:
+        ezgame::CircleBatch mCircles;
+        ezgame::Text mText;
+    };
+
+    // Retourne le nombre d'allocations des images qui suivent le
+    // réchauffement.
+    size_t run(bool overlayVisible)
+    {
+        ezgame::Application application;
+        application.setFrameLimit(smFrameCount);
+        application.setOverlayVisible(overlayVisible);
+
+        frameCount = 0;
+        application.run<CirclesEngine>();
+        return allocationsAtEnd - allocationsAtWarmUp;
+    }
+
+} // namespace
+
+
+int main()
+{
+    CHECK(ezgame::AllocationCounter::isEnabled());
+
+    size_t const hiddenAllocations{ run(false) };
+    CHECK(frameCount == smFrameCount);
+    size_t const hiddenDrawCallCount{ lastDrawCallCount };
+
+    CHECK(run(true) == hiddenAllocations);
+    CHECK(frameCount == smFrameCount);
+    CHECK(lastDrawCallCount > hiddenDrawCallCount);
+
+    return checkReport();
+}
@@ -0,0 +1,124 @@
+// Test : images identiques avec et sans fil de rendu.
+//
+// Le même jeu (déterministe : tout dépend du numéro de l'image) est
+// exécuté avec le rendu logiciel, sans puis avec le mode pipeline
+// (Application::setPipelined). L'empreinte de chaque image, lue à l'image
+// suivante (Screen::framebuffer, la première lecture donnant l'image
+// vide), et le fichier de capture de la dernière image
+// (Application::setCaptureFile) doivent être identiques.
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include "Check.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+    size_t const smFrameCount{ 60 };
+    size_t const smCircleCount{ 200 };
+
+    std::vector<uint64_t> fingerprints;
+
+    // Empreinte FNV-1a des pixels.
+    uint64_t fingerprint(ezgame::Framebuffer const & framebuffer)
+    {
+        uint64_t hash{ 14695981039346656037ull };
+        for (ezgame::ColorRGBA8 pixel : framebuffer.pixels()) {
+            hash = (hash ^ pixel.packed()) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    class MovingEngine
+    {
+    public:
+        MovingEngine()
+            : mCircles(smCircleCount)
+            , mText("0", 24.0f, ezgame::Vect2d(160.0f, 20.0f), ezgame::Color::White, ezgame::Alignment::TopCenter)
+        {
+            for (size_t i{}; i < smCircleCount; ++i) {
+                ezgame::Color const fill(static_cast<float>(i % 7) / 6.0f, static_cast<float>(i % 5) / 4.0f, 0.5f, 0.75f);
+                mCircles.add(3.0f + static_cast<float>(i % 9), ezgame::Vect2d(static_cast<float>(i * 37 % 320), static_cast<float>(i * 91 % 240)), fill);
+            }
+        }
+
+        float width() const { return 320.0f; }
+        float height() const { return 240.0f; }
+        std::string title() const { return "PipelineCaptureTest"; }
+        std::string iconFileName() const { return ""; }
+
+        bool provessEvents(ezgame::Keyboard const&, ezgame::Timer const&)
+        {
+            ++mFrame;
+            mCircles.moveAll(ezgame::Vect2d(1.5f, 0.5f));
+            mText.setText(mFrame);
+            return true;
+        }
+
+        void processDisplay(ezgame::Screen & screen)
+        {
+            ezgame::Framebuffer const & framebuffer{ screen.framebuffer() };
+            if (framebuffer.width() > 0) {
+                fingerprints.push_back(fingerprint(framebuffer));
+            }
+
+            screen.clear(ezgame::Color(0.1f, 0.1f, 0.2f));
+            screen.draw(mCircles);
+            screen.draw(ezgame::Circle(30.0f, ezgame::Vect2d(static_cast<float>(mFrame * 4 % 320), 120.0f), ezgame::Color::Yellow, ezgame::Color::Red, 3.0f));
+            screen.draw(mText);
+            if (mFrame % 10 == 0) {
+                screen.clear(ezgame::Color(1.0f, 1.0f, 1.0f, 0.25f));
+            }
+        }
+
+    private:
+        ezgame::CircleBatch mCircles;
+        ezgame::Text mText;
+        size_t mFrame{};
+    };
+
+    // Empreintes des images et contenu du fichier de capture.
+    std::vector<uint64_t> run(bool pipelined, std::string const & captureFile, std::string & captured)
+    {
+        fingerprints.clear();
+        ezgame::Application application;
+        application.setPipelined(pipelined);
+        application.setCaptureFile(captureFile);
+        application.setFrameLimit(smFrameCount);
+        application.run<MovingEngine>();
+
+        std::ifstream input(captureFile, std::ios::binary);
+        captured.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+        std::filesystem::remove(captureFile);
+        return fingerprints;
+    }
+
+} // namespace
+
+
+int main()
+{
+    std::string const fileName{ (std::filesystem::temp_directory_path() / "ezgame_pipeline_capture_test.ppm").string() };
+    std::string direct;
+    std::string pipelined;
+    std::vector<uint64_t> const directFingerprints{ run(false, fileName, direct) };
+    std::vector<uint64_t> const pipelinedFingerprints{ run(true, fileName, pipelined) };
+
+    CHECK(directFingerprints.size() == smFrameCount);
+    CHECK(pipelinedFingerprints == directFingerprints);
+    CHECK(!direct.empty());
+    CHECK(pipelined == direct);
+
+    // Les images changent bien d'une image à l'autre.
+    CHECK(directFingerprints.size() > 1 && directFingerprints.front() != directFingerprints.back());
+
+    return checkReport();
+}
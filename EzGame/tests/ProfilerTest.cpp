@@ -0,0 +1,246 @@
+// Test : exportation de Profiler.
+//
+// Exporte un profil vide (aucun fil inscrit, aucune zone), puis un profil
+// contenant des zones, et vérifie que les deux fichiers sont du JSON
+// valide et contiennent le nombre attendu de zones.
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include "Check.h"
+
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+
+namespace {
+
+    // Analyseur JSON minimal : vrai si le texte contient exactement une
+    // valeur JSON valide.
+    class JsonValidator
+    {
+    public:
+        explicit JsonValidator(std::string const & text)
+            : mText{ text }
+        {
+        }
+
+        bool valid()
+        {
+            skipSpaces();
+            if (!value()) {
+                return false;
+            }
+            skipSpaces();
+            return mPosition == mText.size();
+        }
+
+    private:
+        std::string const & mText;
+        size_t mPosition{};
+
+        bool atEnd() const { return mPosition >= mText.size(); }
+        char peek() const { return atEnd() ? '\0' : mText[mPosition]; }
+
+        void skipSpaces()
+        {
+            while (!atEnd() && std::isspace(static_cast<unsigned char>(peek()))) {
+                ++mPosition;
+            }
+        }
+
+        bool consume(char expected)
+        {
+            skipSpaces();
+            if (peek() != expected) {
+                return false;
+            }
+            ++mPosition;
+            return true;
+        }
+
+        bool literal(char const * word)
+        {
+            for (; *word; ++word, ++mPosition) {
+                if (peek() != *word) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool string()
+        {
+            if (!consume('"')) {
+                return false;
+            }
+            while (!atEnd()) {
+                char const character{ mText[mPosition++] };
+                if (character == '"') {
+                    return true;
+                }
+                if (static_cast<unsigned char>(character) < 0x20) {
+                    return false;
+                }
+                if (character == '\\') {
+                    char const escaped{ peek() };
+                    ++mPosition;
+                    if (escaped == 'u') {
+                        for (int i{}; i < 4; ++i, ++mPosition) {
+                            if (!std::isxdigit(static_cast<unsigned char>(peek()))) {
+                                return false;
+                            }
+                        }
+                    } else if (std::string{ "\"\\/bfnrt" }.find(escaped) == std::string::npos) {
+                        return false;
+                    }
+                }
+            }
+            return false;
+        }
+
+        bool number()
+        {
+            size_t const start{ mPosition };
+            if (peek() == '-') {
+                ++mPosition;
+            }
+            size_t const digits{ mPosition };
+            while (std::isdigit(static_cast<unsigned char>(peek()))) {
+                ++mPosition;
+            }
+            if (mPosition == digits) {
+                return false;
+            }
+            if (peek() == '.') {
+                ++mPosition;
+                size_t const fraction{ mPosition };
+                while (std::isdigit(static_cast<unsigned char>(peek()))) {
+                    ++mPosition;
+                }
+                if (mPosition == fraction) {
+                    return false;
+                }
+            }
+            if (peek() == 'e' || peek() == 'E') {
+                ++mPosition;
+                if (peek() == '+' || peek() == '-') {
+                    ++mPosition;
+                }
+                size_t const exponent{ mPosition };
+                while (std::isdigit(static_cast<unsigned char>(peek()))) {
+                    ++mPosition;
+                }
+                if (mPosition == exponent) {
+                    return false;
+                }
+            }
+            return mPosition > start;
+        }
+
+        template <typename Element>
+        bool sequence(char opening, char closing, Element element)
+        {
+            if (!consume(opening)) {
+                return false;
+            }
+            skipSpaces();
+            if (peek() == closing) {
+                ++mPosition;
+                return true;
+            }
+            do {
+                if (!element()) {
+                    return false;
+                }
+            } while (consume(','));
+            return consume(closing);
+        }
+
+        bool value()
+        {
+            skipSpaces();
+            switch (peek()) {
+            case '{':
+                return sequence('{', '}', [this]() { return string() && consume(':') && value(); });
+            case '[':
+                return sequence('[', ']', [this]() { return value(); });
+            case '"':
+                return string();
+            case 't':
+                return literal("true");
+            case 'f':
+                return literal("false");
+            case 'n':
+                return literal("null");
+            default:
+                return number();
+            }
+        }
+    };
+
+    std::string readFile(std::string const & fileName)
+    {
+        std::ifstream input(fileName, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+    }
+
+    size_t countOf(std::string const & text, std::string const & pattern)
+    {
+        size_t count{};
+        for (size_t position{ text.find(pattern) }; position != std::string::npos; position = text.find(pattern, position + pattern.size())) {
+            ++count;
+        }
+        return count;
+    }
+
+} // namespace
+
+
+int main()
+{
+    using ezgame::Profiler;
+
+    std::string const fileName{ (std::filesystem::temp_directory_path() / "ezgame_profiler_test.json").string() };
+
+    // Profil vide : aucun fil inscrit et aucune zone.
+    CHECK(Profiler::save(fileName, 0));
+    std::string const empty{ readFile(fileName) };
+    CHECK(JsonValidator(empty).valid());
+    CHECK(countOf(empty, "\"traceEvents\":[") == 1);
+    CHECK(countOf(empty, "\"ph\":") == 0);
+
+    // Profil non vide : un fil nommé (avec des caractères à échapper) et
+    // trois zones, dont une avant le début de l'image exportée.
+    Profiler::setThreadName("principal \"test\"\\");
+    uint64_t const before{ Profiler::ticks() };
+    Profiler::record("avant", before, before + 1);
+    Profiler::markFrame();
+    {
+        EZ_PROFILE_SCOPE("zone");
+    }
+    uint64_t const after{ Profiler::ticks() };
+    Profiler::record("directe", after, after + 10);
+    Profiler::record("directe", after + 20, after + 30);
+
+    CHECK(Profiler::save(fileName, 1));
+    std::string const filled{ readFile(fileName) };
+    CHECK(JsonValidator(filled).valid());
+    CHECK(countOf(filled, "\"ph\":\"M\"") == 1);
+    CHECK(countOf(filled, "\"name\":\"directe\"") == 2);
+    CHECK(countOf(filled, "\"name\":\"avant\"") == 0);
+#if defined(EZGAME_PROFILER)
+    CHECK(countOf(filled, "\"ph\":\"X\"") == 3);
+#else
+    CHECK(countOf(filled, "\"ph\":\"X\"") == 2);
+#endif
+
+    // L'analyseur rejette bien le fichier tronqué de l'ancienne version.
+    CHECK(!JsonValidator("{\"displayTimeUnit\":\"ms\",\"traceEvents\":\n]}\n").valid());
+
+    std::filesystem::remove(fileName);
+    return checkReport();
+}
@@ -0,0 +1,158 @@
+// Test : entiers de Random et de RandomStream.
+//
+// Les plages d'au moins 2^32 valeurs utilisent la méthode de Lemire sur
+// 64 bits. Vérifie les bornes, la répartition, la reproductibilité à
+// graine égale et, lorsque le compilateur offre des entiers de 128 bits,
+// l'égalité avec une implémentation de référence. Vérifie aussi les
+// bornes des types plus petits que int (short, signed char, int8_t), avec
+// Random et avec RandomStream.
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include "Check.h"
+
+#include <cstdint>
+#include <limits>
+
+
+namespace {
+
+    size_t const smDrawCount{ 300000 };
+    size_t const smNarrowDrawCount{ 10000 };
+
+    // Vrai si toutes les valeurs tirées sont dans [minimum, maximum] et si
+    // les deux bornes sont atteintes.
+    template <typename int_type, typename Draw>
+    bool coversRange(int_type minimum, int_type maximum, Draw draw)
+    {
+        bool inRange{ true };
+        bool sawMinimum{ false };
+        bool sawMaximum{ false };
+        for (size_t i{}; i < smNarrowDrawCount; ++i) {
+            int_type const value{ draw(minimum, maximum) };
+            inRange = inRange && value >= minimum && value <= maximum;
+            sawMinimum = sawMinimum || value == minimum;
+            sawMaximum = sawMaximum || value == maximum;
+        }
+        return inRange && sawMinimum && sawMaximum;
+    }
+
+#if defined(__SIZEOF_INT128__)
+    // Extension du compilateur : __extension__ évite l'avertissement de
+    // -Wpedantic.
+    __extension__ typedef unsigned __int128 uint128_t;
+
+    uint64_t next64(ezgame::Random::Engine & engine)
+    {
+        if constexpr (ezgame::Random::Engine::max() == std::numeric_limits<uint32_t>::max()) {
+            uint64_t const high{ engine() };
+            return (high << 32) | engine();
+        }
+        else {
+            return engine();
+        }
+    }
+
+    // Méthode de Lemire avec le produit de 128 bits du compilateur.
+    uint64_t referenceBounded(ezgame::Random::Engine & engine, uint64_t range)
+    {
+        uint64_t const count{ range + 1 };
+        uint128_t product{ static_cast<uint128_t>(next64(engine)) * count };
+        uint64_t low{ static_cast<uint64_t>(product) };
+        if (low < count) {
+            uint64_t const threshold{ (uint64_t{} - count) % count };
+            while (low < threshold) {
+                product = static_cast<uint128_t>(next64(engine)) * count;
+                low = static_cast<uint64_t>(product);
+            }
+        }
+        return static_cast<uint64_t>(product >> 64);
+    }
+#endif
+
+} // namespace
+
+
+int main()
+{
+    using ezgame::Random;
+
+    // Bornes et répartition sur une plage de 3 x 2^32 valeurs.
+    uint64_t const maximum{ 3 * (uint64_t{ 1 } << 32) - 1 };
+    uint64_t const third{ uint64_t{ 1 } << 32 };
+    size_t thirds[3]{};
+    bool inRange{ true };
+    Random::seed(434);
+    for (size_t i{}; i < smDrawCount; ++i) {
+        uint64_t const value{ Random::integer<uint64_t>(0, maximum) };
+        inRange = inRange && value <= maximum;
+        ++thirds[value / third < 3 ? value / third : 2];
+    }
+    CHECK(inRange);
+    for (size_t count : thirds) {
+        CHECK(count > smDrawCount / 3 * 97 / 100 && count < smDrawCount / 3 * 103 / 100);
+    }
+
+    // Plage signée à cheval sur zéro et plage totale.
+    int64_t const bound{ int64_t{ 1 } << 40 };
+    bool signedInRange{ true };
+    size_t negatives{};
+    for (size_t i{}; i < smDrawCount; ++i) {
+        int64_t const value{ Random::integer<int64_t>(-bound, bound) };
+        signedInRange = signedInRange && value >= -bound && value <= bound;
+        negatives += value < 0;
+    }
+    CHECK(signedInRange);
+    CHECK(negatives > smDrawCount * 48 / 100 && negatives < smDrawCount * 52 / 100);
+    bool wide{ false };
+    for (size_t i{}; i < 64; ++i) {
+        wide = wide || Random::integer<int64_t>() > (int64_t{ 1 } << 62);
+    }
+    CHECK(wide);
+
+    // Même graine, même suite.
+    Random::seed(2024);
+    uint64_t first[16];
+    for (uint64_t & value : first) {
+        value = Random::integer<uint64_t>(0, maximum);
+    }
+    Random::seed(2024);
+    bool reproducible{ true };
+    for (uint64_t value : first) {
+        reproducible = reproducible && Random::integer<uint64_t>(0, maximum) == value;
+    }
+    CHECK(reproducible);
+
+    // Types plus petits que int : la différence des bornes ne doit pas 
+    // être élargie avec son signe.
+    auto fromRandom = [](auto minimum, auto maximum) { return Random::integer<decltype(minimum)>(minimum, maximum); };
+    CHECK(coversRange<short>(-10, 10, fromRandom));
+    CHECK(coversRange<short>(-30000, -29990, fromRandom));
+    CHECK(coversRange<signed char>(-100, 100, fromRandom));
+    CHECK(coversRange<int8_t>(-128, 127, fromRandom));
+    CHECK(coversRange<unsigned char>(0, 255, fromRandom));
+    ezgame::RandomStream stream(434, 7);
+    auto fromStream = [&stream](auto minimum, auto maximum) { return stream.integer<decltype(minimum)>(minimum, maximum); };
+    CHECK(coversRange<short>(-10, 10, fromStream));
+    CHECK(coversRange<short>(-30000, -29990, fromStream));
+    CHECK(coversRange<signed char>(-100, 100, fromStream));
+    CHECK(coversRange<int8_t>(-128, 127, fromStream));
+    CHECK(coversRange<unsigned char>(0, 255, fromStream));
+
+#if defined(__SIZEOF_INT128__)
+    // Égalité avec la référence, y compris une plage où le rejet est
+    // fréquent (un peu plus de 2^63 valeurs).
+    for (uint64_t range : { maximum, (uint64_t{ 1 } << 63) + 12345, std::numeric_limits<uint64_t>::max() - 1 }) {
+        Random::seed(77);
+        Random::Engine reference(77);
+        bool matches{ true };
+        for (size_t i{}; i < 10000; ++i) {
+            matches = matches && Random::integer<uint64_t>(0, range) == referenceBounded(reference, range);
+        }
+        CHECK(matches);
+    }
+#endif
+
+    return checkReport();
+}
@@ -0,0 +1,77 @@
+// Test : effacements opaques et translucides de Screen.
+//
+// Un effacement opaque cache tout ce qui a été dessiné avant lui; un
+// effacement translucide se mélange au contenu déjà dessiné. L'image est
+// rendue par le rendu logiciel (Application::setRasterized) et lue à
+// l'image suivante.
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include "Check.h"
+
+#include <cstdlib>
+#include <string>
+
+
+namespace {
+
+    bool near(ezgame::ColorRGBA8 color, int red, int green, int blue)
+    {
+        return std::abs(color.red() - red) <= 2 && std::abs(color.green() - green) <= 2 && std::abs(color.blue() - blue) <= 2;
+    }
+
+    ezgame::ColorRGBA8 hidden, blended, afterClear, background;
+    bool observed{};
+
+    class ClearEngine
+    {
+    public:
+        float width() const { return 320.0f; }
+        float height() const { return 240.0f; }
+        std::string title() const { return "ScreenClearTest"; }
+        std::string iconFileName() const { return ""; }
+
+        bool provessEvents(ezgame::Keyboard const&, ezgame::Timer const&) { return true; }
+
+        void processDisplay(ezgame::Screen & screen)
+        {
+            // Image précédente, déjà exécutée.
+            ezgame::Framebuffer const & framebuffer{ screen.framebuffer() };
+            if (framebuffer.width() > 0) {
+                hidden = framebuffer.pixel(20, 200);
+                blended = framebuffer.pixel(50, 50);
+                afterClear = framebuffer.pixel(150, 50);
+                background = framebuffer.pixel(250, 50);
+                observed = true;
+            }
+
+            screen.clear(ezgame::Color::White);
+            screen.draw(ezgame::Circle(20.0f, ezgame::Vect2d(20.0f, 200.0f), ezgame::Color::Green));
+            screen.clear(ezgame::Color::Black);
+            screen.draw(ezgame::Circle(20.0f, ezgame::Vect2d(50.0f, 50.0f), ezgame::Color::Red));
+            screen.clear(ezgame::Color(0.0f, 0.0f, 1.0f, 0.5f));
+            screen.draw(ezgame::Circle(20.0f, ezgame::Vect2d(150.0f, 50.0f), ezgame::Color::Green));
+        }
+    };
+
+} // namespace
+
+
+int main()
+{
+    ezgame::Application application;
+    application.setRasterized(true);
+    application.setFrameLimit(2);
+    application.run<ClearEngine>();
+
+    CHECK(observed);
+    // Caché par l'effacement opaque noir.
+    CHECK(near(hidden, 0, 0, 128));
+    // Rouge dessiné avant l'effacement translucide, puis mélangé au bleu.
+    CHECK(near(blended, 128, 0, 128));
+    CHECK(near(afterClear, 0, 255, 0));
+    CHECK(near(background, 0, 0, 128));
+
+    return checkReport();
+}
@@ -0,0 +1,74 @@
+// Test : mises à jour de Text sans allocation.
+//
+// Les allocations sont comptées par AllocationCounter. Une fois le texte
+// en place, les mises à jour numériques et les textes courts (au plus
+// Text::smInlineCapacity caractères), ainsi que leurs copies, ne doivent
+// rien allouer. Vérifie aussi le texte produit et les
+// valeurs par défaut documentées.
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include "Check.h"
+
+#include <string>
+
+
+namespace {
+
+    size_t const smFrameCount{ 1000 };
+
+} // namespace
+
+
+int main()
+{
+    using ezgame::Text;
+
+    // Valeurs par défaut.
+    Text const empty;
+    CHECK(empty.textView().empty());
+    CHECK(empty.textSize() == 0.0f);
+    CHECK(empty.position() == ezgame::Vect2d());
+    CHECK(empty.alignment() == ezgame::Alignment::BaseLeft);
+    CHECK(ezgame::ColorRGBA8(empty.fillColor()).packed() == ezgame::ColorRGBA8(ezgame::Color()).packed());
+    CHECK(empty.edgeSize() == 0.0f);
+
+    // Texte produit.
+    Text score("0", 20.0f, ezgame::Vect2d(10.0f, 10.0f), ezgame::Color::White);
+    score.setText(size_t{ 1234567 });
+    CHECK(score.textView() == "1234567");
+    score.setText(-42);
+    CHECK(score.textView() == "-42");
+    score.setText(3.14159f, 2);
+    CHECK(score.textView() == "3.14");
+    score.setText(2.5f, 0);
+    CHECK(score.textView() == "2");
+    score.setTextSize(-3.0f);
+    CHECK(score.textSize() == 0.0f);
+
+    // Texte long, puis court, puis long à nouveau : la chaîne allouée est
+    // conservée.
+    std::string const longText(Text::smInlineCapacity + 8, 'x');
+    std::string const label("Proies restantes : 500");
+    Text banner(longText, 20.0f, ezgame::Vect2d(), ezgame::Color::White);
+    CHECK(banner.text() == longText);
+    CHECK(ezgame::AllocationCounter::count() > 0);
+    banner.setText(label);
+    CHECK(banner.text() == label);
+
+    // Régime établi : aucune allocation.
+    Text copy;
+    size_t const before{ ezgame::AllocationCounter::count() };
+    for (size_t frame{}; frame < smFrameCount; ++frame) {
+        score.setText(frame);
+        score.setText(static_cast<int>(frame) - 500);
+        score.setText(static_cast<float>(frame) / 7.0f, 3);
+        banner.setText(frame % 2 ? label : longText);
+        copy = score;
+    }
+    CHECK(ezgame::AllocationCounter::count() == before);
+    CHECK(copy.textView() == score.textView());
+
+    return checkReport();
+}
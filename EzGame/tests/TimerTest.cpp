@@ -0,0 +1,127 @@
+// Test : statistiques de Timer sur des temps imposés.
+//
+// Une session dont les temps écoulés sont connus est relue par
+// Application (voir InputRecording) : à chaque pas, les centiles, le
+// maximum de la fenêtre glissante et le nombre de tics hors budget vus par
+// le moteur de jeu sont comparés à ceux calculés directement sur les
+// derniers temps imposés. Un centile peut dépasser la valeur exacte d'au
+// plus la largeur de sa classe (1/64 de la valeur), sans dépasser le
+// maximum.
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include "Check.h"
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+    size_t const smTicCount{ 2000 };
+    size_t const smWindowSize{ 100 };
+    int64_t const smFrameBudget{ 16'667 };
+    double const smPercentiles[]{ 0.0, 0.01, 0.25, 0.5, 0.9, 0.99, 1.0 };
+
+    std::vector<int64_t> imposedTimes;
+
+    size_t checkedTicCount{};
+    size_t percentileErrorCount{};
+    size_t maximumErrorCount{};
+    size_t overBudgetErrorCount{};
+    size_t windowErrorCount{};
+
+    class StatisticsEngine
+    {
+    public:
+        float width() const { return 320.0f; }
+        float height() const { return 240.0f; }
+        std::string title() const { return "TimerTest"; }
+        std::string iconFileName() const { return ""; }
+
+        bool provessEvents(ezgame::Keyboard const&, ezgame::Timer const& timer)
+        {
+            // Derniers temps imposés, bornés comme dans Timer.
+            size_t const end{ ++checkedTicCount };
+            size_t const begin{ end > smWindowSize ? end - smWindowSize : 0 };
+            std::vector<int64_t> window;
+            for (size_t i{ begin }; i < end; ++i) {
+                window.push_back(std::clamp(imposedTimes[i], int64_t{}, ezgame::Timer::smMaximumTicTime));
+            }
+            std::vector<int64_t> sorted{ window };
+            std::sort(sorted.begin(), sorted.end());
+
+            int64_t const maximum{ sorted.back() };
+            maximumErrorCount += timer.max() == maximum ? 0 : 1;
+            windowErrorCount += timer.windowTicCount() == window.size() ? 0 : 1;
+            size_t const overBudget{ static_cast<size_t>(std::count_if(window.begin(), window.end(), [](int64_t time) { return time > smFrameBudget; })) };
+            overBudgetErrorCount += timer.overBudgetCount() == overBudget ? 0 : 1;
+
+            for (double p : smPercentiles) {
+                size_t const rank{ std::max(static_cast<size_t>(std::ceil(p * static_cast<double>(sorted.size()))), size_t{ 1 }) };
+                int64_t const exact{ sorted[rank - 1] };
+                int64_t const measured{ timer.percentile(p) };
+                bool const correct{ measured >= exact && measured - exact <= exact / 64 && measured <= maximum };
+                percentileErrorCount += correct ? 0 : 1;
+            }
+            return true;
+        }
+
+        void processDisplay(ezgame::Screen &) {}
+    };
+
+} // namespace
+
+
+int main()
+{
+    // Temps exacts (moins de 128 us), courants, hors budget, et quelques
+    // temps plus longs que Timer::smMaximumTicTime.
+    std::mt19937 generator(434);
+    std::uniform_int_distribution<int64_t> small(0, 127);
+    std::uniform_int_distribution<int64_t> usual(10'000, 20'000);
+    std::uniform_int_distribution<int64_t> spike(20'000, 2'000'000);
+    for (size_t i{}; i < smTicCount; ++i) {
+        if (i % 97 == 0) {
+            imposedTimes.push_back(ezgame::Timer::smMaximumTicTime + static_cast<int64_t>(i));
+        } else if (i % 13 == 0) {
+            imposedTimes.push_back(spike(generator));
+        } else if (i % 5 == 0) {
+            imposedTimes.push_back(small(generator));
+        } else {
+            imposedTimes.push_back(usual(generator));
+        }
+    }
+    // Maximum qui sort de la fenêtre alors que le tic suivant est plus
+    // petit : la file monotone doit donner le tic suivant le plus grand.
+    for (size_t i{ 500 }; i < 500 + smWindowSize; ++i) {
+        imposedTimes[i] = 3'000'000 - static_cast<int64_t>(i);
+    }
+
+    ezgame::InputRecording recording;
+    for (int64_t time : imposedTimes) {
+        recording.add(ezgame::Keyboard::KeySet(), time);
+    }
+    std::string const fileName{ (std::filesystem::temp_directory_path() / "ezgame_timer_test.ezir").string() };
+    CHECK(recording.save(fileName));
+
+    ezgame::Application application;
+    application.setTimerWindow(smWindowSize);
+    application.setFrameBudget(smFrameBudget);
+    application.setReplayFile(fileName);
+    application.run<StatisticsEngine>();
+    std::filesystem::remove(fileName);
+
+    CHECK(checkedTicCount == smTicCount);
+    CHECK(percentileErrorCount == 0);
+    CHECK(maximumErrorCount == 0);
+    CHECK(overBudgetErrorCount == 0);
+    CHECK(windowErrorCount == 0);
+
+    return checkReport();
+}
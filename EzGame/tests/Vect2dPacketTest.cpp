@@ -0,0 +1,169 @@
+// Test : paquets SIMD (Float4, Float8, Vect2dx4, Vect2dx8) comparés aux
+// calculs scalaires.
+//
+// Chaque opération de Float4 et de Float8 doit donner, valeur par valeur,
+// exactement le résultat du calcul scalaire correspondant (les opérations
+// IEEE étant arrondies de la même façon). Les opérations de Vect2dx4 et de
+// Vect2dx8 sont comparées à celles de Vect2d, à l'arrondi près; les
+// vecteurs nuls normalisés restent nuls (documenté). Le test vaut pour
+// l'implémentation SIMD comme pour l'implémentation scalaire
+// (EZGAME_NO_SIMD).
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include "Check.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace {
+
+    size_t const smPacketCount{ 500 };
+    float const smTolerance{ 2.0e-6f };
+
+    std::mt19937 generator(434);
+
+    bool near(float a, float b)
+    {
+        return std::abs(a - b) <= smTolerance * std::max(1.0f, std::max(std::abs(a), std::abs(b)));
+    }
+
+    bool near(ezgame::Vect2d const & a, ezgame::Vect2d const & b)
+    {
+        return near(a.x(), b.x()) && near(a.y(), b.y());
+    }
+
+    // Valeurs aléatoires avec quelques valeurs particulières (zéros,
+    // valeurs égales, négatives).
+    std::vector<float> values(size_t count)
+    {
+        std::uniform_real_distribution<float> distribution(-1000.0f, 1000.0f);
+        std::vector<float> result(count);
+        for (size_t i{}; i < count; ++i) {
+            result[i] = i % 11 == 0 ? 0.0f : i % 7 == 0 ? 3.0f : distribution(generator);
+        }
+        return result;
+    }
+
+    // Opérations de FloatN comparées au calcul scalaire, valeur par valeur.
+    template <typename FloatN>
+    bool floatsMatch()
+    {
+        size_t const count{ smPacketCount * FloatN::size };
+        std::vector<float> const as{ values(count) };
+        std::vector<float> const bs{ values(count) };
+        bool equal{ true };
+        auto same = [&equal](FloatN const & packet, size_t lane, float expected) {
+            equal = equal && packet[lane] == expected;
+        };
+        for (size_t first{}; first < count; first += FloatN::size) {
+            FloatN const a{ FloatN::load(as.data() + first) };
+            FloatN const b{ FloatN::load(bs.data() + first) };
+            float stored[FloatN::size];
+            (a * b).store(stored);
+            for (size_t lane{}; lane < FloatN::size; ++lane) {
+                float const x{ as[first + lane] };
+                float const y{ bs[first + lane] };
+                same(a, lane, x);
+                equal = equal && stored[lane] == x * y;
+                same(-a, lane, -x);
+                same(a + b, lane, x + y);
+                same(a - b, lane, x - y);
+                if (y != 0.0f) {
+                    same(a / b, lane, x / y);
+                }
+                same(sqrt(maximum(a, FloatN())), lane, std::sqrt(std::max(x, 0.0f)));
+                same(minimum(a, b), lane, std::min(x, y));
+                same(maximum(a, b), lane, std::max(x, y));
+                same(reciprocalOrZero(a), lane, x > 0.0f ? 1.0f / x : 0.0f);
+                same(truncate(a * FloatN(1.37f)), lane, std::trunc(x * 1.37f));
+                same(selectLess(a, b, FloatN(1.0f), FloatN(2.0f)), lane, x < y ? 1.0f : 2.0f);
+                same(selectEqual(a, FloatN(3.0f), FloatN(1.0f), FloatN(2.0f)), lane, x == 3.0f ? 1.0f : 2.0f);
+            }
+        }
+        same(FloatN(), 0, 0.0f);
+        same(FloatN(2.5f), FloatN::size - 1, 2.5f);
+        return equal;
+    }
+
+    // Opérations de Vect2dPacket comparées à celles de Vect2d.
+    template <typename Packet>
+    bool vectorsMatch()
+    {
+        using ezgame::Vect2d;
+        using FloatN = std::remove_cvref_t<decltype(std::declval<Packet>().x())>;
+
+        size_t const count{ smPacketCount * Packet::size };
+        std::vector<float> const xs{ values(count) };
+        std::vector<float> const ys{ values(count) };
+        std::vector<float> const scalars{ values(count) };
+        std::vector<float> const orientations{ values(count) };
+        bool equal{ true };
+        for (size_t first{}; first < count; first += Packet::size) {
+            Packet const a{ Packet::load(xs.data() + first, ys.data() + first) };
+            Packet const b{ Packet::load(ys.data() + first, xs.data() + first) };
+            FloatN const scalar{ FloatN::load(scalars.data() + first) };
+            FloatN const orientation{ FloatN::load(orientations.data() + first) };
+
+            std::vector<Vect2d> vectors(Packet::size);
+            a.store(vectors.data());
+            Packet const reloaded{ Packet::load(vectors.data()) };
+            Packet const polar{ Packet::fromPolar(scalar, orientation) };
+            for (size_t lane{}; lane < Packet::size; ++lane) {
+                Vect2d const u(xs[first + lane], ys[first + lane]);
+                Vect2d const v(ys[first + lane], xs[first + lane]);
+                float const s{ scalars[first + lane] };
+                equal = equal && a[lane].x() == u.x() && a[lane].y() == u.y();
+                equal = equal && vectors[lane].x() == u.x() && reloaded[lane].y() == u.y();
+                equal = equal && near(a.squaredLength()[lane], u.squaredLength());
+                equal = equal && near(a.length()[lane], u.length());
+                equal = equal && near(a.distance(b)[lane], u.distance(v));
+                equal = equal && near((a + b)[lane], u + v);
+                equal = equal && near((a - b)[lane], u - v);
+                equal = equal && near((a * scalar)[lane], u * s);
+                equal = equal && near((scalar * a)[lane], u * s);
+                if (s != 0.0f) {
+                    equal = equal && near((a / scalar)[lane], u / s);
+                }
+                if (u.squaredLength() > 0.0f) {
+                    equal = equal && near(a.normalized()[lane], u.normalized());
+                } else {
+                    equal = equal && a.normalized()[lane].x() == 0.0f && a.normalized()[lane].y() == 0.0f;
+                }
+                equal = equal && near(polar[lane], Vect2d::fromPolar(s, orientations[first + lane]));
+            }
+
+            // Opérateurs d'affectation.
+            Packet c{ a };
+            c += b;
+            c *= FloatN(2.0f);
+            c /= FloatN(4.0f);
+            c -= b;
+            for (size_t lane{}; lane < Packet::size; ++lane) {
+                equal = equal && near(c[lane], (a[lane] + b[lane]) * 0.5f - b[lane]);
+            }
+        }
+
+        Packet const broadcast{ ezgame::Vect2d(1.0f, -2.0f) };
+        equal = equal && broadcast[Packet::size - 1].x() == 1.0f && broadcast[0].y() == -2.0f;
+        return equal;
+    }
+
+} // namespace
+
+
+int main()
+{
+    CHECK(floatsMatch<ezgame::Float4>());
+    CHECK(floatsMatch<ezgame::Float8>());
+    CHECK(vectorsMatch<ezgame::Vect2dx4>());
+    CHECK(vectorsMatch<ezgame::Vect2dx8>());
+
+    return checkReport();
+}
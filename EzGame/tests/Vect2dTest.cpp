@@ -0,0 +1,55 @@
+// Test : mise en forme textuelle de la classe Vect2d.
+//
+// Vérifie que la précision est limitée à Vect2d::smMaximumPrecision et
+// que toString, formatTo, operator<< et std::format produisent toujours un texte
+// complet, même pour une grande précision, des valeurs extrêmes ou des
+// réglages plus longs que le tampon local.
+
+
+// Inclusion des bibliothèques
+#include <EzGame>
+#include "Check.h"
+
+#include <limits>
+#include <sstream>
+#include <string>
+
+
+int main()
+{
+    using ezgame::Vect2d;
+
+    Vect2d const vector(1.5f, -2.25f);
+    CHECK(vector.toString() == "(1.500, -2.250)");
+
+    // Précision limitée.
+    Vect2d::setPrecision(100);
+    CHECK(Vect2d::precision() == Vect2d::smMaximumPrecision);
+    CHECK(vector.toString() == "(1.50000000000000000000, -2.25000000000000000000)");
+
+    // Valeurs extrêmes à la précision maximale : le tampon documenté suffit.
+    float const maximum{ std::numeric_limits<float>::max() };
+    Vect2d const extreme(-maximum, -maximum);
+    char buffer[Vect2d::smFormatBufferSize];
+    size_t const length{ extreme.formatTo(buffer, sizeof(buffer)) };
+    CHECK(length > 0 && extreme.toString() == std::string(buffer, length));
+
+    // Format ponctuel : précision limitée elle aussi.
+    CHECK(vector.formatTo(buffer, sizeof(buffer), { "", " ", "", 1000 }) > 0);
+    CHECK(std::string(buffer) == "1.50000000000000000000 -2.25000000000000000000");
+    CHECK(vector.formatTo(buffer, sizeof(buffer), { "", " ", "", -4 }) > 0 && std::string(buffer) == "2 -2");
+
+    // Réglages plus longs que le tampon local.
+    std::string const longPrefix(200, '<');
+    Vect2d::setPrefix(longPrefix);
+    std::string const text{ extreme.toString() };
+    CHECK(text.size() > longPrefix.size() && text.compare(0, longPrefix.size(), longPrefix) == 0);
+    std::ostringstream stream;
+    stream << extreme;
+    CHECK(stream.str() == text);
+#if defined(__cpp_lib_format)
+    CHECK(std::format("{}", extreme) == text);
+#endif
+
+    return checkReport();
+}
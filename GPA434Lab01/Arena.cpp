@@ -40,42 +40,77 @@ float Arena::largerSize()
 
 ezgame::Vect2d Arena::restrictedPosition(ezgame::Vect2d unmodifiedVect)
 {
-	return (unmodifiedVect.x() > 0 && unmodifiedVect.x() < mWidth && unmodifiedVect.y() > 0 && unmodifiedVect.y() < mHeigth) ? unmodifiedVect : restrictedVector(unmodifiedVect);
+	return restrictedVector(unmodifiedVect);
 }
 
 ezgame::Vect2d Arena::warpedPosition(ezgame::Vect2d unmodifiedVect)
 {
-	return (unmodifiedVect.x() > 0 && unmodifiedVect.x() < mWidth && unmodifiedVect.y() > 0 && unmodifiedVect.y() < mHeigth) ? unmodifiedVect : warpedVector(unmodifiedVect);
+	return warpedVector(unmodifiedVect);
 }
 
 ezgame::Vect2d Arena::restrictedVector(ezgame::Vect2d unmodifiedVect)
 {
-	if (unmodifiedVect.x() < 0) {
-		return ezgame::Vect2d(0, unmodifiedVect.y());
-	}
-	if (unmodifiedVect.x() > mWidth) {
-		return ezgame::Vect2d(mWidth, unmodifiedVect.y());
-	}
-	if (unmodifiedVect.y() < 0) {
-		return ezgame::Vect2d(unmodifiedVect.x(), 0);
-	}
-	if (unmodifiedVect.y() > mHeigth) {
-		return ezgame::Vect2d(unmodifiedVect.x(), mHeigth);
-	}
+	return ezgame::Vect2d(restrictedCoordinate(unmodifiedVect.x(), mWidth), restrictedCoordinate(unmodifiedVect.y(), mHeigth));
 }
 
 ezgame::Vect2d Arena::warpedVector(ezgame::Vect2d unmodifiedVect)
 {
-	if (unmodifiedVect.x() < 0) {
-		return ezgame::Vect2d(mWidth, unmodifiedVect.y());
+	return ezgame::Vect2d(warpedCoordinate(unmodifiedVect.x(), mWidth), warpedCoordinate(unmodifiedVect.y(), mHeigth));
+}
+
+void Arena::restrictedPosition(std::span<float> xs, std::span<float> ys)
+{
+	restrictedCoordinates(xs, mWidth);
+	restrictedCoordinates(ys, mHeigth);
+}
+
+void Arena::warpedPosition(std::span<float> xs, std::span<float> ys)
+{
+	warpedCoordinates(xs, mWidth);
+	warpedCoordinates(ys, mHeigth);
+}
+
+void Arena::restrictedCoordinates(std::span<float> values, float maximum)
+{
+	// Blocs de taille fixe, sans branchement, que le compilateur peut
+	// vectoriser; le reste est traité un à un.
+	size_t count = values.size();
+	float * data = values.data();
+	size_t i = 0;
+	for (; i + smBatchBlockSize <= count; i += smBatchBlockSize) {
+		for (size_t k = 0; k < smBatchBlockSize; ++k) {
+			data[i + k] = restrictedCoordinate(data[i + k], maximum);
+		}
 	}
-	if (unmodifiedVect.x() > mWidth) {
-		return ezgame::Vect2d(0, unmodifiedVect.y());
+	for (; i < count; ++i) {
+		data[i] = restrictedCoordinate(data[i], maximum);
 	}
-	if (unmodifiedVect.y() < 0) {
-		return ezgame::Vect2d(unmodifiedVect.x(), mHeigth);
+}
+
+void Arena::warpedCoordinates(std::span<float> values, float maximum)
+{
+	size_t count = values.size();
+	float * data = values.data();
+	size_t i = 0;
+	for (; i + smBatchBlockSize <= count; i += smBatchBlockSize) {
+		for (size_t k = 0; k < smBatchBlockSize; ++k) {
+			data[i + k] = warpedCoordinate(data[i + k], maximum);
+		}
 	}
-	if (unmodifiedVect.y() > mHeigth) {
-		return ezgame::Vect2d(unmodifiedVect.x(), 0);
+	for (; i < count; ++i) {
+		data[i] = warpedCoordinate(data[i], maximum);
 	}
 }
+
+float Arena::restrictedCoordinate(float value, float maximum)
+{
+	value = value < 0 ? 0 : value;
+	return value > maximum ? maximum : value;
+}
+
+float Arena::warpedCoordinate(float value, float maximum)
+{
+	// Une position sortie d'un côté réapparaît du côté opposé.
+	float warped = value < 0 ? maximum : value;
+	return value > maximum ? 0 : warped;
+}
@@ -1,15 +1,21 @@
 #pragma once
 #include <EzGame>
+#include <span>
 
 class Arena
 {
 	private:
 		const float mMinimumSize = 50;
 		const float mMaximumSize = 2000;
+		static const size_t smBatchBlockSize = 8;
 		float mWidth = 0 ;
 		float mHeigth = 0;
 		ezgame::Vect2d restrictedVector(ezgame::Vect2d unmodifiedVect);
 		ezgame::Vect2d warpedVector(ezgame::Vect2d unmodifiedVect);
+		static float restrictedCoordinate(float value, float maximum);
+		static float warpedCoordinate(float value, float maximum);
+		static void restrictedCoordinates(std::span<float> values, float maximum);
+		static void warpedCoordinates(std::span<float> values, float maximum);
 
 	public:
 
@@ -31,5 +37,11 @@ class Arena
 
 		ezgame::Vect2d warpedPosition(ezgame::Vect2d unmodifiedVect);
 
+		// Versions par lot : chaque position (xs[i], ys[i]) est modifiée sur
+		// place. Les deux tableaux doivent avoir la même taille.
+		void restrictedPosition(std::span<float> xs, std::span<float> ys);
+
+		void warpedPosition(std::span<float> xs, std::span<float> ys);
+
 };
 
@@ -10,7 +10,11 @@
 #include "GameEngine.h"
 
 
+#ifdef _WIN32
 int WinMain()
+#else
+int main()
+#endif
 {
     ezgame::Application application;
     application.run<GameEngine>();
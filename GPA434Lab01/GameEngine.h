@@ -1,6 +1,7 @@
 #pragma once
 #include <EzGame>
 #include "Arena.h"
+#include "ObjectPool.h"
 
 class GameEngine
 {
@@ -13,32 +14,43 @@ class GameEngine
         std::string iconFileName() const { return ""; }
 
         bool provessEvents(ezgame::Keyboard const& keyboard, ezgame::Timer const& timer) {
-            if (keyboard.isKeyPressed(ezgame::Keyboard::Key::Space)) {
-                mCircle.move(ezgame::Vect2d::fromRandomized() * 2.5f);
-            }
-            if (keyboard.isKeyPressed(ezgame::Keyboard::Key::Left)) {
-                mCircle.move(ezgame::Vect2d::Vect2d(-1,0) * 2.5f);
-            }
-            if (keyboard.isKeyPressed(ezgame::Keyboard::Key::Right)) {
-                mCircle.move(ezgame::Vect2d::Vect2d(1, 0) * 2.5f);
-            }
-            if (keyboard.isKeyPressed(ezgame::Keyboard::Key::Up) {
-                mCircle.move(ezgame::Vect2d::Vect2d(0, 1) * 2.5f);
-            }
-            if (keyboard.isKeyPressed(ezgame::Keyboard::Key::Right)) {
-                mCircle.move(ezgame::Vect2d::Vect2d(1, 0) * 2.5f);
+            // Le joueur n'est jamais retiré de mCircles, mais sa poignée
+            // est vérifiée comme celle de tout autre objet.
+            if (ezgame::Circle * player = mCircles.get(mPlayer)) {
+                if (keyboard.isKeyPressed(ezgame::Keyboard::Key::Space)) {
+                    player->move(ezgame::Vect2d::fromRandomized() * 2.5f);
+                }
+                if (keyboard.isKeyPressed(ezgame::Keyboard::Key::Left)) {
+                    player->move(ezgame::Vect2d(-1,0) * 2.5f);
+                }
+                if (keyboard.isKeyPressed(ezgame::Keyboard::Key::Right)) {
+                    player->move(ezgame::Vect2d(1, 0) * 2.5f);
+                }
+                if (keyboard.isKeyPressed(ezgame::Keyboard::Key::Up)) {
+                    player->move(ezgame::Vect2d(0, 1) * 2.5f);
+                }
+                if (keyboard.isKeyPressed(ezgame::Keyboard::Key::Right)) {
+                    player->move(ezgame::Vect2d(1, 0) * 2.5f);
+                }
             }
             return !keyboard.isKeyPressed(ezgame::Keyboard::Key::Escape);
         }
         void processDisplay(ezgame::Screen& screen) {
             screen.clear();
             screen.draw(mText);
-            screen.draw(mCircle);
+            for (ezgame::Circle const & circle : mCircles) {
+                screen.draw(circle);
+            }
         }
 
     private:
+        // Tous les objets du jeu représentés par un cercle (joueur, 
+        // projectiles, ennemis, particules) sont rangés dans mCircles.
+        static const size_t smCircleCapacity = 4096;
+
         ezgame::Text mText;
-        ezgame::Circle mCircle;
+        ObjectPool<ezgame::Circle> mCircles = ObjectPool<ezgame::Circle>(smCircleCapacity);
+        ObjectPool<ezgame::Circle>::Handle mPlayer;
         Arena gameArena = Arena(width(),height());
 
         
@@ -0,0 +1,239 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Réserve d'objets de capacité fixe pour les entités du jeu (projectiles,
+// ennemis, particules...).
+//
+// Toute la mémoire est allouée à la construction : faire apparaître
+// (spawn) ou disparaître (despawn) un objet n'alloue rien et se fait en
+// temps constant. Les objets vivants sont rangés de façon contiguë, sans
+// trou, et se parcourent comme un tableau (objects(), begin(), end()).
+// Retirer un objet déplace le dernier objet vivant à sa place : l'ordre
+// n'est donc pas conservé.
+//
+// Un objet est désigné par une poignée (Handle) stable : un indice de case
+// et une génération. La génération de la case change à chaque despawn,
+// ce qui invalide toutes les poignées de l'objet disparu, même lorsque la
+// case est réutilisée par un nouvel objet. La génération est un entier non
+// signé (Generation) qui revient à zéro après sa valeur maximale : une
+// poignée conservée pendant 2^32 réutilisations de sa case (avec le type
+// par défaut) désignerait de nouveau un objet.
+template <typename T, typename Generation = uint32_t>
+class ObjectPool
+{
+	public:
+		struct Handle
+		{
+			static const uint32_t smInvalidIndex = UINT32_MAX;
+
+			uint32_t index = smInvalidIndex;
+			Generation generation = 0;
+
+			bool isValid() const { return index != smInvalidIndex; }
+			bool operator==(Handle const & other) const = default;
+		};
+
+	private:
+		struct Slot
+		{
+			// Position de l'objet dans mObjects (case occupée) ou case
+			// libre suivante (case libre).
+			uint32_t dense = 0;
+			Generation generation = 0;
+			bool alive = false;
+		};
+
+		static_assert(std::is_unsigned_v<Generation>);
+
+		std::vector<T> mObjects;
+		std::vector<uint32_t> mOwners;
+		std::vector<Slot> mSlots;
+		uint32_t mFirstFree = Handle::smInvalidIndex;
+
+		Handle place(uint32_t slot);
+
+	public:
+
+		explicit ObjectPool(size_t capacity);
+
+		size_t capacity() const { return mSlots.size(); }
+
+		size_t size() const { return mObjects.size(); }
+
+		bool empty() const { return mObjects.empty(); }
+
+		bool full() const { return mObjects.size() == mSlots.size(); }
+
+		// Ajoute l'objet donné. Retourne une poignée invalide si la réserve
+		// est pleine.
+		Handle spawn(T const & object);
+
+		Handle spawn(T && object);
+
+		// Retire l'objet désigné. Retourne faux si la poignée n'est plus
+		// valide.
+		bool despawn(Handle handle);
+
+		// Retire tous les objets pour lesquels predicate(objet) est vrai.
+		// Retourne le nombre d'objets retirés.
+		template <typename Predicate>
+		size_t despawnIf(Predicate predicate);
+
+		void clear();
+
+		bool contains(Handle handle) const;
+
+		// Retourne l'objet désigné, ou nullptr si la poignée n'est plus
+		// valide. Le pointeur reste valide jusqu'au prochain despawn.
+		T * get(Handle handle);
+
+		T const * get(Handle handle) const;
+
+		// Poignée de l'objet situé à la position donnée du parcours.
+		Handle handleAt(size_t index) const;
+
+		// Objets vivants, contigus.
+		std::span<T> objects() { return mObjects; }
+
+		std::span<T const> objects() const { return mObjects; }
+
+		T * begin() { return mObjects.data(); }
+
+		T * end() { return mObjects.data() + mObjects.size(); }
+
+		T const * begin() const { return mObjects.data(); }
+
+		T const * end() const { return mObjects.data() + mObjects.size(); }
+
+};
+
+template <typename T, typename Generation>
+ObjectPool<T, Generation>::ObjectPool(size_t capacity)
+	: mSlots(capacity)
+{
+	mObjects.reserve(capacity);
+	mOwners.reserve(capacity);
+	clear();
+}
+
+template <typename T, typename Generation>
+typename ObjectPool<T, Generation>::Handle ObjectPool<T, Generation>::place(uint32_t slot)
+{
+	Slot & placed = mSlots[slot];
+	mFirstFree = placed.dense;
+	placed.dense = static_cast<uint32_t>(mObjects.size() - 1);
+	placed.alive = true;
+	mOwners.push_back(slot);
+	return Handle{ slot, placed.generation };
+}
+
+template <typename T, typename Generation>
+typename ObjectPool<T, Generation>::Handle ObjectPool<T, Generation>::spawn(T const & object)
+{
+	if (full()) {
+		return Handle();
+	}
+	mObjects.push_back(object);
+	return place(mFirstFree);
+}
+
+template <typename T, typename Generation>
+typename ObjectPool<T, Generation>::Handle ObjectPool<T, Generation>::spawn(T && object)
+{
+	if (full()) {
+		return Handle();
+	}
+	mObjects.push_back(std::move(object));
+	return place(mFirstFree);
+}
+
+template <typename T, typename Generation>
+bool ObjectPool<T, Generation>::despawn(Handle handle)
+{
+	if (!contains(handle)) {
+		return false;
+	}
+
+	// Le dernier objet prend la place de l'objet retiré.
+	Slot & removed = mSlots[handle.index];
+	uint32_t last = static_cast<uint32_t>(mObjects.size() - 1);
+	if (removed.dense != last) {
+		mObjects[removed.dense] = std::move(mObjects[last]);
+		mOwners[removed.dense] = mOwners[last];
+		mSlots[mOwners[last]].dense = removed.dense;
+	}
+	mObjects.pop_back();
+	mOwners.pop_back();
+
+	++removed.generation;
+	removed.alive = false;
+	removed.dense = mFirstFree;
+	mFirstFree = handle.index;
+	return true;
+}
+
+template <typename T, typename Generation>
+template <typename Predicate>
+size_t ObjectPool<T, Generation>::despawnIf(Predicate predicate)
+{
+	size_t removed = 0;
+	size_t index = 0;
+	while (index < mObjects.size()) {
+		// Après un despawn, la position contient l'ancien dernier objet,
+		// qui doit aussi être testé.
+		if (predicate(mObjects[index])) {
+			despawn(handleAt(index));
+			++removed;
+		} else {
+			++index;
+		}
+	}
+	return removed;
+}
+
+template <typename T, typename Generation>
+void ObjectPool<T, Generation>::clear()
+{
+	for (uint32_t owner : mOwners) {
+		++mSlots[owner].generation;
+	}
+	mObjects.clear();
+	mOwners.clear();
+
+	// Les cases libres sont chaînées dans l'ordre de leurs indices.
+	mFirstFree = mSlots.empty() ? Handle::smInvalidIndex : 0;
+	for (size_t slot = 0; slot < mSlots.size(); ++slot) {
+		mSlots[slot].alive = false;
+		mSlots[slot].dense = slot + 1 < mSlots.size() ? static_cast<uint32_t>(slot + 1) : Handle::smInvalidIndex;
+	}
+}
+
+template <typename T, typename Generation>
+bool ObjectPool<T, Generation>::contains(Handle handle) const
+{
+	return handle.index < mSlots.size() && mSlots[handle.index].alive && mSlots[handle.index].generation == handle.generation;
+}
+
+template <typename T, typename Generation>
+T * ObjectPool<T, Generation>::get(Handle handle)
+{
+	return contains(handle) ? &mObjects[mSlots[handle.index].dense] : nullptr;
+}
+
+template <typename T, typename Generation>
+T const * ObjectPool<T, Generation>::get(Handle handle) const
+{
+	return contains(handle) ? &mObjects[mSlots[handle.index].dense] : nullptr;
+}
+
+template <typename T, typename Generation>
+typename ObjectPool<T, Generation>::Handle ObjectPool<T, Generation>::handleAt(size_t index) const
+{
+	uint32_t slot = mOwners[index];
+	return Handle{ slot, mSlots[slot].generation };
+}
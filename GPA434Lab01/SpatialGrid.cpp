@@ -0,0 +1,287 @@
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialGrid::SpatialGrid(Arena & arena, int divisions)
+{
+	mWidth = arena.getWidth();
+	mHeigth = arena.getHeigth();
+
+	// Les cellules couvrent exactement l'arène afin que le voisinage
+	// se referme correctement aux bords.
+	float cellSize = arena.smallerSize() / static_cast<float>(std::max(divisions, 1));
+	mColumns = std::max(1, static_cast<int>(mWidth / cellSize));
+	mRows = std::max(1, static_cast<int>(mHeigth / cellSize));
+	mCellWidth = mWidth / static_cast<float>(mColumns);
+	mCellHeigth = mHeigth / static_cast<float>(mRows);
+	mCells.resize(static_cast<size_t>(mColumns) * static_cast<size_t>(mRows));
+}
+
+float SpatialGrid::getCellWidth() const
+{
+	return mCellWidth;
+}
+
+float SpatialGrid::getCellHeigth() const
+{
+	return mCellHeigth;
+}
+
+int SpatialGrid::getColumns() const
+{
+	return mColumns;
+}
+
+int SpatialGrid::getRows() const
+{
+	return mRows;
+}
+
+size_t SpatialGrid::size() const
+{
+	return mCount;
+}
+
+void SpatialGrid::clear()
+{
+	for (std::vector<CellItem> & cell : mCells) {
+		cell.clear();
+	}
+	mEntries.clear();
+	mFreeIds.clear();
+	mMaximumRadius = 0;
+	mCount = 0;
+}
+
+size_t SpatialGrid::insert(ezgame::Vect2d position, float radius)
+{
+	size_t id;
+	if (!mFreeIds.empty()) {
+		id = mFreeIds.back();
+		mFreeIds.pop_back();
+	}
+	else {
+		id = mEntries.size();
+		mEntries.emplace_back();
+	}
+
+	CellItem item;
+	item.x = wrappedCoordinate(position.x(), mWidth);
+	item.y = wrappedCoordinate(position.y(), mHeigth);
+	item.radius = std::max(radius, 0.0f);
+	item.id = static_cast<uint32_t>(id);
+	mMaximumRadius = std::max(mMaximumRadius, item.radius);
+	linkToCell(item, cellOf(item.x, item.y));
+	++mCount;
+	return id;
+}
+
+size_t SpatialGrid::insert(ezgame::Circle const & circle)
+{
+	return insert(circle.position(), circle.radius());
+}
+
+void SpatialGrid::move(size_t id, ezgame::Vect2d position)
+{
+	Entry const & entry = mEntries[id];
+	CellItem & item = mCells[entry.cell][entry.slot];
+	item.x = wrappedCoordinate(position.x(), mWidth);
+	item.y = wrappedCoordinate(position.y(), mHeigth);
+
+	// La plupart des déplacements restent dans la même cellule.
+	uint32_t cell = cellOf(item.x, item.y);
+	if (cell != entry.cell) {
+		CellItem moved = item;
+		unlinkFromCell(id);
+		linkToCell(moved, cell);
+	}
+}
+
+void SpatialGrid::setRadius(size_t id, float radius)
+{
+	Entry const & entry = mEntries[id];
+	CellItem & item = mCells[entry.cell][entry.slot];
+	item.radius = std::max(radius, 0.0f);
+	mMaximumRadius = std::max(mMaximumRadius, item.radius);
+}
+
+void SpatialGrid::remove(size_t id)
+{
+	unlinkFromCell(id);
+	mFreeIds.push_back(id);
+	--mCount;
+}
+
+ezgame::Vect2d SpatialGrid::position(size_t id) const
+{
+	CellItem const & item = mCells[mEntries[id].cell][mEntries[id].slot];
+	return ezgame::Vect2d(item.x, item.y);
+}
+
+float SpatialGrid::radius(size_t id) const
+{
+	return mCells[mEntries[id].cell][mEntries[id].slot].radius;
+}
+
+size_t SpatialGrid::candidatePairs(std::vector<std::pair<size_t, size_t>> & pairs)
+{
+	return enumeratePairs(pairs, false);
+}
+
+size_t SpatialGrid::collidingPairs(std::vector<std::pair<size_t, size_t>> & pairs)
+{
+	return enumeratePairs(pairs, true);
+}
+
+size_t SpatialGrid::query(ezgame::Vect2d center, float radius, std::vector<size_t> & result)
+{
+	size_t initialSize = result.size();
+	float x = wrappedCoordinate(center.x(), mWidth);
+	float y = wrappedCoordinate(center.y(), mHeigth);
+	gatherNeighborhood(cellOf(x, y), radius + mMaximumRadius);
+
+	for (CellItem const & item : mNeighborhood) {
+		float dx = item.x - x;
+		float dy = item.y - y;
+		if (mNeighborhoodWraps) {
+			dx = wrappedDelta(dx, mWidth);
+			dy = wrappedDelta(dy, mHeigth);
+		}
+		float reach = item.radius + radius;
+		if (dx * dx + dy * dy <= reach * reach) {
+			result.push_back(item.id);
+		}
+	}
+
+	return result.size() - initialSize;
+}
+
+uint32_t SpatialGrid::cellOf(float x, float y) const
+{
+	// Les coordonnées sont déjà ramenées dans l'arène (wrappedCoordinate);
+	// la limite ne corrige que l'arrondi près du bord droit ou bas.
+	int column = std::min(static_cast<int>(x / mCellWidth), mColumns - 1);
+	int row = std::min(static_cast<int>(y / mCellHeigth), mRows - 1);
+	return static_cast<uint32_t>(row * mColumns + column);
+}
+
+float SpatialGrid::wrappedCoordinate(float value, float period)
+{
+	// Comme Arena::warpedPosition, une position sortie d'un côté est
+	// ramenée sur le bord opposé. Sur l'arène refermée, le bord droit (ou
+	// bas) est confondu avec le bord gauche (ou haut) : la coordonnée est
+	// ramenée dans [0, period) afin de rester dans la cellule choisie par
+	// cellOf et que les décalages du voisinage restent exacts.
+	return value >= 0 && value < period ? value : 0.0f;
+}
+
+float SpatialGrid::wrappedDelta(float delta, float period)
+{
+	// Plus courte distance sur l'arène refermée sur elle-même. Les deux
+	// positions étant dans l'arène, une seule correction suffit.
+	float half = 0.5f * period;
+	return delta - period * static_cast<float>(delta > half) + period * static_cast<float>(delta < -half);
+}
+
+void SpatialGrid::gatherNeighborhood(uint32_t cell, float reach)
+{
+	// Chaque cellule n'apparaît qu'une fois. Les cellules atteintes en
+	// traversant un bord sont décalées d'une largeur (ou d'une hauteur)
+	// d'arène, de sorte que les distances se calculent sans correction.
+	// Lorsque la portée couvre toute l'arène, aucun décalage n'est possible
+	// et la correction est faite pour chaque paire (mNeighborhoodWraps).
+	auto fill = [](std::vector<std::pair<int, float>> & indices, int center, int range, int count, float period) {
+		indices.clear();
+		if (2 * range + 1 >= count) {
+			for (int index = 0; index < count; ++index) {
+				indices.emplace_back(index, 0.0f);
+			}
+			return true;
+		}
+		for (int offset = -range; offset <= range; ++offset) {
+			int index = center + offset;
+			float shift = index < 0 ? -period : (index >= count ? period : 0.0f);
+			indices.emplace_back((index + count) % count, shift);
+		}
+		return false;
+	};
+
+	int columnRange = std::max(static_cast<int>(std::ceil(reach / mCellWidth)), 1);
+	int rowRange = std::max(static_cast<int>(std::ceil(reach / mCellHeigth)), 1);
+	bool wrapsColumns = fill(mNeighborColumns, static_cast<int>(cell % mColumns), columnRange, mColumns, mWidth);
+	bool wrapsRows = fill(mNeighborRows, static_cast<int>(cell / mColumns), rowRange, mRows, mHeigth);
+	mNeighborhoodWraps = wrapsColumns || wrapsRows;
+
+	mNeighborhood.clear();
+	for (auto [row, dy] : mNeighborRows) {
+		for (auto [column, dx] : mNeighborColumns) {
+			for (CellItem item : mCells[static_cast<size_t>(row) * mColumns + column]) {
+				item.x += dx;
+				item.y += dy;
+				mNeighborhood.push_back(item);
+			}
+		}
+	}
+}
+
+void SpatialGrid::linkToCell(CellItem const & item, uint32_t cell)
+{
+	std::vector<CellItem> & items = mCells[cell];
+	mEntries[item.id].cell = cell;
+	mEntries[item.id].slot = static_cast<uint32_t>(items.size());
+	items.push_back(item);
+}
+
+void SpatialGrid::unlinkFromCell(size_t id)
+{
+	Entry const & entry = mEntries[id];
+	std::vector<CellItem> & items = mCells[entry.cell];
+	items[entry.slot] = items.back();
+	mEntries[items[entry.slot].id].slot = entry.slot;
+	items.pop_back();
+}
+
+size_t SpatialGrid::enumeratePairs(std::vector<std::pair<size_t, size_t>> & pairs, bool exact)
+{
+	size_t initialSize = pairs.size();
+	float reach = 2.0f * mMaximumRadius;
+
+	for (uint32_t cell = 0; cell < mCells.size(); ++cell) {
+		std::vector<CellItem> const & items = mCells[cell];
+		if (items.empty()) {
+			continue;
+		}
+
+		// Le voisinage est copié dans un tampon contigu afin que la boucle
+		// interne soit longue et sans indirection.
+		gatherNeighborhood(cell, reach);
+
+		for (CellItem const & first : items) {
+			if (!exact) {
+				for (CellItem const & second : mNeighborhood) {
+					if (second.id > first.id) {
+						pairs.emplace_back(first.id, second.id);
+					}
+				}
+				continue;
+			}
+
+			// La collision, rare, est testée avant l'ordre des indices,
+			// imprévisible, afin que le branchement soit bien prédit.
+			for (CellItem const & second : mNeighborhood) {
+				float dx = second.x - first.x;
+				float dy = second.y - first.y;
+				if (mNeighborhoodWraps) {
+					dx = wrappedDelta(dx, mWidth);
+					dy = wrappedDelta(dy, mHeigth);
+				}
+				float sum = first.radius + second.radius;
+				if (dx * dx + dy * dy <= sum * sum && second.id > first.id) {
+					pairs.emplace_back(first.id, second.id);
+				}
+			}
+		}
+	}
+
+	return pairs.size() - initialSize;
+}
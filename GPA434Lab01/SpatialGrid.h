@@ -0,0 +1,106 @@
+#pragma once
+#include <EzGame>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "Arena.h"
+
+// Grille uniforme de partitionnement spatial couvrant l'arène.
+//
+// La taille des cellules est dérivée de Arena::smallerSize() et les
+// voisinages se referment sur eux-mêmes aux bords de l'arène, comme le
+// fait Arena::warpedPosition : un cercle près du bord gauche est voisin
+// d'un cercle près du bord droit.
+//
+// Les positions hors de l'arène sont ramenées sur le bord opposé, comme le
+// fait Arena::warpedPosition; position() retourne la position ainsi
+// ramenée dans [0, largeur) x [0, hauteur).
+//
+// Les cercles sont identifiés par l'indice retourné par insert(). Les
+// indices libérés par remove() sont réutilisés.
+class SpatialGrid
+{
+	private:
+		// Les données des cercles sont copiées dans leur cellule afin que
+		// le parcours d'une cellule lise une mémoire contiguë.
+		struct CellItem
+		{
+			float x = 0;
+			float y = 0;
+			float radius = 0;
+			uint32_t id = 0;
+		};
+
+		struct Entry
+		{
+			uint32_t cell = 0;
+			uint32_t slot = 0;
+		};
+
+		float mWidth = 0;
+		float mHeigth = 0;
+		float mCellWidth = 0;
+		float mCellHeigth = 0;
+		int mColumns = 1;
+		int mRows = 1;
+		float mMaximumRadius = 0;
+		size_t mCount = 0;
+		std::vector<Entry> mEntries;
+		std::vector<size_t> mFreeIds;
+		std::vector<std::vector<CellItem>> mCells;
+		std::vector<std::pair<int, float>> mNeighborColumns;
+		std::vector<std::pair<int, float>> mNeighborRows;
+		std::vector<CellItem> mNeighborhood;
+		bool mNeighborhoodWraps = false;
+
+		uint32_t cellOf(float x, float y) const;
+		static float wrappedCoordinate(float value, float period);
+		static float wrappedDelta(float delta, float period);
+		void gatherNeighborhood(uint32_t cell, float reach);
+		void linkToCell(CellItem const & item, uint32_t cell);
+		void unlinkFromCell(size_t id);
+		size_t enumeratePairs(std::vector<std::pair<size_t, size_t>> & pairs, bool exact);
+
+	public:
+
+		SpatialGrid(Arena & arena, int divisions = 32);
+
+		float getCellWidth() const;
+
+		float getCellHeigth() const;
+
+		int getColumns() const;
+
+		int getRows() const;
+
+		size_t size() const;
+
+		void clear();
+
+		size_t insert(ezgame::Vect2d position, float radius);
+
+		size_t insert(ezgame::Circle const & circle);
+
+		void move(size_t id, ezgame::Vect2d position);
+
+		void setRadius(size_t id, float radius);
+
+		void remove(size_t id);
+
+		ezgame::Vect2d position(size_t id) const;
+
+		float radius(size_t id) const;
+
+		// Paires (a, b), a < b, de cercles situés dans des cellules voisines
+		// (phase large). Retourne le nombre de paires ajoutées.
+		size_t candidatePairs(std::vector<std::pair<size_t, size_t>> & pairs);
+
+		// Paires (a, b), a < b, de cercles en collision. Retourne le nombre
+		// de paires ajoutées.
+		size_t collidingPairs(std::vector<std::pair<size_t, size_t>> & pairs);
+
+		// Cercles touchant le disque donné. Retourne le nombre d'indices
+		// ajoutés.
+		size_t query(ezgame::Vect2d center, float radius, std::vector<size_t> & result);
+
+};
@@ -0,0 +1,97 @@
+// Banc d'essai : Arena::warpedPosition et Arena::restrictedPosition.
+//
+// Compare, pour 1k, 10k et 100k positions, l'appel par position 
+// (ezgame::Vect2d) et l'appel par lot sur des tableaux de coordonnées.
+//
+// Compilation (Linux) :
+//   g++ -std=c++20 -O2 -IEzGame/include -IGPA434Lab01 GPA434Lab01/benchmarks/ArenaBenchmark.cpp GPA434Lab01/Arena.cpp <EzGame>
+
+
+#include <EzGame>
+#include "Arena.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+
+namespace {
+
+	using Clock = std::chrono::steady_clock;
+
+	size_t const smRepetitionCount = 20;
+
+	// Retourne le meilleur temps par position, en nanosecondes. Les 
+	// positions sont régénérées avant chaque répétition afin qu'une part 
+	// d'entre elles soient hors de l'arène.
+	template <typename Reset, typename Function>
+	double bestNanosecondsPerPosition(size_t count, Reset reset, Function function)
+	{
+		double best = std::numeric_limits<double>::max();
+		for (size_t repetition = 0; repetition < smRepetitionCount; ++repetition) {
+			reset();
+			Clock::time_point start = Clock::now();
+			function();
+			double elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+			best = std::min(best, elapsed / static_cast<double>(count));
+		}
+		return best;
+	}
+
+	void run(Arena & arena, size_t count)
+	{
+		std::vector<float> initialX(count);
+		std::vector<float> initialY(count);
+		for (size_t i = 0; i < count; ++i) {
+			initialX[i] = ezgame::Random::real(-0.1f * arena.getWidth(), 1.1f * arena.getWidth());
+			initialY[i] = ezgame::Random::real(-0.1f * arena.getHeigth(), 1.1f * arena.getHeigth());
+		}
+
+		std::vector<ezgame::Vect2d> positions(count);
+		std::vector<float> xs(count);
+		std::vector<float> ys(count);
+		auto resetPositions = [&]() {
+			for (size_t i = 0; i < count; ++i) {
+				positions[i] = ezgame::Vect2d(initialX[i], initialY[i]);
+			}
+		};
+		auto resetCoordinates = [&]() {
+			xs = initialX;
+			ys = initialY;
+		};
+
+		double scalarWarp = bestNanosecondsPerPosition(count, resetPositions, [&]() {
+			for (ezgame::Vect2d & position : positions) {
+				position = arena.warpedPosition(position);
+			}
+		});
+		double batchWarp = bestNanosecondsPerPosition(count, resetCoordinates, [&]() {
+			arena.warpedPosition(xs, ys);
+		});
+		double scalarRestrict = bestNanosecondsPerPosition(count, resetPositions, [&]() {
+			for (ezgame::Vect2d & position : positions) {
+				position = arena.restrictedPosition(position);
+			}
+		});
+		double batchRestrict = bestNanosecondsPerPosition(count, resetCoordinates, [&]() {
+			arena.restrictedPosition(xs, ys);
+		});
+
+		std::printf("%7zu positions | warped : %6.3f ns -> %6.3f ns (x%5.1f) | restricted : %6.3f ns -> %6.3f ns (x%5.1f)\n",
+			count, scalarWarp, batchWarp, scalarWarp / batchWarp, scalarRestrict, batchRestrict, scalarRestrict / batchRestrict);
+	}
+
+} // namespace
+
+
+int main()
+{
+	Arena arena(800.0f, 600.0f);
+	for (size_t count : { size_t{ 1'000 }, size_t{ 10'000 }, size_t{ 100'000 } }) {
+		run(arena, count);
+	}
+
+	return 0;
+}
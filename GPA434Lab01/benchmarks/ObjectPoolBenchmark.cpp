@@ -0,0 +1,133 @@
+// Banc d'essai : ObjectPool comme réserve des cercles du jeu.
+//
+// Simule des particules de courte durée : à chaque image, 200 cercles
+// apparaissent, tous les cercles se déplacent et ceux dont la durée de vie
+// est écoulée disparaissent (environ 4700 cercles vivants). Compare
+// ObjectPool à une std::list de cercles (une allocation par apparition,
+// les itérateurs servant de poignées stables).
+//
+// Les allocations sont comptées (AllocationCounter). Les
+// poignées périmées sont aussi vérifiées : après un despawn, l'ancienne
+// poignée ne doit plus désigner aucun objet, même si sa case est réutilisée.
+//
+// Compilation (Linux) :
+//   g++ -std=c++20 -O2 -DEZGAME_COUNT_ALLOCATIONS -IEzGame/include -IGPA434Lab01 GPA434Lab01/benchmarks/ObjectPoolBenchmark.cpp <EzGame>
+
+
+#include <EzGame>
+#include "ObjectPool.h"
+
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <list>
+
+
+namespace {
+
+	using Clock = std::chrono::steady_clock;
+
+	size_t const smCapacity = 8192;
+	size_t const smSpawnsPerFrame = 200;
+	size_t const smLifetime = 30;
+	size_t const smWarmUpFrameCount = 100;
+	size_t const smFrameCount = 2000;
+	size_t const smRepetitionCount = 5;
+
+	struct Measure
+	{
+		double microsecondsPerFrame = 0;
+		double allocationsPerFrame = 0;
+		size_t alive = 0;
+	};
+
+	// La durée de vie restante est rangée dans le rayon : un cercle
+	// disparaît lorsque son rayon devient nul.
+	ezgame::Circle particle(size_t frame, size_t index)
+	{
+		float angle = static_cast<float>((frame * smSpawnsPerFrame + index) % 360);
+		return ezgame::Circle(static_cast<float>(smLifetime - index % 10), ezgame::Vect2d(400.0f, 300.0f) + ezgame::Vect2d::fromPolar(10.0f, angle), ezgame::Color::Orange);
+	}
+
+	template <typename Frame>
+	Measure measure(Frame frame, size_t (*alive)())
+	{
+		for (size_t i = 0; i < smWarmUpFrameCount; ++i) {
+			frame(i);
+		}
+
+		Measure best;
+		best.microsecondsPerFrame = std::numeric_limits<double>::max();
+		for (size_t repetition = 0; repetition < smRepetitionCount; ++repetition) {
+			size_t allocations = ezgame::AllocationCounter::count();
+			Clock::time_point start = Clock::now();
+			for (size_t i = 0; i < smFrameCount; ++i) {
+				frame(smWarmUpFrameCount + i);
+			}
+			double elapsed = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / static_cast<double>(smFrameCount);
+			if (elapsed < best.microsecondsPerFrame) {
+				best.microsecondsPerFrame = elapsed;
+				best.allocationsPerFrame = static_cast<double>(ezgame::AllocationCounter::count() - allocations) / static_cast<double>(smFrameCount);
+				best.alive = alive();
+			}
+		}
+		return best;
+	}
+
+	ObjectPool<ezgame::Circle> pool(smCapacity);
+	std::list<ezgame::Circle> list;
+
+	size_t poolSize() { return pool.size(); }
+	size_t listSize() { return list.size(); }
+
+	bool checkStaleHandles()
+	{
+		ObjectPool<ezgame::Circle> small(2);
+		auto first = small.spawn(ezgame::Circle());
+		auto second = small.spawn(ezgame::Circle());
+		bool valid = small.full() && !small.spawn(ezgame::Circle()).isValid();
+		valid = valid && small.despawn(first) && !small.despawn(first) && !small.contains(first) && small.get(second) != nullptr;
+		auto reused = small.spawn(ezgame::Circle(7.0f, ezgame::Vect2d(), ezgame::Color::Red));
+		valid = valid && reused.index == first.index && !small.contains(first) && small.get(first) == nullptr;
+		valid = valid && small.get(reused)->radius() == 7.0f;
+		small.clear();
+		return valid && !small.contains(second) && !small.contains(reused) && small.empty();
+	}
+
+} // namespace
+
+
+int main()
+{
+	ezgame::Vect2d const velocity(0.5f, 0.25f);
+
+	Measure poolMeasure = measure([&](size_t frame) {
+		for (size_t i = 0; i < smSpawnsPerFrame; ++i) {
+			pool.spawn(particle(frame, i));
+		}
+		for (ezgame::Circle & circle : pool) {
+			circle.move(velocity);
+			circle.setRadius(circle.radius() - 1.0f);
+		}
+		pool.despawnIf([](ezgame::Circle const & circle) { return circle.radius() <= 1.0f; });
+	}, poolSize);
+
+	Measure listMeasure = measure([&](size_t frame) {
+		for (size_t i = 0; i < smSpawnsPerFrame; ++i) {
+			list.push_back(particle(frame, i));
+		}
+		for (ezgame::Circle & circle : list) {
+			circle.move(velocity);
+			circle.setRadius(circle.radius() - 1.0f);
+		}
+		list.remove_if([](ezgame::Circle const & circle) { return circle.radius() <= 1.0f; });
+	}, listSize);
+
+	bool staleHandlesRejected = checkStaleHandles();
+
+	std::printf("%zu apparitions par image, %zu images\n", smSpawnsPerFrame, smFrameCount);
+	std::printf("ObjectPool : %7.2f us/image, %.3f allocation(s)/image, %zu cercles vivants\n", poolMeasure.microsecondsPerFrame, poolMeasure.allocationsPerFrame, poolMeasure.alive);
+	std::printf("std::list  : %7.2f us/image, %.3f allocation(s)/image, %zu cercles vivants\n", listMeasure.microsecondsPerFrame, listMeasure.allocationsPerFrame, listMeasure.alive);
+	std::printf("poignees perimees rejetees : %s\n", staleHandlesRejected ? "oui" : "non");
+	return staleHandlesRejected && poolMeasure.allocationsPerFrame == 0.0 ? 0 : 1;
+}
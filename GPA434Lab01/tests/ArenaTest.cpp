@@ -0,0 +1,77 @@
+// Test : versions par lot d'Arena::restrictedPosition et de
+// Arena::warpedPosition.
+//
+// Chaque position modifiée par lot doit être identique à celle donnée par
+// la version scalaire, pour des lots de toutes les tailles autour des
+// blocs de 8 (blocs complets et reste) et pour des coordonnées à
+// l'intérieur, sur les bords, à l'extérieur et infinies.
+
+
+#include <EzGame>
+#include "Check.h"
+#include "Arena.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+namespace {
+
+	float const smInfinity = std::numeric_limits<float>::infinity();
+
+} // namespace
+
+
+int main()
+{
+	using ezgame::Vect2d;
+
+	Arena arena(800.0f, 600.0f);
+	float width = arena.getWidth();
+	float heigth = arena.getHeigth();
+
+	// Valeurs particulières, puis valeurs aléatoires de part et d'autre de
+	// l'arène.
+	std::vector<float> special = { 0.0f, -0.0f, width, heigth, -1.0f, width + 1.0f, heigth + 1.0f,
+		std::nextafter(0.0f, -1.0f), std::nextafter(width, 2.0f * width), std::nextafter(heigth, 2.0f * heigth),
+		-smInfinity, smInfinity, 400.0f, 300.0f };
+	std::mt19937 generator(434);
+	std::uniform_real_distribution<float> distribution(-200.0f, 1000.0f);
+
+	bool restrictedEqual = true;
+	bool warpedEqual = true;
+	for (size_t count = 0; count <= 40; ++count) {
+		std::vector<float> xs(count);
+		std::vector<float> ys(count);
+		for (size_t i = 0; i < count; ++i) {
+			xs[i] = (i + count) % 3 == 0 ? special[(i + count) % special.size()] : distribution(generator);
+			ys[i] = (i + count) % 4 == 0 ? special[(i * 5 + count) % special.size()] : distribution(generator);
+		}
+
+		std::vector<float> restrictedXs = xs;
+		std::vector<float> restrictedYs = ys;
+		arena.restrictedPosition(restrictedXs, restrictedYs);
+		std::vector<float> warpedXs = xs;
+		std::vector<float> warpedYs = ys;
+		arena.warpedPosition(warpedXs, warpedYs);
+
+		for (size_t i = 0; i < count; ++i) {
+			Vect2d restricted = arena.restrictedPosition(Vect2d(xs[i], ys[i]));
+			Vect2d warped = arena.warpedPosition(Vect2d(xs[i], ys[i]));
+			restrictedEqual = restrictedEqual && restrictedXs[i] == restricted.x() && restrictedYs[i] == restricted.y();
+			warpedEqual = warpedEqual && warpedXs[i] == warped.x() && warpedYs[i] == warped.y();
+		}
+	}
+	CHECK(restrictedEqual);
+	CHECK(warpedEqual);
+
+	// Comportement documenté des bords : une position sortie d'un côté
+	// réapparaît du côté opposé, une position sur le bord ne bouge pas.
+	CHECK(arena.warpedPosition(Vect2d(-1.0f, heigth + 1.0f)) == Vect2d(width, 0.0f));
+	CHECK(arena.warpedPosition(Vect2d(width, 0.0f)) == Vect2d(width, 0.0f));
+	CHECK(arena.restrictedPosition(Vect2d(-1.0f, heigth + 1.0f)) == Vect2d(0.0f, heigth));
+
+	return checkReport();
+}
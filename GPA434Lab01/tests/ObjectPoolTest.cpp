@@ -0,0 +1,141 @@
+// Test : poignées et rangement d'ObjectPool.
+//
+// Les poignées d'un objet disparu doivent être rejetées, même lorsque sa
+// case est réutilisée. Retirer un objet déplace le dernier objet vivant à
+// sa place sans changer sa poignée. La génération d'une case revient à
+// zéro après sa valeur maximale (vérifié avec une génération sur 8 bits).
+// despawnIf doit retirer exactement les objets choisis, y compris ceux
+// déplacés pendant le parcours.
+
+
+#include <EzGame>
+#include "Check.h"
+#include "ObjectPool.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+
+namespace {
+
+	// Vrai si les objets vivants sont exactement ceux donnés (dans un
+	// ordre quelconque) et si chaque poignée désigne le bon objet.
+	template <typename Pool>
+	bool holds(Pool const & pool, std::vector<int> expected, std::vector<typename Pool::Handle> const & handles)
+	{
+		std::vector<int> objects(pool.begin(), pool.end());
+		std::sort(objects.begin(), objects.end());
+		std::sort(expected.begin(), expected.end());
+		if (objects != expected || pool.size() != expected.size()) {
+			return false;
+		}
+		for (size_t index = 0; index < pool.size(); ++index) {
+			typename Pool::Handle handle = pool.handleAt(index);
+			if (pool.get(handle) != pool.begin() + index) {
+				return false;
+			}
+		}
+		for (typename Pool::Handle handle : handles) {
+			int const * object = pool.get(handle);
+			if (!object || std::find(expected.begin(), expected.end(), *object) == expected.end()) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+} // namespace
+
+
+int main()
+{
+	// Réserve pleine et poignées invalides.
+	ObjectPool<int> pool(4);
+	CHECK(pool.empty() && pool.capacity() == 4);
+	std::vector<ObjectPool<int>::Handle> handles;
+	for (int value = 0; value < 4; ++value) {
+		handles.push_back(pool.spawn(value));
+	}
+	CHECK(pool.full());
+	CHECK(!pool.spawn(99).isValid());
+	CHECK(!pool.get(ObjectPool<int>::Handle()));
+	CHECK(!pool.contains(ObjectPool<int>::Handle{ 7, 0 }));
+
+	// Retrait au milieu : le dernier objet prend sa place et garde sa
+	// poignée.
+	CHECK(pool.despawn(handles[1]));
+	CHECK(pool.objects()[1] == 3);
+	CHECK(*pool.get(handles[3]) == 3);
+	CHECK(holds(pool, { 0, 2, 3 }, { handles[0], handles[2], handles[3] }));
+
+	// Poignée périmée : rejetée, même après réutilisation de sa case.
+	CHECK(!pool.contains(handles[1]));
+	CHECK(!pool.get(handles[1]));
+	CHECK(!pool.despawn(handles[1]));
+	ObjectPool<int>::Handle reused = pool.spawn(10);
+	CHECK(reused.index == handles[1].index && reused.generation != handles[1].generation);
+	CHECK(!pool.get(handles[1]));
+	CHECK(*pool.get(reused) == 10);
+	CHECK(holds(pool, { 0, 2, 3, 10 }, { handles[0], handles[2], handles[3], reused }));
+
+	// Retrait du dernier objet : rien n'est déplacé.
+	CHECK(pool.despawn(reused));
+	CHECK(holds(pool, { 0, 2, 3 }, { handles[0], handles[2], handles[3] }));
+
+	// clear invalide toutes les poignées.
+	pool.clear();
+	CHECK(pool.empty());
+	for (ObjectPool<int>::Handle handle : handles) {
+		CHECK(!pool.contains(handle));
+	}
+
+	// despawnIf : les objets déplacés pendant le parcours sont aussi
+	// testés (ici, toute la fin de la réserve est retirée).
+	ObjectPool<int> numbers(16);
+	std::vector<ObjectPool<int>::Handle> numberHandles;
+	for (int value = 0; value < 16; ++value) {
+		numberHandles.push_back(numbers.spawn(value));
+	}
+	CHECK(numbers.despawnIf([](int value) { return value % 3 == 0 || value >= 12; }) == 8);
+	std::vector<int> kept;
+	std::vector<ObjectPool<int>::Handle> keptHandles;
+	for (int value = 0; value < 16; ++value) {
+		bool removed = value % 3 == 0 || value >= 12;
+		CHECK(numbers.contains(numberHandles[value]) != removed);
+		if (!removed) {
+			kept.push_back(value);
+			keptHandles.push_back(numberHandles[value]);
+		}
+	}
+	CHECK(holds(numbers, kept, keptHandles));
+	CHECK(numbers.despawnIf([](int) { return false; }) == 0);
+	CHECK(numbers.despawnIf([](int) { return true; }) == kept.size());
+	CHECK(numbers.empty());
+
+	// Retour à zéro de la génération : une case réutilisée 256 fois
+	// retrouve sa première génération, les autres restent rejetées.
+	ObjectPool<int, uint8_t> small(1);
+	ObjectPool<int, uint8_t>::Handle first = small.spawn(0);
+	ObjectPool<int, uint8_t>::Handle previous = first;
+	bool staleRejected = true;
+	for (int cycle = 1; cycle < 256; ++cycle) {
+		CHECK(small.despawn(previous));
+		ObjectPool<int, uint8_t>::Handle next = small.spawn(cycle);
+		staleRejected = staleRejected && next.index == first.index && next.generation == static_cast<uint8_t>(cycle)
+			&& !small.contains(previous) && !small.contains(first) && *small.get(next) == cycle;
+		previous = next;
+	}
+	CHECK(staleRejected);
+	CHECK(previous.generation == UINT8_MAX);
+	CHECK(small.despawn(previous));
+	CHECK(!small.contains(previous));
+	ObjectPool<int, uint8_t>::Handle wrapped = small.spawn(256);
+	CHECK(wrapped.generation == 0);
+	CHECK(wrapped == first);
+	CHECK(*small.get(first) == 256);
+	CHECK(small.despawn(wrapped));
+	CHECK(!small.contains(wrapped) && small.empty());
+
+	return checkReport();
+}
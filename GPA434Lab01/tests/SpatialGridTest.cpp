@@ -0,0 +1,142 @@
+// Test : SpatialGrid aux bords de l'arène.
+//
+// Les positions hors de l'arène doivent être ramenées comme le fait
+// Arena::warpedPosition, et les voisinages refermés sur eux-mêmes doivent
+// trouver les cercles de part et d'autre d'un bord. Les paires et les
+// requêtes de la grille sont comparées à une recherche exhaustive sur
+// l'arène refermée.
+
+
+#include <EzGame>
+#include "Check.h"
+#include "Arena.h"
+#include "SpatialGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+
+namespace {
+
+	bool contains(std::vector<size_t> const & ids, size_t id)
+	{
+		return std::find(ids.begin(), ids.end(), id) != ids.end();
+	}
+
+	// Plus courte distance sur l'arène refermée sur elle-même.
+	float torusDelta(float a, float b, float period)
+	{
+		float delta = std::abs(a - b);
+		return std::min(delta, period - delta);
+	}
+
+} // namespace
+
+
+int main()
+{
+	using ezgame::Vect2d;
+
+	Arena arena(800.0f, 600.0f);
+	float width = arena.getWidth();
+	float heigth = arena.getHeigth();
+	std::vector<size_t> found;
+	std::vector<std::pair<size_t, size_t>> pairs;
+
+	// Un cercle sorti par la gauche est ramené sur le bord, comme le fait
+	// Arena::warpedPosition, et reste visible d'une requête voisine.
+	SpatialGrid grid(arena);
+	size_t left = grid.insert(Vect2d(-5.0f, 300.0f), 3.0f);
+	CHECK(grid.position(left).x() == 0.0f);
+	CHECK(grid.query(Vect2d(2.0f, 300.0f), 1.0f, found) == 1 && found.back() == left);
+
+	// Sorti par la droite : visible depuis le bord opposé.
+	size_t right = grid.insert(Vect2d(width + 5.0f, 100.0f), 1.0f);
+	found.clear();
+	CHECK(grid.query(Vect2d(width - 1.0f, 100.0f), 1.0f, found) == 1 && found.back() == right);
+
+	// Un coin exact est confondu avec le coin opposé.
+	size_t corner = grid.insert(Vect2d(width, heigth), 1.0f);
+	CHECK(grid.position(corner).x() == 0.0f && grid.position(corner).y() == 0.0f);
+	found.clear();
+	CHECK(grid.query(Vect2d(width - 0.5f, heigth - 0.5f), 1.0f, found) == 1 && found.back() == corner);
+
+	// Tout près du bord droit (arrondi de la cellule).
+	size_t edge = grid.insert(Vect2d(std::nextafter(width, 0.0f), 450.0f), 1.0f);
+	found.clear();
+	CHECK(grid.query(Vect2d(1.0f, 450.0f), 1.0f, found) == 1 && found.back() == edge);
+
+	// Déplacement au-delà d'un bord.
+	grid.move(right, Vect2d(-3.0f, 200.0f));
+	CHECK(grid.position(right).x() == 0.0f);
+	found.clear();
+	CHECK(grid.query(Vect2d(width - 0.5f, 200.0f), 1.0f, found) == 1 && found.back() == right);
+
+	// Paire à cheval sur le bord gauche.
+	grid.clear();
+	size_t first = grid.insert(Vect2d(-1.0f, 50.0f), 1.0f);
+	size_t second = grid.insert(Vect2d(width - 1.0f, 50.0f), 1.0f);
+	CHECK(grid.collidingPairs(pairs) == 1 && pairs.back() == std::make_pair(std::min(first, second), std::max(first, second)));
+
+	// Comparaison exhaustive, positions tirées autour de l'arène.
+	std::mt19937 engine(434);
+	std::uniform_real_distribution<float> xs(-40.0f, width + 40.0f);
+	std::uniform_real_distribution<float> ys(-40.0f, heigth + 40.0f);
+	std::uniform_real_distribution<float> radii(1.0f, 12.0f);
+	std::vector<Vect2d> positions;
+	std::vector<float> radiuses;
+	grid.clear();
+	for (size_t i = 0; i < 600; ++i) {
+		positions.push_back(arena.warpedPosition(Vect2d(xs(engine), ys(engine))));
+		radiuses.push_back(radii(engine));
+		grid.insert(positions.back(), radiuses.back());
+	}
+	// La moitié des cercles sont déplacés au-delà des bords.
+	for (size_t i = 0; i < positions.size(); i += 2) {
+		Vect2d raw(xs(engine), ys(engine));
+		positions[i] = arena.warpedPosition(raw);
+		grid.move(i, raw);
+	}
+
+	auto colliding = [&](size_t a, size_t b) {
+		float dx = torusDelta(positions[a].x(), positions[b].x(), width);
+		float dy = torusDelta(positions[a].y(), positions[b].y(), heigth);
+		float sum = radiuses[a] + radiuses[b];
+		return dx * dx + dy * dy <= sum * sum;
+	};
+
+	std::vector<std::pair<size_t, size_t>> expected;
+	for (size_t a = 0; a < positions.size(); ++a) {
+		for (size_t b = a + 1; b < positions.size(); ++b) {
+			if (colliding(a, b)) {
+				expected.emplace_back(a, b);
+			}
+		}
+	}
+	pairs.clear();
+	grid.collidingPairs(pairs);
+	std::sort(pairs.begin(), pairs.end());
+	CHECK(!expected.empty());
+	CHECK(pairs == expected);
+
+	bool queriesMatch = true;
+	for (size_t i = 0; i < 200; ++i) {
+		Vect2d raw(xs(engine), ys(engine));
+		Vect2d center = arena.warpedPosition(raw);
+		float radius = radii(engine);
+		found.clear();
+		grid.query(raw, radius, found);
+		for (size_t id = 0; id < positions.size(); ++id) {
+			float dx = torusDelta(positions[id].x(), center.x(), width);
+			float dy = torusDelta(positions[id].y(), center.y(), heigth);
+			float sum = radiuses[id] + radius;
+			queriesMatch = queriesMatch && (dx * dx + dy * dy <= sum * sum) == contains(found, id);
+		}
+	}
+	CHECK(queriesMatch);
+
+	return checkReport();
+}